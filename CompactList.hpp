@@ -0,0 +1,736 @@
+#pragma once
+
+#include "ContainerDefines.hpp"
+
+#include <stdlib.h>
+#include <new>
+#include <utility>
+#include <type_traits>
+
+static inline constexpr U64 COMPACT_LIST_FIRST_CAPACITY = 16;	//Nodes allocated by the first growth of a CompactList, every growth after it doubles
+
+/// <summary>
+/// Doubly linked list whose nodes all live in one array and link to each other by 32-bit indices instead of pointers
+/// Erased nodes are chained into a free list and reused, the array only grows, so iterators stay valid across growth
+/// Trivially copyable values let the whole list be copied or written out as one block, see Data and UsedNodes
+/// </summary>
+template<typename T>
+struct CompactList
+{
+	static inline constexpr U32 NONE = U32_MAX;	//Index that links to no node
+
+	struct Node
+	{
+		T& Value() { return *(T*)storage; }
+		const T& Value() const { return *(const T*)storage; }
+
+		alignas(T) U8 storage[sizeof(T)];
+		U32 next;
+		U32 prev;
+	};
+
+	struct Iterator
+	{
+	public:
+		Iterator(CompactList* list, U32 index) : list{ list }, index{ index } {}
+
+		T& operator* () const { return list->nodes[index].Value(); }
+		T* operator-> () { return &list->nodes[index].Value(); }
+
+		Iterator& operator++ () { index = list->nodes[index].next; return *this; }
+		Iterator& operator-- () { index = index == NONE ? list->tail : list->nodes[index].prev; return *this; }
+
+		Iterator operator++ (int)
+		{
+			Iterator temp = *this;
+			++*this;
+			return temp;
+		}
+
+		Iterator operator-- (int)
+		{
+			Iterator temp = *this;
+			--*this;
+			return temp;
+		}
+
+		Iterator& operator+= (int i)
+		{
+			for (int j = 0; j < i; ++j) { ++*this; }
+			return *this;
+		}
+
+		Iterator& operator-= (int i)
+		{
+			for (int j = 0; j < i; ++j) { --*this; }
+			return *this;
+		}
+
+		Iterator operator+ (int i)
+		{
+			Iterator it = *this;
+			return it += i;
+		}
+
+		Iterator operator- (int i)
+		{
+			Iterator it = *this;
+			return it -= i;
+		}
+
+		friend bool operator== (const Iterator& a, const Iterator& b) { return a.index == b.index; }
+		friend bool operator!= (const Iterator& a, const Iterator& b) { return a.index != b.index; }
+
+		operator bool() { return index != NONE; }
+
+	private:
+		CompactList* list;
+		U32 index;
+
+		friend struct CompactList;
+	};
+
+public:
+	CompactList();
+	CompactList(const CompactList& other);
+	CompactList(CompactList&& other) noexcept;
+	CompactList& operator=(const CompactList& other);
+	CompactList& operator=(CompactList&& other) noexcept;
+
+	~CompactList();
+
+	/// <summary>
+	/// Destroys every value and frees the node array
+	/// </summary>
+	void Destroy();
+
+	/// <summary>
+	/// Grows the node array so count more values fit without another growth
+	/// </summary>
+	void Reserve(U64 count);
+
+	void PushBack(const T& value);
+	void PushBack(T&& value);
+	void PopBack();
+	void PushFront(const T& value);
+	void PushFront(T&& value);
+	void PopFront();
+	void Insert(U64 index, const T& value);
+	void Insert(U64 index, T&& value);
+	void InsertBack(Iterator& position, const T& value);
+	void InsertFront(Iterator& position, const T& value);
+	void InsertBack(Iterator& position, T&& value);
+	void InsertFront(Iterator& position, T&& value);
+
+	/// <summary>
+	/// Inserts copies of the values of other, the overloads taking an rvalue list move its values instead
+	/// </summary>
+	void Insert(U64 index, const CompactList& other);
+	void InsertBack(Iterator& position, const CompactList& other);
+	void InsertBack(Iterator& position, CompactList&& other);
+	void InsertFront(Iterator& position, const CompactList& other);
+	void InsertFront(Iterator& position, CompactList&& other);
+	void Remove(U64 index);
+
+	/// <summary>
+	/// Removes the value at position, position is moved to the value after it
+	/// </summary>
+	void Remove(Iterator& position);
+
+	/// <summary>
+	/// Removes the values from start up to but not including end, start is moved to end
+	/// </summary>
+	void Remove(Iterator& start, Iterator& end);
+	void RemoveAll(const T& value);
+	template<typename Predicate> U64 RemoveIf(Predicate predicate);
+
+	/// <summary>
+	/// Reverses the order of the values by swapping the links of every node, no value is moved
+	/// </summary>
+	void Reverse();
+
+	/// <summary>
+	/// Moves every value of other before position, the values have to move into this list's array so this is linear in the size of other, other is left empty
+	/// </summary>
+	void Splice(U64 index, CompactList& other);
+	void Splice(Iterator& position, CompactList& other);
+
+	/// <summary>
+	/// Merges the sorted values of other into this sorted list, stable and linear, other is left empty
+	/// </summary>
+	void Merge(CompactList& other);
+	template<typename Compare> void Merge(CompactList& other, Compare compare);
+
+	/// <summary>
+	/// Stable bottom-up merge sort that relinks nodes in place, never allocates and never moves a value
+	/// </summary>
+	void Sort();
+	template<typename Compare> void Sort(Compare compare);
+
+	Iterator begin() { return { this, head }; }
+	Iterator end() { return { this, NONE }; }
+	Iterator begin() const { return { (CompactList*)this, head }; }
+	Iterator end() const { return { (CompactList*)this, NONE }; }
+
+	U64 Size() const { return size; }
+	T& Front() { return nodes[head].Value(); }
+	const T& Front() const { return nodes[head].Value(); }
+	T& Back() { return nodes[tail].Value(); }
+	const T& Back() const { return nodes[tail].Value(); }
+
+	/// <returns>The node array, the first UsedNodes nodes are initialized links and only nodes reachable from the head hold values</returns>
+	const Node* Data() const { return nodes; }
+
+	/// <returns>The high-water mark of the node array, the amount of nodes that have ever been handed out, free or not</returns>
+	U64 UsedNodes() const { return used; }
+
+	/// <returns>The amount of nodes the array has room for</returns>
+	U64 Capacity() const { return capacity; }
+
+private:
+	template<typename Value> inline U32 CreateNode(Value&& value);
+	inline void LinkBefore(U32 position, U32 index);
+	inline void LinkAfter(U32 position, U32 index);
+	inline void EraseNode(U32 index);
+	inline U32 NodeAt(U64 index) const;
+	inline void Adopt(CompactList& other, U32 position);
+	inline void Grow(U64 count);
+	inline void CopyFrom(const CompactList& other);
+	inline void Reset();
+	template<typename Compare> inline U32 MergeRuns(U32 a, U32 aTail, U32 b, U32 bTail, U32& mergedTail, Compare& compare);
+
+	Node* nodes;
+	U32 head;
+	U32 tail;
+	U32 recycled;
+	U32 used;
+	U32 capacity;
+	U64 size;
+};
+
+template<typename T> inline CompactList<T>::CompactList()
+{
+	Reset();
+}
+
+template<typename T> inline CompactList<T>::CompactList(const CompactList<T>& other)
+{
+	Reset();
+	CopyFrom(other);
+}
+
+template<typename T> inline CompactList<T>::CompactList(CompactList<T>&& other) noexcept : nodes{ other.nodes }, head{ other.head }, tail{ other.tail },
+	recycled{ other.recycled }, used{ other.used }, capacity{ other.capacity }, size{ other.size }
+{
+	other.Reset();
+}
+
+template<typename T> inline CompactList<T>& CompactList<T>::operator=(const CompactList<T>& other)
+{
+	if (&other == this) { return *this; }
+
+	Destroy();
+	CopyFrom(other);
+
+	return *this;
+}
+
+template<typename T> inline CompactList<T>& CompactList<T>::operator=(CompactList<T>&& other) noexcept
+{
+	if (&other == this) { return *this; }
+
+	Destroy();
+
+	nodes = other.nodes;
+	head = other.head;
+	tail = other.tail;
+	recycled = other.recycled;
+	used = other.used;
+	capacity = other.capacity;
+	size = other.size;
+
+	other.Reset();
+
+	return *this;
+}
+
+template<typename T> inline CompactList<T>::~CompactList()
+{
+	Destroy();
+}
+
+template<typename T> inline void CompactList<T>::Destroy()
+{
+	if constexpr (!std::is_trivially_destructible_v<T>)
+	{
+		for (U32 index = head; index != NONE; index = nodes[index].next) { nodes[index].Value().~T(); }
+	}
+
+	free(nodes);
+	Reset();
+}
+
+template<typename T> inline void CompactList<T>::Reserve(U64 count)
+{
+	U64 needed = size + count;
+	if (needed > capacity) { Grow(needed); }
+}
+
+template<typename T> inline void CompactList<T>::PushBack(const T& value)
+{
+	LinkBefore(NONE, CreateNode(value));
+}
+
+template<typename T> inline void CompactList<T>::PushBack(T&& value)
+{
+	LinkBefore(NONE, CreateNode(std::move(value)));
+}
+
+template<typename T> inline void CompactList<T>::PopBack()
+{
+	if (size) { EraseNode(tail); }
+}
+
+template<typename T> inline void CompactList<T>::PushFront(const T& value)
+{
+	LinkBefore(head, CreateNode(value));
+}
+
+template<typename T> inline void CompactList<T>::PushFront(T&& value)
+{
+	LinkBefore(head, CreateNode(std::move(value)));
+}
+
+template<typename T> inline void CompactList<T>::PopFront()
+{
+	if (size) { EraseNode(head); }
+}
+
+template<typename T> inline void CompactList<T>::Insert(U64 index, const T& value)
+{
+	U32 node = CreateNode(value);
+	LinkBefore(NodeAt(index), node);
+}
+
+template<typename T> inline void CompactList<T>::Insert(U64 index, T&& value)
+{
+	U32 node = CreateNode(std::move(value));
+	LinkBefore(NodeAt(index), node);
+}
+
+template<typename T> inline void CompactList<T>::InsertBack(Iterator& position, const T& value)
+{
+	U32 node = CreateNode(value);
+	LinkAfter(position.index, node);
+}
+
+template<typename T> inline void CompactList<T>::InsertFront(Iterator& position, const T& value)
+{
+	U32 node = CreateNode(value);
+	LinkBefore(position.index, node);
+}
+
+template<typename T> inline void CompactList<T>::InsertBack(Iterator& position, T&& value)
+{
+	U32 node = CreateNode(std::move(value));
+	LinkAfter(position.index, node);
+}
+
+template<typename T> inline void CompactList<T>::InsertFront(Iterator& position, T&& value)
+{
+	U32 node = CreateNode(std::move(value));
+	LinkBefore(position.index, node);
+}
+
+template<typename T> inline void CompactList<T>::Insert(U64 index, const CompactList<T>& other)
+{
+	CompactList<T> copy(other);
+	Adopt(copy, NodeAt(index));
+}
+
+template<typename T> inline void CompactList<T>::InsertBack(Iterator& position, const CompactList<T>& other)
+{
+	CompactList<T> copy(other);
+	Adopt(copy, position.index == NONE ? NONE : nodes[position.index].next);
+}
+
+template<typename T> inline void CompactList<T>::InsertBack(Iterator& position, CompactList<T>&& other)
+{
+	Adopt(other, position.index == NONE ? NONE : nodes[position.index].next);
+}
+
+template<typename T> inline void CompactList<T>::InsertFront(Iterator& position, const CompactList<T>& other)
+{
+	CompactList<T> copy(other);
+	Adopt(copy, position.index);
+}
+
+template<typename T> inline void CompactList<T>::InsertFront(Iterator& position, CompactList<T>&& other)
+{
+	Adopt(other, position.index);
+}
+
+template<typename T> inline void CompactList<T>::Remove(U64 index)
+{
+	if (index < size) { EraseNode(NodeAt(index)); }
+}
+
+template<typename T> inline void CompactList<T>::Remove(Iterator& position)
+{
+	U32 index = position.index;
+	if (index == NONE) { return; }
+
+	position.index = nodes[index].next;
+	EraseNode(index);
+}
+
+template<typename T> inline void CompactList<T>::Remove(Iterator& start, Iterator& end)
+{
+	for (U32 index = start.index; index != NONE && index != end.index;)
+	{
+		U32 next = nodes[index].next;
+		EraseNode(index);
+		index = next;
+	}
+
+	start.index = end.index;
+}
+
+template<typename T> inline void CompactList<T>::RemoveAll(const T& value)
+{
+	for (U32 index = head; index != NONE;)
+	{
+		U32 next = nodes[index].next;
+		if (nodes[index].Value() == value) { EraseNode(index); }
+		index = next;
+	}
+}
+
+template<typename T> template<typename Predicate> inline U64 CompactList<T>::RemoveIf(Predicate predicate)
+{
+	U64 removed = 0;
+
+	for (U32 index = head; index != NONE;)
+	{
+		U32 next = nodes[index].next;
+
+		if (predicate(nodes[index].Value()))
+		{
+			EraseNode(index);
+			++removed;
+		}
+
+		index = next;
+	}
+
+	return removed;
+}
+
+template<typename T> inline void CompactList<T>::Reverse()
+{
+	for (U32 index = head; index != NONE;)
+	{
+		Node& node = nodes[index];
+		U32 next = node.next;
+		node.next = node.prev;
+		node.prev = next;
+		index = next;
+	}
+
+	U32 first = head;
+	head = tail;
+	tail = first;
+}
+
+template<typename T> inline void CompactList<T>::Splice(U64 index, CompactList<T>& other)
+{
+	Adopt(other, NodeAt(index));
+}
+
+template<typename T> inline void CompactList<T>::Splice(Iterator& position, CompactList<T>& other)
+{
+	Adopt(other, position.index);
+}
+
+template<typename T> inline void CompactList<T>::Merge(CompactList<T>& other)
+{
+	Merge(other, [](const T& a, const T& b) { return a < b; });
+}
+
+template<typename T> template<typename Compare> inline void CompactList<T>::Merge(CompactList<T>& other, Compare compare)
+{
+	if (&other == this || !other.size) { return; }
+	if (!size) { Adopt(other, NONE); return; }
+
+	//The values of other are moved to the back first, then the two runs are merged by relinking
+	U32 back = tail;
+	Adopt(other, NONE);
+
+	U32 second = nodes[back].next;
+	nodes[back].next = NONE;
+	nodes[second].prev = NONE;
+
+	head = MergeRuns(head, back, second, tail, tail, compare);
+}
+
+template<typename T> inline void CompactList<T>::Sort()
+{
+	Sort([](const T& a, const T& b) { return a < b; });
+}
+
+template<typename T> template<typename Compare> inline void CompactList<T>::Sort(Compare compare)
+{
+	if (size < 2) { return; }
+
+	//runs[i] holds a sorted run of 2^i nodes, each node is carried into the runs like a bit into a binary counter, so runs are merged while they are still small
+	U32 runs[33];
+	U32 tails[33];
+	for (U32 i = 0; i < 33; ++i) { runs[i] = NONE; }
+	U32 count = 0;
+
+	for (U32 index = head; index != NONE;)
+	{
+		U32 run = index;
+		U32 runTail = index;
+		index = nodes[index].next;
+		nodes[run].next = NONE;
+		nodes[run].prev = NONE;
+
+		U32 i = 0;
+		for (; runs[i] != NONE; ++i)
+		{
+			run = MergeRuns(runs[i], tails[i], run, runTail, runTail, compare);
+			runs[i] = NONE;
+		}
+
+		runs[i] = run;
+		tails[i] = runTail;
+		if (i >= count) { count = i + 1; }
+	}
+
+	//Higher runs hold earlier nodes, so they go first in every merge to keep equal values in order
+	U32 sorted = NONE;
+	U32 sortedTail = NONE;
+	for (U32 i = 0; i < count; ++i)
+	{
+		if (runs[i] == NONE) { continue; }
+
+		if (sorted != NONE) { sorted = MergeRuns(runs[i], tails[i], sorted, sortedTail, sortedTail, compare); }
+		else
+		{
+			sorted = runs[i];
+			sortedTail = tails[i];
+		}
+	}
+
+	head = sorted;
+	tail = sortedTail;
+}
+
+
+
+
+//Helpers
+template<typename T> template<typename Value> inline U32 CompactList<T>::CreateNode(Value&& value)
+{
+	U32 index;
+
+	if (recycled != NONE)
+	{
+		index = recycled;
+		recycled = nodes[index].next;
+	}
+	else if (used == capacity)
+	{
+		//value may live in the array that is about to move, so it is taken out before growing
+		T temp(std::forward<Value>(value));
+		Grow(capacity ? (U64)capacity * 2 : COMPACT_LIST_FIRST_CAPACITY);
+		index = used++;
+
+		new (nodes[index].storage) T(std::move(temp));
+		return index;
+	}
+	else { index = used++; }
+
+	new (nodes[index].storage) T(std::forward<Value>(value));
+
+	return index;
+}
+
+template<typename T> inline void CompactList<T>::LinkBefore(U32 position, U32 index)
+{
+	//Links are read into locals first, stores through the array could otherwise alias the U32 members and force reloads
+	Node* array = nodes;
+	U32 prev = position == NONE ? tail : array[position].prev;
+
+	array[index].next = position;
+	array[index].prev = prev;
+
+	if (prev != NONE) { array[prev].next = index; }
+	else { head = index; }
+
+	if (position != NONE) { array[position].prev = index; }
+	else { tail = index; }
+
+	++size;
+}
+
+template<typename T> inline void CompactList<T>::LinkAfter(U32 position, U32 index)
+{
+	LinkBefore(position == NONE ? NONE : nodes[position].next, index);
+}
+
+template<typename T> inline void CompactList<T>::EraseNode(U32 index)
+{
+	Node* array = nodes;
+	Node& node = array[index];
+	U32 next = node.next;
+	U32 prev = node.prev;
+
+	if (next != NONE) { array[next].prev = prev; }
+	else { tail = prev; }
+
+	if (prev != NONE) { array[prev].next = next; }
+	else { head = next; }
+
+	node.Value().~T();
+	node.next = recycled;
+	node.prev = NONE;
+	recycled = index;
+	--size;
+}
+
+template<typename T> inline U32 CompactList<T>::NodeAt(U64 index) const
+{
+	if (index >= size) { return NONE; }
+
+	U32 node = head;
+	for (U64 i = 0; i < index; ++i) { node = nodes[node].next; }
+
+	return node;
+}
+
+template<typename T> inline void CompactList<T>::Adopt(CompactList<T>& other, U32 position)
+{
+	if (&other == this || !other.size) { return; }
+
+	if (!size && !capacity)
+	{
+		*this = std::move(other);
+		return;
+	}
+
+	Reserve(other.size);
+
+	for (U32 index = other.head; index != NONE; index = other.nodes[index].next)
+	{
+		LinkBefore(position, CreateNode(std::move(other.nodes[index].Value())));
+	}
+
+	other.Destroy();
+}
+
+template<typename T> inline void CompactList<T>::Grow(U64 count)
+{
+	//Indices are 32-bit and NONE is reserved
+	if (count > U32_MAX - 1) { count = U32_MAX - 1; }
+	if (count <= capacity) { return; }
+
+	if constexpr (std::is_trivially_copyable_v<T>) { nodes = (Node*)realloc(nodes, count * sizeof(Node)); }
+	else
+	{
+		Node* grown = (Node*)malloc(count * sizeof(Node));
+
+		for (U32 index = 0; index < used; ++index)
+		{
+			grown[index].next = nodes[index].next;
+			grown[index].prev = nodes[index].prev;
+		}
+
+		for (U32 index = head; index != NONE; index = nodes[index].next)
+		{
+			new (grown[index].storage) T(std::move(nodes[index].Value()));
+			nodes[index].Value().~T();
+		}
+
+		free(nodes);
+		nodes = grown;
+	}
+
+	capacity = (U32)count;
+}
+
+template<typename T> inline void CompactList<T>::CopyFrom(const CompactList<T>& other)
+{
+	if (!other.used) { return; }
+
+	Grow(other.used);
+
+	//The copy keeps every index of other, free nodes included, so trivially copyable lists are one block copy
+	if constexpr (std::is_trivially_copyable_v<T>) { Copy(nodes, other.nodes, other.used); }
+	else
+	{
+		for (U32 index = 0; index < other.used; ++index)
+		{
+			nodes[index].next = other.nodes[index].next;
+			nodes[index].prev = other.nodes[index].prev;
+		}
+
+		for (U32 index = other.head; index != NONE; index = other.nodes[index].next)
+		{
+			new (nodes[index].storage) T(other.nodes[index].Value());
+		}
+	}
+
+	head = other.head;
+	tail = other.tail;
+	recycled = other.recycled;
+	used = other.used;
+	size = other.size;
+}
+
+template<typename T> inline void CompactList<T>::Reset()
+{
+	nodes = nullptr;
+	head = NONE;
+	tail = NONE;
+	recycled = NONE;
+	used = 0;
+	capacity = 0;
+	size = 0;
+}
+
+template<typename T> template<typename Compare> inline U32 CompactList<T>::MergeRuns(U32 a, U32 aTail, U32 b, U32 bTail, U32& mergedTail, Compare& compare)
+{
+	//Merges two runs ending in NONE and links both directions, a holds the earlier nodes and wins ties
+	U32 first;
+
+	if (compare(nodes[b].Value(), nodes[a].Value())) { first = b; b = nodes[b].next; }
+	else { first = a; a = nodes[a].next; }
+
+	nodes[first].prev = NONE;
+	U32 last = first;
+
+	while (a != NONE && b != NONE)
+	{
+		U32 index;
+		if (compare(nodes[b].Value(), nodes[a].Value())) { index = b; b = nodes[b].next; }
+		else { index = a; a = nodes[a].next; }
+
+		nodes[last].next = index;
+		nodes[index].prev = last;
+		last = index;
+	}
+
+	U32 rest = a != NONE ? a : b;
+	nodes[last].next = rest;
+
+	if (rest != NONE)
+	{
+		nodes[rest].prev = last;
+		mergedTail = a != NONE ? aTail : bTail;
+	}
+	else { mergedTail = last; }
+
+	return first;
+}
@@ -50,13 +50,36 @@ static inline constexpr F64 F64_MIN = 2.2250738585072014e-308;	//Minimum value o
 
 #include <intrin.h>
 #include <string.h>
+#include <type_traits>
 
+/// <returns>Whether dst starts inside of (src, src + count), the values must then be moved back to front</returns>
 template<class Type>
-static inline Type* Copy(Type* dst, const Type* src, U64 count)
+constexpr inline bool OverlapsForward(const Type* dst, const Type* src, U64 count)
+{
+	if (std::is_constant_evaluated())
+	{
+		//Pointers into different allocations can't be ordered during constant evaluation, so overlap is found by equality
+		for (U64 i = 1; i < count; ++i) { if (src + i == dst) { return true; } }
+		return false;
+	}
+
+	return dst > src && dst < src + count;
+}
+
+template<class Type>
+static constexpr inline Type* Copy(Type* dst, const Type* src, U64 count)
 {
 	if (dst == src) { return dst; }
 
-	if (dst > src && dst < src + count)
+	if (std::is_constant_evaluated())
+	{
+		if (OverlapsForward(dst, src, count)) { for (U64 i = count; i; --i) { dst[i - 1] = src[i - 1]; } }
+		else { for (U64 i = 0; i < count; ++i) { dst[i] = src[i]; } }
+
+		return dst;
+	}
+
+	if (OverlapsForward(dst, src, count))
 	{
 		return (Type*)memmove(dst, src, count * sizeof(Type));
 	}
@@ -12,12 +12,33 @@ template <class Type> concept FunctionPtr = std::is_function_v<Type>;
 
 //TODO: Allocate function that uses new or malloc based on if theres a constructor
 
+/// <summary>
+/// Allocates uninitialized storage for count values, std::allocator is used during constant evaluation where malloc isn't allowed
+/// </summary>
 template <class Type>
-inline Type* MoveValue(Type* dst, Type&& value) noexcept
+constexpr inline Type* AllocateValues(U64 count)
+{
+	if (std::is_constant_evaluated()) { return std::allocator<Type>{}.allocate(count); }
+
+	return (Type*)malloc(count * sizeof(Type));
+}
+
+/// <summary>
+/// Frees storage from AllocateValues, count must be the count it was allocated with
+/// </summary>
+template <class Type>
+constexpr inline void FreeValues(Type* values, U64 count)
+{
+	if (std::is_constant_evaluated()) { std::allocator<Type>{}.deallocate(values, count); }
+	else { free(values); }
+}
+
+template <class Type>
+constexpr inline Type* MoveValue(Type* dst, Type&& value) noexcept
 {
 	if constexpr (std::is_move_constructible_v<Type>)
 	{
-		new (dst) Type(std::move(value));
+		std::construct_at(dst, std::move(value));
 	}
 	else if constexpr (std::is_move_assignable_v<Type>)
 	{
@@ -33,11 +54,11 @@ inline Type* MoveValue(Type* dst, Type&& value) noexcept
 }
 
 template <class Type>
-inline Type* CopyValue(Type* dst, const Type& value) noexcept
+constexpr inline Type* CopyValue(Type* dst, const Type& value) noexcept
 {
 	if constexpr (std::is_copy_constructible_v<Type>)
 	{
-		new (dst) Type(value);
+		std::construct_at(dst, value);
 	}
 	else if constexpr (std::is_copy_assignable_v<Type>)
 	{
@@ -52,9 +73,9 @@ inline Type* CopyValue(Type* dst, const Type& value) noexcept
 }
 
 template <class Type>
-Type* MoveValues(Type* dst, Type* src, U64 count)
+constexpr Type* MoveValues(Type* dst, Type* src, U64 count)
 {
-	if (dst > src && dst < src + count) //Reverse Copy
+	if (OverlapsForward(dst, src, count)) //Reverse Copy
 	{
 		Type* rDst = dst + count - 1;
 		Type* rSrc = src + count - 1;
@@ -77,9 +98,9 @@ Type* MoveValues(Type* dst, Type* src, U64 count)
 }
 
 template <class Type>
-Type* CopyValues(Type* dst, Type* src, U64 count)
+constexpr Type* CopyValues(Type* dst, Type* src, U64 count)
 {
-	if (dst > src && dst < src + count) //Reverse Copy
+	if (OverlapsForward(dst, src, count)) //Reverse Copy
 	{
 		Type* rDst = dst + count - 1;
 		Type* rSrc = src + count - 1;
@@ -141,39 +162,39 @@ public:
 	/// <summary>
 	/// Creates a new Vector instance, size and capacity will be zero, array will be nullptr
 	/// </summary>
-	Vector();
+	constexpr Vector();
 
 	/// <summary>
 	/// Creates a new Vector instance, size will be zero, creates an array of size greater than or equal to sizeof(T) * capacity
 	/// </summary>
 	/// <param name="capacity:">The capacity the array will be at</param>
-	Vector(U64 capacity);
+	constexpr Vector(U64 capacity);
 
 	/// <summary>
 	/// Creates a new Vector instance, capacity will be greater than or equal to size, creates an array of size sizeof(T) * capacity and fills it with value
 	/// </summary>
 	/// <param name="size:">The size the array will be</param>
 	/// <param name="value:">The value that the array will be filled with</param>
-	Vector(U64 size, const Type& value);
+	constexpr Vector(U64 size, const Type& value);
 
 	/// <summary>
 	/// Create a new Vector instance using an initializer list, size will equal the list size, capacity with be greater than or equal to size, creates an array of size sizeof(T) * capacity and fills it with the values in list
 	/// </summary>
 	/// <param name="list:">The initializer list</param>
-	Vector(std::initializer_list<Type> list);
+	constexpr Vector(std::initializer_list<Type> list);
 
 	/// <summary>
 	/// Creates a new Vector instance, capacity and size will be other's, creates an array of the same size and copies other's data into it
 	/// </summary>
 	/// <param name="other:">Vector to copy</param>
-	Vector(const Vector& other);
+	constexpr Vector(const Vector& other);
 
 	/// <summary>
 	/// Creates a new Vector instance, capacity and size will be other's, sets the array to other's 
 	/// WARNING: other will be destroyed
 	/// </summary>
 	/// <param name="other:">The Vector to move</param>
-	Vector(Vector&& other) noexcept;
+	constexpr Vector(Vector&& other) noexcept;
 
 	/// <summary>
 	/// Copies other's data into this, capacity and size will be other's, creates an array of the same size and copies other's data into it
@@ -181,7 +202,7 @@ public:
 	/// </summary>
 	/// <param name="other:">The Vector to copy</param>
 	/// <returns>Reference to this</returns>
-	Vector& operator=(const Vector& other);
+	constexpr Vector& operator=(const Vector& other);
 
 	/// <summary>
 	/// Moves other's data into this, capacity and size will be other's, sets the array to other's 
@@ -190,16 +211,16 @@ public:
 	/// </summary>
 	/// <param name="other:">The Vector to move</param>
 	/// <returns>Reference to this</returns>
-	Vector& operator=(Vector&& other) noexcept;
+	constexpr Vector& operator=(Vector&& other) noexcept;
 
 
 
-	~Vector();
+	constexpr ~Vector();
 
 	/// <summary>
 	/// Destroys data inside this, capacity and size will be zero, array will be nullptr
 	/// </summary>
-	void Destroy();
+	constexpr void Destroy();
 
 
 
@@ -207,24 +228,24 @@ public:
 	/// Increases size by one and puts value onto the back of array, reallocates array if it's too small
 	/// </summary>
 	/// <param name="value:">The value to put into array</param>
-	Type& Push(const Type& value);
+	constexpr Type& Push(const Type& value);
 
 	/// <summary>
 	/// Increases size by one and moves value onto the back of array, reallocates array if it's too small
 	/// </summary>
 	/// <param name="value:">The value to move into array</param>
-	Type& Push(Type&& value) noexcept;
+	constexpr Type& Push(Type&& value) noexcept;
 
 	/// <summary>
 	/// Decreases the size by one
 	/// </summary>
-	void Pop();
+	constexpr void Pop();
 
 	/// <summary>
 	/// Decreases the size by one and copies what was in the back of array to value
 	/// </summary>
 	/// <param name="value:">The value to copy to</param>
-	void Pop(Type& value);
+	constexpr void Pop(Type& value);
 
 	/// <summary>
 	/// Inserts value into index, moves values at and past index over, reallocates array if it's too small
@@ -232,7 +253,7 @@ public:
 	/// <param name="index:">The index to put value</param>
 	/// <param name="value:">The value to copy</param>
 	/// <returns>Reference to the inserted value</returns>
-	Type& Insert(U64 index, const Type& value);
+	constexpr Type& Insert(U64 index, const Type& value);
 
 	/// <summary>
 	/// Inserts value into index, moves values at and past index over, reallocates array if it's too small
@@ -240,14 +261,14 @@ public:
 	/// <param name="index:">The index to put value</param>
 	/// <param name="value:">The value to move</param>
 	/// <returns>Reference to the inserted value</returns>
-	Type& Insert(U64 index, Type&& value) noexcept;
+	constexpr Type& Insert(U64 index, Type&& value) noexcept;
 
 	/// <summary>
 	/// Copies other and inserts it into index, moves values at and past index over, reallocates array if it's too small
 	/// </summary>
 	/// <param name="index:">The index to copy other into</param>
 	/// <param name="other:">The Vector to copy</param>
-	void Insert(U64 index, const Vector& other);
+	constexpr void Insert(U64 index, const Vector& other);
 
 	/// <summary>
 	/// Moves other and inserts it into index, moves values at and past index over, reallocates array if it's too small
@@ -255,40 +276,40 @@ public:
 	/// </summary>
 	/// <param name="index:">The index to move other into</param>
 	/// <param name="other:">The Vector to move</param>
-	void Insert(U64 index, Vector&& other) noexcept;
+	constexpr void Insert(U64 index, Vector&& other) noexcept;
 
 	/// <summary>
 	/// Moves values past index to index
 	/// </summary>
 	/// <param name="index:">The index to remove</param>
-	void Remove(U64 index);
+	constexpr void Remove(U64 index);
 
 	/// <summary>
 	/// Copies value at index into value, moves values past index to index
 	/// </summary>
 	/// <param name="index:">The index to remove</param>
 	/// <param name="value:">The value to copy to</param>
-	void Remove(U64 index, Type& value);
+	constexpr void Remove(U64 index, Type& value);
 
 	/// <summary>
 	/// Removes the value at index by swaping it with the last index
 	/// </summary>
 	/// <param name="index:">The index to remove</param>
-	void RemoveSwap(U64 index);
+	constexpr void RemoveSwap(U64 index);
 
 	/// <summary>
 	/// Copies value at index into value, removes the value at index by swaping it with the last index
 	/// </summary>
 	/// <param name="index:">The index to remove</param>
 	/// <param name="value:">The value to copy to</param>
-	void RemoveSwap(U64 index, Type& value);
+	constexpr void RemoveSwap(U64 index, Type& value);
 
 	/// <summary>
 	/// Moves values at and past index1 to index0
 	/// </summary>
 	/// <param name="index0:">The beginning of the erasure, inclusive</param>
 	/// <param name="index1:">The end of the erasure, exclusive</param>
-	void Erase(U64 index0, U64 index1);
+	constexpr void Erase(U64 index0, U64 index1);
 
 	/// <summary>
 	/// Copies values to be erased into other, moves values at and past index1 to index0
@@ -297,7 +318,7 @@ public:
 	/// <param name="index0:">The beginning of the erasure, inclusive</param>
 	/// <param name="index1:">The end of the erasure, exclusive</param>
 	/// <param name="other:">The Vector to copy to</param>
-	void Steal(U64 index0, U64 index1, Vector& other);
+	constexpr void Steal(U64 index0, U64 index1, Vector& other);
 
 
 
@@ -307,27 +328,27 @@ public:
 	/// </summary>
 	/// <param name="index:">The index to split on, inclusive</param>
 	/// <param name="other:">The Vector to copy to</param>
-	void Split(U64 index, Vector& other);
+	constexpr void Split(U64 index, Vector& other);
 
 	/// <summary>
 	/// Copies data in other to the end of the array, reallocates the array if it's too small
 	/// </summary>
 	/// <param name="other:">The Vector to copy from</param>
-	void Merge(const Vector& other);
+	constexpr void Merge(const Vector& other);
 
 	/// <summary>
 	/// Moves data in other to the end of the array, reallocates the array if it's too small
 	/// WARNING: other will be destroyed
 	/// </summary>
 	/// <param name="other:">The Vector to move</param>
-	void Merge(Vector&& other) noexcept;
+	constexpr void Merge(Vector&& other) noexcept;
 
 	/// <summary>
 	/// Copies data in other to the end of the array, reallocates the array if it's too small
 	/// </summary>
 	/// <param name="other:">The Vector to copy from</param>
 	/// <returns>Reference to this</returns>
-	Vector& operator+=(const Vector& other);
+	constexpr Vector& operator+=(const Vector& other);
 
 	/// <summary>
 	/// Moves data in other to the end of the array, reallocates the array if it's too small
@@ -335,7 +356,7 @@ public:
 	/// </summary>
 	/// <param name="other:">The Vector to move</param>
 	/// <returns>Reference to this</returns>
-	Vector& operator+=(Vector&& other) noexcept;
+	constexpr Vector& operator+=(Vector&& other) noexcept;
 
 
 
@@ -345,7 +366,7 @@ public:
 	/// </summary>
 	/// <param name="predicate:">A function to evaluate values: bool pred(const Type&amp; value)</param>
 	/// <param name="other:">A Vector to fill with values</param>
-	void SearchFor(Predicate predicate, Vector& other);
+	constexpr void SearchFor(Predicate predicate, Vector& other);
 
 	/// <summary>
 	/// Searches array, finds indices of all values that satisfy predicate, fill other with those indices
@@ -353,21 +374,21 @@ public:
 	/// </summary>
 	/// <param name="predicate:">A function to evaluate values: bool pred(const Type&amp; value)</param>
 	/// <param name="other:">A Vector to fill with indices</param>
-	void SearchForIndices(Predicate predicate, Vector<U64>& other);
+	constexpr void SearchForIndices(Predicate predicate, Vector<U64>& other);
 
 	/// <summary>
 	/// Searches array, finds all values that satisfy predicate
 	/// </summary>
 	/// <param name="predicate:">A function to evaluate values: bool pred(const Type&amp; value)</param>
 	/// <returns>The count of values that satisfy predicate</returns>
-	U64 SearchCount(Predicate predicate);
+	constexpr U64 SearchCount(Predicate predicate);
 
 	/// <summary>
 	/// Searches array, finds all values that satisfy predicate, removes them from array
 	/// </summary>
 	/// <param name="predicate:">A function to evaluate values: bool pred(const Type&amp; value)</param>
 	/// <returns>The count of values that satisfy predicate</returns>
-	U64 RemoveAll(Predicate predicate);
+	constexpr U64 RemoveAll(Predicate predicate);
 
 	/// <summary>
 	/// Searches array, finds all values that satisfy predicate, removes them from array and puts them into other
@@ -375,14 +396,14 @@ public:
 	/// </summary>
 	/// <param name="predicate:">A function to evaluate values: bool pred(const Type&amp; value)</param>
 	/// <param name="other:">A Vector to fill with values</param>
-	void RemoveAll(Predicate predicate, Vector& other);
+	constexpr void RemoveAll(Predicate predicate, Vector& other);
 
 	/// <summary>
 	/// Searches array, finds all values that satisfy predicate, removes them from array by overriding with current last element
 	/// </summary>
 	/// <param name="predicate:">A function to evaluate values: bool pred(const Type&amp; value)</param>
 	/// <returns>The count of values that satisfy predicate</returns>
-	U64 RemoveSwapAll(Predicate predicate);
+	constexpr U64 RemoveSwapAll(Predicate predicate);
 
 	/// <summary>
 	/// Searches array, finds all values that satisfy predicate, removes them from array by overriding with current last element and puts them into other
@@ -390,7 +411,7 @@ public:
 	/// </summary>
 	/// <param name="predicate:">A function to evaluate values: bool pred(const Type&amp; value)</param>
 	/// <param name="other:">A Vector to fill with values</param>
-	void RemoveSwapAll(Predicate predicate, Vector& other);
+	constexpr void RemoveSwapAll(Predicate predicate, Vector& other);
 
 	/// <summary>
 	/// Finds the first value that satisfies the predicate, return true if one exists
@@ -398,7 +419,7 @@ public:
 	/// <param name="predicate:">A function to evaluate values: bool pred(const Type&amp; value)</param>
 	/// <param name="value:">A reference to return the found value</param>
 	/// <returns>true if a value exists, false otherwise</returns>
-	Type* Find(Predicate predicate);
+	constexpr Type* Find(Predicate predicate);
 
 
 
@@ -408,7 +429,7 @@ public:
 	/// <param name="predicate:">A function to compare values: bool pred(const Type&amp; a, const Type&amp; b)</param>
 	/// <param name="value:">The value to insert</param>
 	/// <returns>The index the value was inserted at</returns>
-	U64 SortedInsert(Compare predicate, const Type& value);
+	constexpr U64 SortedInsert(Compare predicate, const Type& value);
 
 	/// <summary>
 	/// Inserts a value based on a predicate
@@ -416,7 +437,7 @@ public:
 	/// <param name="predicate:">A function to compare values: bool pred(const Type&amp; a, const Type&amp; b)</param>
 	/// <param name="value:">The value to insert</param>
 	/// <returns>The index the value was inserted at</returns>
-	U64 SortedInsert(Compare predicate, Type&& value) noexcept;
+	constexpr U64 SortedInsert(Compare predicate, Type&& value) noexcept;
 
 
 
@@ -424,25 +445,25 @@ public:
 	/// Reallocates the array to be sizeof(T) * capacity
 	/// </summary>
 	/// <param name="capacity:">The capacity the array will be at</param>
-	void Reserve(U64 capacity);
+	constexpr void Reserve(U64 capacity);
 
 	/// <summary>
 	/// Sets size, reallocates the array if it's too small
 	/// </summary>
 	/// <param name="size:">The size to set to</param>
-	void Resize(U64 size);
+	constexpr void Resize(U64 size);
 
 	/// <summary>
 	/// Sets size, fills the array with value, reallocates the array if it's too small
 	/// </summary>
 	/// <param name="size:">The size to set to</param>
 	/// <param name="value:">The value to fill the array with</param>
-	void Resize(U64 size, const Type& value);
+	constexpr void Resize(U64 size, const Type& value);
 
 	/// <summary>
 	/// Sets size to zero
 	/// </summary>
-	void Clear() { size = 0; }
+	constexpr void Clear() { size = 0; }
 
 
 
@@ -451,79 +472,79 @@ public:
 	/// </summary>
 	/// <param name="value:">The value to search for</param>
 	/// <returns>true if value is contained within array, false otherwise</returns>
-	bool Contains(const Type& value) const;
+	constexpr bool Contains(const Type& value) const;
 
 	/// <summary>
 	/// Counts the reoccurrences of value in array
 	/// </summary>
 	/// <param name="value:">The value to search for</param>
 	/// <returns>The number of reoccurrences of value</returns>
-	U64 Count(const Type& value) const;
+	constexpr U64 Count(const Type& value) const;
 
 	/// <summary>
 	/// Finds the first index of value
 	/// </summary>
 	/// <param name="value:">The value to search for</param>
 	/// <returns>The index of value, if it doesn't find value, U64_MAX</returns>
-	U64 Find(const Type& value) const;
+	constexpr U64 Find(const Type& value) const;
 
 
 
 	/// <returns>The current amount of elements</returns>
-	U64 Size() const { return size; }
+	constexpr U64 Size() const { return size; }
 
 	/// <returns>The current maximum allowed elements</returns>
-	U64 Capacity() const { return capacity; }
+	constexpr U64 Capacity() const { return capacity; }
 
 	/// <returns>Whether or not this is empty</returns>
-	bool Empty() const { return size == 0; }
+	constexpr bool Empty() const { return size == 0; }
 
 	/// <returns>Whether or not this is full</returns>
-	bool Full() const { return size == capacity; }
+	constexpr bool Full() const { return size == capacity; }
 
 	/// <summary></summary>
 	/// <returns>array (const)</returns>
-	const Type* Data() const { return array; }
+	constexpr const Type* Data() const { return array; }
 
 	/// <summary></summary>
 	/// <returns>array</returns>
-	Type* Data() { return array; }
+	constexpr Type* Data() { return array; }
 
 
 
 	/// <summary></summary>
 	/// <param name="i:">Index</param>
 	/// <returns>The value at index (const)</returns>
-	const Type& operator[](U64 i) const { return array[i]; }
+	constexpr const Type& operator[](U64 i) const { return array[i]; }
 
 	/// <summary></summary>
 	/// <param name="i:">Index</param>
 	/// <returns>The value at index</returns>
-	Type& operator[](U64 i) { return array[i]; }
+	constexpr Type& operator[](U64 i) { return array[i]; }
 
 	/// <summary>
 	/// Gets the value at the front of array (index 0)
 	/// </summary>
 	/// <returns>The value at the front of array</returns>
-	Type& Front() { return *array; }
+	constexpr Type& Front() { return *array; }
 
 	/// <summary>
 	/// Gets the value at the front of array (index 0)
 	/// </summary>
 	/// <returns>The value at the front of array (const)</returns>
-	const Type& Front() const { return *array; }
+	constexpr const Type& Front() const { return *array; }
 
 	/// <summary>
 	/// Gets the value at the back of array (index size - 1)
 	/// </summary>
 	/// <returns>The value at the back of array</returns>
-	Type& Back() { return array[size - 1]; }
+	constexpr Type& Back() { return array[size - 1]; }
 
 	/// <summary>
 	/// Gets the value at the back of array (index size - 1)
 	/// </summary>
 	/// <returns>The value at the back of array (const)</returns>
-	const Type& Back() const { return array[size - 1]; }
+	constexpr const Type& Back() const { return array[size - 1]; }
 
 
 
@@ -532,32 +553,32 @@ public:
 	/// </summary>
 	/// <param name="other: ">The other vector to compare against</param>
 	/// <returns>True if the two vectors have the same values</returns>
-	bool operator==(const Vector& other) const;
+	constexpr bool operator==(const Vector& other) const;
 
 	/// <summary>
 	/// Compares the values stored in both vectors
 	/// </summary>
 	/// <param name="other: ">The other vector to compare against</param>
 	/// <returns>True if the two vectors have different values</returns>
-	bool operator!=(const Vector& other) const;
+	constexpr bool operator!=(const Vector& other) const;
 
 
 
 	/// <summary></summary>
 	/// <returns>The beginning of array as an iterator</returns>
-	Type* begin() { return array; }
+	constexpr Type* begin() { return array; }
 
 	/// <summary></summary>
 	/// <returns>The end of array as an iterator</returns>
-	Type* end() { return array + size; }
+	constexpr Type* end() { return array + size; }
 
 	/// <summary></summary>
 	/// <returns>The beginning of array as an iterator (const)</returns>
-	const Type* begin() const { return array; }
+	constexpr const Type* begin() const { return array; }
 
 	/// <summary></summary>
 	/// <returns>The end of array as an iterator (const)</returns>
-	const Type* end() const { return array + size; }
+	constexpr const Type* end() const { return array + size; }
 
 private:
 	U64 size{ 0 };
@@ -566,13 +587,13 @@ private:
 };
 
 template<class Type> 
-inline Vector<Type>::Vector() {}
+constexpr inline Vector<Type>::Vector() {}
 
 template<class Type> 
-inline Vector<Type>::Vector(U64 capacity) : capacity(capacity), array((Type*)malloc(capacity * sizeof(Type))) {}
+constexpr inline Vector<Type>::Vector(U64 capacity) : capacity(capacity), array(AllocateValues<Type>(capacity)) {}
 
 template<class Type> 
-inline Vector<Type>::Vector(U64 size, const Type& value) : size(size), capacity(size), array((Type*)malloc(capacity * sizeof(Type)))
+constexpr inline Vector<Type>::Vector(U64 size, const Type& value) : size(size), capacity(size), array(AllocateValues<Type>(capacity))
 {
 	for (Type* it = array, *end = array + size; it != end; ++it) { CopyValue(it, value); }
 }
@@ -581,7 +602,7 @@ template <class Type>
 using Initializer = std::initializer_list<Type>;
 
 template<class Type> 
-inline Vector<Type>::Vector(std::initializer_list<Type> list) : size(list.size()), capacity(size), array((Type*)malloc(capacity * sizeof(Type)))
+constexpr inline Vector<Type>::Vector(std::initializer_list<Type> list) : size(list.size()), capacity(size), array(AllocateValues<Type>(capacity))
 {
 	Type* it1 = array;
 	for (const Type* it0 = list.begin(), *end = list.end(); it0 != end; ++it0, ++it1)
@@ -591,13 +612,13 @@ inline Vector<Type>::Vector(std::initializer_list<Type> list) : size(list.size()
 }
 
 template<class Type> 
-inline Vector<Type>::Vector(const Vector<Type>& other) : size(other.size), capacity(other.size), array((Type*)malloc(capacity * sizeof(Type)))
+constexpr inline Vector<Type>::Vector(const Vector<Type>& other) : size(other.size), capacity(other.size), array(AllocateValues<Type>(capacity))
 {
-	MoveValues(array, other.array, size);
+	CopyValues(array, other.array, size);
 }
 
 template<class Type> 
-inline Vector<Type>::Vector(Vector<Type>&& other) noexcept : size(other.size), capacity(other.capacity), array(other.array)
+constexpr inline Vector<Type>::Vector(Vector<Type>&& other) noexcept : size(other.size), capacity(other.capacity), array(other.array)
 {
 	other.size = 0;
 	other.capacity = 0;
@@ -605,21 +626,23 @@ inline Vector<Type>::Vector(Vector<Type>&& other) noexcept : size(other.size), c
 }
 
 template<class Type> 
-inline Vector<Type>& Vector<Type>::operator=(const Vector<Type>& other)
+constexpr inline Vector<Type>& Vector<Type>::operator=(const Vector<Type>& other)
 {
+	if (&other == this) { return *this; }
+
 	Destroy();
 
 	size = other.size;
 	capacity = size;
-	array = (Type*)malloc(capacity * sizeof(Type));
+	array = AllocateValues<Type>(capacity);
 
-	MoveValues(array, other.array, size);
+	CopyValues(array, other.array, size);
 
 	return *this;
 }
 
 template<class Type> 
-inline Vector<Type>& Vector<Type>::operator=(Vector<Type>&& other) noexcept
+constexpr inline Vector<Type>& Vector<Type>::operator=(Vector<Type>&& other) noexcept
 {
 	Destroy();
 
@@ -635,48 +658,48 @@ inline Vector<Type>& Vector<Type>::operator=(Vector<Type>&& other) noexcept
 }
 
 template<class Type> 
-inline Vector<Type>::~Vector() { Destroy(); }
+constexpr inline Vector<Type>::~Vector() { Destroy(); }
 
 template<class Type> 
-inline void Vector<Type>::Destroy()
+constexpr inline void Vector<Type>::Destroy()
 {
 	if constexpr (std::is_destructible_v<Type>)
 	{
 		for (Type* it = array, *end = array + size; it != end; ++it) { it->~Type(); }
 	}
 
-	if(array) { free(array); array = nullptr; }
+	if (array) { FreeValues(array, capacity); array = nullptr; }
 
 	size = 0;
 	capacity = 0;
 }
 
 template<class Type> 
-inline Type& Vector<Type>::Push(const Type& value)
+constexpr inline Type& Vector<Type>::Push(const Type& value)
 {
 	if (size == capacity) { Reserve((capacity + 1) * 2); }
 
 	return *CopyValue(array + size++, value);
 }
 
-template<class Type> inline Type& Vector<Type>::Push(Type&& value) noexcept
+template<class Type> constexpr inline Type& Vector<Type>::Push(Type&& value) noexcept
 {
 	if (size == capacity) { Reserve((capacity + 1) * 2); }
 
 	return *MoveValue(array + size++, std::move(value));
 }
 
-template<class Type> inline void Vector<Type>::Pop()
+template<class Type> constexpr inline void Vector<Type>::Pop()
 {
 	if (size)
 	{
-		if constexpr (std::is_destructible_v<Type>) { (array + size)->~Type(); }
-
 		--size;
+
+		if constexpr (std::is_destructible_v<Type>) { (array + size)->~Type(); }
 	}
 }
 
-template<class Type> inline void Vector<Type>::Pop(Type& value)
+template<class Type> constexpr inline void Vector<Type>::Pop(Type& value)
 {
 	if (size)
 	{
@@ -685,7 +708,7 @@ template<class Type> inline void Vector<Type>::Pop(Type& value)
 }
 
 template<class Type>
-inline Type& Vector<Type>::Insert(U64 index, const Type& value)
+constexpr inline Type& Vector<Type>::Insert(U64 index, const Type& value)
 {
 	if (size == capacity) { Reserve((capacity + 1) * 2); }
 
@@ -695,7 +718,7 @@ inline Type& Vector<Type>::Insert(U64 index, const Type& value)
 }
 
 template<class Type>
-inline Type& Vector<Type>::Insert(U64 index, Type&& value) noexcept
+constexpr inline Type& Vector<Type>::Insert(U64 index, Type&& value) noexcept
 {
 	if (size == capacity) { Reserve((capacity + 1) * 2); }
 
@@ -705,7 +728,7 @@ inline Type& Vector<Type>::Insert(U64 index, Type&& value) noexcept
 }
 
 template<class Type>
-inline void Vector<Type>::Insert(U64 index, const Vector<Type>& other)
+constexpr inline void Vector<Type>::Insert(U64 index, const Vector<Type>& other)
 {
 	if (size + other.size > capacity) { Reserve(size + other.size); }
 
@@ -716,7 +739,7 @@ inline void Vector<Type>::Insert(U64 index, const Vector<Type>& other)
 }
 
 template<class Type>
-inline void Vector<Type>::Insert(U64 index, Vector<Type>&& other) noexcept
+constexpr inline void Vector<Type>::Insert(U64 index, Vector<Type>&& other) noexcept
 {
 	if (size + other.size > capacity) { Reserve(size + other.size); }
 
@@ -727,35 +750,35 @@ inline void Vector<Type>::Insert(U64 index, Vector<Type>&& other) noexcept
 	other.Destroy();
 }
 
-template<class Type> inline void Vector<Type>::Remove(U64 index)
+template<class Type> constexpr inline void Vector<Type>::Remove(U64 index)
 {
 	if constexpr (std::is_destructible_v<Type>) { (array + index)->~Type(); }
-	MoveValues(array + index, array + index + 1, (size - index));
+	if (index + 1 < size) { MoveValues(array + index, array + index + 1, size - index - 1); }
 
 	--size;
 }
 
-template<class Type> inline void Vector<Type>::Remove(U64 index, Type& value)
+template<class Type> constexpr inline void Vector<Type>::Remove(U64 index, Type& value)
 {
 	MoveValue(&value, std::move(array[index]));
-	MoveValues(array + index, array + index + 1, (size - index));
+	if (index + 1 < size) { MoveValues(array + index, array + index + 1, size - index - 1); }
 
 	--size;
 }
 
-template<class Type> inline void Vector<Type>::RemoveSwap(U64 index)
+template<class Type> constexpr inline void Vector<Type>::RemoveSwap(U64 index)
 {
 	if constexpr (std::is_destructible_v<Type>) { (array + index)->~Type(); }
 	MoveValue(array + index, std::move(array[--size]));
 }
 
-template<class Type> inline void Vector<Type>::RemoveSwap(U64 index, Type& value)
+template<class Type> constexpr inline void Vector<Type>::RemoveSwap(U64 index, Type& value)
 {
 	MoveValue(value, std::move(array[index]));
 	MoveValue(array + index, std::move(array[--size]));
 }
 
-template<class Type> inline void Vector<Type>::Erase(U64 index0, U64 index1)
+template<class Type> constexpr inline void Vector<Type>::Erase(U64 index0, U64 index1)
 {
 	if (index0 >= index1) { return; }
 
@@ -769,7 +792,7 @@ template<class Type> inline void Vector<Type>::Erase(U64 index0, U64 index1)
 	size -= index1 - index0;
 }
 
-template<class Type> inline void Vector<Type>::Steal(U64 index0, U64 index1, Vector<Type>& other)
+template<class Type> constexpr inline void Vector<Type>::Steal(U64 index0, U64 index1, Vector<Type>& other)
 {
 	if (index0 >= index1) { return; }
 
@@ -783,7 +806,7 @@ template<class Type> inline void Vector<Type>::Steal(U64 index0, U64 index1, Vec
 	size -= stealSize;
 }
 
-template<class Type> inline void Vector<Type>::Split(U64 index, Vector<Type>& other)
+template<class Type> constexpr inline void Vector<Type>::Split(U64 index, Vector<Type>& other)
 {
 	other.Destroy();
 	other.Reserve(size - index);
@@ -794,7 +817,7 @@ template<class Type> inline void Vector<Type>::Split(U64 index, Vector<Type>& ot
 	size -= index;
 }
 
-template<class Type> inline void Vector<Type>::Merge(const Vector<Type>& other)
+template<class Type> constexpr inline void Vector<Type>::Merge(const Vector<Type>& other)
 {
 	if (size + other.size > capacity) { Reserve(size + other.size); }
 
@@ -802,7 +825,7 @@ template<class Type> inline void Vector<Type>::Merge(const Vector<Type>& other)
 	size += other.size;
 }
 
-template<class Type> inline void Vector<Type>::Merge(Vector<Type>&& other) noexcept
+template<class Type> constexpr inline void Vector<Type>::Merge(Vector<Type>&& other) noexcept
 {
 	if (size + other.size > capacity) { Reserve(size + other.size); }
 
@@ -812,7 +835,7 @@ template<class Type> inline void Vector<Type>::Merge(Vector<Type>&& other) noexc
 	other.Destroy();
 }
 
-template<class Type> inline Vector<Type>& Vector<Type>::operator+=(const Vector<Type>& other)
+template<class Type> constexpr inline Vector<Type>& Vector<Type>::operator+=(const Vector<Type>& other)
 {
 	if (size + other.size > capacity) { Reserve(size + other.size); }
 
@@ -822,7 +845,7 @@ template<class Type> inline Vector<Type>& Vector<Type>::operator+=(const Vector<
 	return *this;
 }
 
-template<class Type> inline Vector<Type>& Vector<Type>::operator+=(Vector<Type>&& other) noexcept
+template<class Type> constexpr inline Vector<Type>& Vector<Type>::operator+=(Vector<Type>&& other) noexcept
 {
 	if (size + other.size > capacity) { Reserve(size + other.size); }
 
@@ -835,7 +858,7 @@ template<class Type> inline Vector<Type>& Vector<Type>::operator+=(Vector<Type>&
 }
 
 template<class Type>
-inline void Vector<Type>::SearchFor(Predicate predicate, Vector<Type>& other)
+constexpr inline void Vector<Type>::SearchFor(Predicate predicate, Vector<Type>& other)
 {
 	other.Reserve(size);
 	other.size = 0;
@@ -847,7 +870,7 @@ inline void Vector<Type>::SearchFor(Predicate predicate, Vector<Type>& other)
 }
 
 template<class Type>
-inline void Vector<Type>::SearchForIndices(Predicate predicate, Vector<U64>& other)
+constexpr inline void Vector<Type>::SearchForIndices(Predicate predicate, Vector<U64>& other)
 {
 	other.Reserve(size);
 	other.size = 0;
@@ -860,7 +883,7 @@ inline void Vector<Type>::SearchForIndices(Predicate predicate, Vector<U64>& oth
 }
 
 template<class Type>
-inline U64 Vector<Type>::SearchCount(Predicate predicate)
+constexpr inline U64 Vector<Type>::SearchCount(Predicate predicate)
 {
 	U64 i = 0;
 	for (Type* t = array, *end = array + size; t != end; ++t)
@@ -872,7 +895,7 @@ inline U64 Vector<Type>::SearchCount(Predicate predicate)
 }
 
 template<class Type>
-inline U64 Vector<Type>::RemoveAll(Predicate predicate)
+constexpr inline U64 Vector<Type>::RemoveAll(Predicate predicate)
 {
 	U64 i = 0;
 	U64 count = 0;
@@ -886,7 +909,7 @@ inline U64 Vector<Type>::RemoveAll(Predicate predicate)
 }
 
 template<class Type>
-inline void Vector<Type>::RemoveAll(Predicate predicate, Vector<Type>& other)
+constexpr inline void Vector<Type>::RemoveAll(Predicate predicate, Vector<Type>& other)
 {
 	other.Reserve(size);
 	other.size = 0;
@@ -907,7 +930,7 @@ inline void Vector<Type>::RemoveAll(Predicate predicate, Vector<Type>& other)
 }
 
 template<class Type>
-inline U64 Vector<Type>::RemoveSwapAll(Predicate predicate)
+constexpr inline U64 Vector<Type>::RemoveSwapAll(Predicate predicate)
 {
 	U64 i = 0;
 	U64 count = 0;
@@ -921,7 +944,7 @@ inline U64 Vector<Type>::RemoveSwapAll(Predicate predicate)
 }
 
 template<class Type>
-inline void Vector<Type>::RemoveSwapAll(Predicate predicate, Vector<Type>& other)
+constexpr inline void Vector<Type>::RemoveSwapAll(Predicate predicate, Vector<Type>& other)
 {
 	other.Reserve(size);
 	other.size = 0;
@@ -942,7 +965,7 @@ inline void Vector<Type>::RemoveSwapAll(Predicate predicate, Vector<Type>& other
 }
 
 template<class Type>
-inline Type* Vector<Type>::Find(Predicate predicate)
+constexpr inline Type* Vector<Type>::Find(Predicate predicate)
 {
 	for (Type* t = array, *end = array + size; t != end; ++t)
 	{
@@ -953,7 +976,7 @@ inline Type* Vector<Type>::Find(Predicate predicate)
 }
 
 template<class Type>
-U64 Vector<Type>::SortedInsert(Compare predicate, const Type& value)
+constexpr U64 Vector<Type>::SortedInsert(Compare predicate, const Type& value)
 {
 	U64 i = 0;
 	for (Type* t = array, *end = array + size; t != end; ++t, ++i)
@@ -974,7 +997,7 @@ U64 Vector<Type>::SortedInsert(Compare predicate, const Type& value)
 }
 
 template<class Type>
-U64 Vector<Type>::SortedInsert(Compare predicate, Type&& value) noexcept
+constexpr U64 Vector<Type>::SortedInsert(Compare predicate, Type&& value) noexcept
 {
 	U64 i = 0;
 	for (Type* t = array, *end = array + size; t != end; ++t, ++i)
@@ -995,33 +1018,49 @@ U64 Vector<Type>::SortedInsert(Compare predicate, Type&& value) noexcept
 }
 
 template<class Type>
-inline void Vector<Type>::Reserve(U64 capacity)
+constexpr inline void Vector<Type>::Reserve(U64 capacity)
 {
-	if constexpr (std::is_destructible_v<Type>)
+	//Only instantiated for trivially copyable types, realloc would skip the moves and destructors anything else needs
+	if constexpr (std::is_trivially_copyable_v<Type>)
 	{
-		Type* temp = (Type*)malloc(capacity * sizeof(Type));
-		MoveValues(temp, array, size);
-		free(array);
-		array = temp;
+		if (!std::is_constant_evaluated())
+		{
+			array = (Type*)realloc(array, capacity * sizeof(Type));
+			this->capacity = capacity;
+			return;
+		}
 	}
-	else
+
+	Type* temp = AllocateValues<Type>(capacity);
+	MoveValues(temp, array, size);
+
+	if constexpr (std::is_destructible_v<Type>)
 	{
-		realloc(array, capacity);
+		for (Type* it = array, *end = array + size; it != end; ++it) { it->~Type(); }
 	}
 
+	if (array) { FreeValues(array, this->capacity); }
+	array = temp;
+
 	this->capacity = capacity;
 }
 
 template<class Type>
-inline void Vector<Type>::Resize(U64 size)
+constexpr inline void Vector<Type>::Resize(U64 size)
 {
 	if (size > capacity) { Reserve(size); }
 
+	//During constant evaluation values must be alive before they can be assigned
+	if constexpr (std::is_default_constructible_v<Type>)
+	{
+		if (std::is_constant_evaluated()) { for (U64 i = this->size; i < size; ++i) { std::construct_at(array + i); } }
+	}
+
 	this->size = size;
 }
 
 template<class Type>
-inline void Vector<Type>::Resize(U64 size, const Type& value)
+constexpr inline void Vector<Type>::Resize(U64 size, const Type& value)
 {
 	if (size > capacity) { Reserve(size); }
 	this->size = size;
@@ -1030,7 +1069,7 @@ inline void Vector<Type>::Resize(U64 size, const Type& value)
 }
 
 template<class Type>
-inline bool Vector<Type>::Contains(const Type& value) const
+constexpr inline bool Vector<Type>::Contains(const Type& value) const
 {
 	for (Type* t = array, *end = array + size; t != end; ++t)
 	{
@@ -1041,7 +1080,7 @@ inline bool Vector<Type>::Contains(const Type& value) const
 }
 
 template<class Type>
-inline U64 Vector<Type>::Count(const Type& value) const
+constexpr inline U64 Vector<Type>::Count(const Type& value) const
 {
 	U64 count = 0;
 	for (Type* t = array, *end = array + size; t != end; ++t)
@@ -1053,7 +1092,7 @@ inline U64 Vector<Type>::Count(const Type& value) const
 }
 
 template<class Type>
-inline U64 Vector<Type>::Find(const Type& value) const
+constexpr inline U64 Vector<Type>::Find(const Type& value) const
 {
 	U64 index = 0;
 	for (Type* t = array; index < size; ++index, ++t)
@@ -1065,26 +1104,26 @@ inline U64 Vector<Type>::Find(const Type& value) const
 }
 
 template<class Type>
-inline bool Vector<Type>::operator==(const Vector& other) const
+constexpr inline bool Vector<Type>::operator==(const Vector& other) const
 {
 	if (size != other.size) { return false; }
 
 	for (Type* it0 = array, *it1 = other.array, *end = array + size; it0 != end; ++it0, ++it1)
 	{
-		if (*it0 != *it0) { return false; }
+		if (*it0 != *it1) { return false; }
 	}
 
 	return true;
 }
 
 template<class Type>
-inline bool Vector<Type>::operator!=(const Vector& other) const
+constexpr inline bool Vector<Type>::operator!=(const Vector& other) const
 {
 	if (size != other.size) { return true; }
 
 	for (Type* it0 = array, *it1 = other.array, *end = array + size; it0 != end; ++it0, ++it1)
 	{
-		if (*it0 != *it0) { return true; }
+		if (*it0 != *it1) { return true; }
 	}
 
 	return false;
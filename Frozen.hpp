@@ -0,0 +1,44 @@
+#pragma once
+
+#include "ContainerDefines.hpp"
+#include "String.hpp"
+
+#include <type_traits>
+
+/// <summary>
+/// Fixed array of values stored inline, made by Freeze so a table built during compilation is baked into the binary as read-only data
+/// Arrays of characters keep a NUL terminator past the last value so they can be passed on as C strings
+/// </summary>
+template<class Type, U64 Count>
+struct Frozen
+{
+	constexpr U64 Size() const { return Count; }
+	constexpr const Type* Data() const { return values; }
+	constexpr const Type& operator[](U64 i) const { return values[i]; }
+
+	constexpr const Type* begin() const { return values; }
+	constexpr const Type* end() const { return values + Count; }
+
+	template<Character C = Type> requires std::is_same_v<C, Type>
+	constexpr operator StringViewBase<C>() const { return { values, Count }; }
+
+	Type values[Count + (IsCharacter<Type> || Count == 0)]{};
+};
+
+/// <summary>
+/// Calls Builder during compilation and copies the container it returns, a Vector, StringBase or anything with Size and Data, into a Frozen
+/// The container's allocation is freed before compilation ends, only the copied values remain, use as: static constexpr auto table = Freeze&lt;Build&gt;();
+/// </summary>
+template<auto Builder>
+consteval auto Freeze()
+{
+	using Type = std::remove_cvref_t<decltype(*Builder().Data())>;
+	constexpr U64 count = Builder().Size();
+
+	Frozen<Type, count> frozen{};
+
+	auto container = Builder();
+	for (U64 i = 0; i < count; ++i) { frozen.values[i] = container.Data()[i]; }
+
+	return frozen;
+}
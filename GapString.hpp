@@ -0,0 +1,291 @@
+#pragma once
+
+#include "String.hpp"
+
+/// <summary>
+/// Gap buffer string, text before the cursor sits at the start of the buffer and text after it at the end
+/// Inserting and deleting at the cursor is amortized O(1), moving the cursor copies only the characters it passes over
+/// </summary>
+template<Character C>
+struct GapStringBase
+{
+	GapStringBase();
+	GapStringBase(NullPointer);
+	explicit GapStringBase(const StringViewBase<C>& other);
+	GapStringBase(const GapStringBase& other);
+	GapStringBase(GapStringBase&& other) noexcept;
+
+	GapStringBase& operator=(NullPointer);
+	GapStringBase& operator=(const GapStringBase& other);
+	GapStringBase& operator=(GapStringBase&& other) noexcept;
+
+	~GapStringBase();
+	void Destroy();
+	void Clear();
+	void Reserve(U64 capacity);
+
+	/// <summary>
+	/// Moves the cursor to position, only the characters between the old and new cursor are copied
+	/// </summary>
+	GapStringBase& MoveCursor(U64 position);
+
+	GapStringBase& Insert(C c);
+	GapStringBase& Insert(const StringViewBase<C>& insert);
+
+	/// <summary>
+	/// Removes up to count characters after the cursor
+	/// </summary>
+	GapStringBase& Delete(U64 count = 1);
+
+	/// <summary>
+	/// Removes up to count characters before the cursor
+	/// </summary>
+	GapStringBase& Backspace(U64 count = 1);
+
+	/// <returns>The text before the cursor, valid until the next edit</returns>
+	StringViewBase<C> Before() const { return { buffer, gapStart }; }
+
+	/// <returns>The text after the cursor, valid until the next edit</returns>
+	StringViewBase<C> After() const { return { buffer + gapEnd, capacity - gapEnd }; }
+
+	StringBase<C> ToString() const;
+
+	C operator[](U64 index) const { return index < gapStart ? buffer[index] : buffer[index + gapEnd - gapStart]; }
+
+	U64 Size() const { return capacity - (gapEnd - gapStart); }
+	U64 Capacity() const { return capacity; }
+	U64 Cursor() const { return gapStart; }
+
+private:
+	void Grow(U64 required);
+	bool Aliases(const StringViewBase<C>& other) const;
+
+	U64 capacity{ 0 };
+	U64 gapStart{ 0 };
+	U64 gapEnd{ 0 };
+	C* buffer{ nullptr };
+};
+
+using GapString = GapStringBase<char>;
+using GapString8 = GapStringBase<char8_t>;
+using GapString16 = GapStringBase<char16_t>;
+using GapString32 = GapStringBase<char32_t>;
+using GapStringW = GapStringBase<wchar_t>;
+
+template<Character C>
+inline GapStringBase<C>::GapStringBase() {}
+
+template<Character C>
+inline GapStringBase<C>::GapStringBase(NullPointer) {}
+
+template<Character C>
+inline GapStringBase<C>::GapStringBase(const StringViewBase<C>& other)
+{
+	Insert(other);
+}
+
+template<Character C>
+inline GapStringBase<C>::GapStringBase(const GapStringBase& other) : capacity{ other.capacity }, gapStart{ other.gapStart }, gapEnd{ other.gapEnd }
+{
+	if (capacity)
+	{
+		buffer = (C*)malloc(capacity * sizeof(C));
+		Copy(buffer, other.buffer, gapStart);
+		Copy(buffer + gapEnd, other.buffer + gapEnd, capacity - gapEnd);
+	}
+}
+
+template<Character C>
+inline GapStringBase<C>::GapStringBase(GapStringBase&& other) noexcept : capacity{ other.capacity }, gapStart{ other.gapStart }, gapEnd{ other.gapEnd }, buffer{ other.buffer }
+{
+	other.capacity = 0;
+	other.gapStart = 0;
+	other.gapEnd = 0;
+	other.buffer = nullptr;
+}
+
+template<Character C>
+inline GapStringBase<C>& GapStringBase<C>::operator=(NullPointer)
+{
+	Destroy();
+
+	return *this;
+}
+
+template<Character C>
+inline GapStringBase<C>& GapStringBase<C>::operator=(const GapStringBase& other)
+{
+	if (&other == this) { return *this; }
+
+	Destroy();
+
+	capacity = other.capacity;
+	gapStart = other.gapStart;
+	gapEnd = other.gapEnd;
+
+	if (capacity)
+	{
+		buffer = (C*)malloc(capacity * sizeof(C));
+		Copy(buffer, other.buffer, gapStart);
+		Copy(buffer + gapEnd, other.buffer + gapEnd, capacity - gapEnd);
+	}
+
+	return *this;
+}
+
+template<Character C>
+inline GapStringBase<C>& GapStringBase<C>::operator=(GapStringBase&& other) noexcept
+{
+	if (&other == this) { return *this; }
+
+	Destroy();
+
+	capacity = other.capacity;
+	gapStart = other.gapStart;
+	gapEnd = other.gapEnd;
+	buffer = other.buffer;
+
+	other.capacity = 0;
+	other.gapStart = 0;
+	other.gapEnd = 0;
+	other.buffer = nullptr;
+
+	return *this;
+}
+
+template<Character C>
+inline GapStringBase<C>::~GapStringBase()
+{
+	Destroy();
+}
+
+template<Character C>
+inline void GapStringBase<C>::Destroy()
+{
+	if (buffer)
+	{
+		free(buffer);
+		buffer = nullptr;
+	}
+
+	capacity = 0;
+	gapStart = 0;
+	gapEnd = 0;
+}
+
+template<Character C>
+inline void GapStringBase<C>::Clear()
+{
+	gapStart = 0;
+	gapEnd = capacity;
+}
+
+template<Character C>
+inline void GapStringBase<C>::Reserve(U64 capacity)
+{
+	if (capacity > this->capacity) { Grow(capacity - Size()); }
+}
+
+template<Character C>
+inline GapStringBase<C>& GapStringBase<C>::MoveCursor(U64 position)
+{
+	if (position > Size()) { position = Size(); }
+
+	if (position < gapStart)
+	{
+		U64 count = gapStart - position;
+		Copy(buffer + gapEnd - count, buffer + position, count);
+		gapStart -= count;
+		gapEnd -= count;
+	}
+	else if (position > gapStart)
+	{
+		U64 count = position - gapStart;
+		Copy(buffer + gapStart, buffer + gapEnd, count);
+		gapStart += count;
+		gapEnd += count;
+	}
+
+	return *this;
+}
+
+template<Character C>
+inline GapStringBase<C>& GapStringBase<C>::Insert(C c)
+{
+	if (gapStart == gapEnd) { Grow(1); }
+
+	buffer[gapStart++] = c;
+
+	return *this;
+}
+
+template<Character C>
+inline GapStringBase<C>& GapStringBase<C>::Insert(const StringViewBase<C>& insert)
+{
+	if (gapEnd - gapStart < insert.Size())
+	{
+		//Growing moves the buffer, text viewed from this string is copied out first
+		if (Aliases(insert)) { return Insert(StringBase<C>(insert)); }
+
+		Grow(insert.Size());
+	}
+
+	Copy(buffer + gapStart, insert.Data(), insert.Size());
+	gapStart += insert.Size();
+
+	return *this;
+}
+
+template<Character C>
+inline GapStringBase<C>& GapStringBase<C>::Delete(U64 count)
+{
+	U64 after = capacity - gapEnd;
+	gapEnd += count < after ? count : after;
+
+	return *this;
+}
+
+template<Character C>
+inline GapStringBase<C>& GapStringBase<C>::Backspace(U64 count)
+{
+	gapStart -= count < gapStart ? count : gapStart;
+
+	return *this;
+}
+
+template<Character C>
+inline StringBase<C> GapStringBase<C>::ToString() const
+{
+	StringBase<C> str(Size());
+	Copy(str.Data(), buffer, gapStart);
+	Copy(str.Data() + gapStart, buffer + gapEnd, capacity - gapEnd);
+	str.Data()[str.Size()] = '\0';
+
+	return std::move(str);
+}
+
+
+
+//Helpers
+template<Character C>
+inline void GapStringBase<C>::Grow(U64 required)
+{
+	U64 after = capacity - gapEnd;
+	U64 newCapacity = capacity * 2;
+	if (newCapacity < Size() + required) { newCapacity = Size() + required; }
+	if (newCapacity < 64) { newCapacity = 64; }
+
+	if (buffer) { buffer = (C*)realloc(buffer, newCapacity * sizeof(C)); }
+	else { buffer = (C*)malloc(newCapacity * sizeof(C)); }
+
+	Copy(buffer + newCapacity - after, buffer + gapEnd, after);
+
+	gapEnd = newCapacity - after;
+	capacity = newCapacity;
+}
+
+template<Character C>
+inline bool GapStringBase<C>::Aliases(const StringViewBase<C>& other) const
+{
+	return buffer && other.Data() >= buffer && other.Data() < buffer + capacity;
+}
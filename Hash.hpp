@@ -0,0 +1,169 @@
+#pragma once
+
+#include "ContainerDefines.hpp"
+#include "String.hpp"
+
+#include <type_traits>
+
+static inline constexpr U64 HASH_SECRET0 = 0x2D358DCCAA6C78A5ULL;
+static inline constexpr U64 HASH_SECRET1 = 0x8BB84B93962EACC9ULL;
+static inline constexpr U64 HASH_SECRET2 = 0x4B33A62ED433D4A3ULL;
+static inline constexpr U64 HASH_SECRET3 = 0x4D5A2DA51DE1AA47ULL;
+
+/// <summary>
+/// Multiplies a and b into 128 bits and folds the halves together
+/// </summary>
+static inline U64 HashMix(U64 a, U64 b)
+{
+	U64 high;
+	U64 low = _umul128(a, b, &high);
+	return low ^ high;
+}
+
+static inline U64 HashRead8(const U8* p) { U64 v; memcpy(&v, p, 8); return v; }
+static inline U64 HashRead4(const U8* p) { U32 v; memcpy(&v, p, 4); return v; }
+static inline U64 HashRead3(const U8* p, U64 size) { return ((U64)p[0] << 16) | ((U64)p[size >> 1] << 8) | p[size - 1]; }
+
+/// <summary>
+/// Hashes size bytes at data, wyhash's construction built on 64x64->128 bit multiplies, 48 bytes per step across three lanes
+/// Not cryptographic, don't use it where an attacker picks the keys
+/// </summary>
+static inline U64 HashBytes(const void* data, U64 size, U64 seed = 0)
+{
+	const U8* p = (const U8*)data;
+	seed ^= HashMix(seed ^ HASH_SECRET0, HASH_SECRET1);
+
+	U64 a, b;
+
+	if (size <= 16)
+	{
+		if (size >= 4)
+		{
+			U64 offset = (size >> 3) << 2;
+			a = (HashRead4(p) << 32) | HashRead4(p + offset);
+			b = (HashRead4(p + size - 4) << 32) | HashRead4(p + size - 4 - offset);
+		}
+		else if (size > 0) { a = HashRead3(p, size); b = 0; }
+		else { a = b = 0; }
+	}
+	else
+	{
+		U64 remaining = size;
+
+		if (remaining >= 48)
+		{
+			U64 seed1 = seed;
+			U64 seed2 = seed;
+
+			do
+			{
+				seed = HashMix(HashRead8(p) ^ HASH_SECRET1, HashRead8(p + 8) ^ seed);
+				seed1 = HashMix(HashRead8(p + 16) ^ HASH_SECRET2, HashRead8(p + 24) ^ seed1);
+				seed2 = HashMix(HashRead8(p + 32) ^ HASH_SECRET3, HashRead8(p + 40) ^ seed2);
+				p += 48;
+				remaining -= 48;
+			} while (remaining >= 48);
+
+			seed ^= seed1 ^ seed2;
+		}
+
+		while (remaining > 16)
+		{
+			seed = HashMix(HashRead8(p) ^ HASH_SECRET1, HashRead8(p + 8) ^ seed);
+			p += 16;
+			remaining -= 16;
+		}
+
+		a = HashRead8(p + remaining - 16);
+		b = HashRead8(p + remaining - 8);
+	}
+
+	a ^= HASH_SECRET1;
+	b ^= seed;
+	a = _umul128(a, b, &b);
+
+	return HashMix(a ^ HASH_SECRET0 ^ size, b ^ HASH_SECRET1);
+}
+
+/// <summary>
+/// Hashes the characters of a string, equal strings hash equal whichever string type holds them
+/// </summary>
+template<Character C>
+inline U64 Hash(const StringViewBase<C>& string, U64 seed = 0)
+{
+	return HashBytes(string.Data(), string.Size() * sizeof(C), seed);
+}
+
+template<Character C>
+inline U64 Hash(const StringBase<C>& string, U64 seed = 0)
+{
+	return HashBytes(string.Data(), string.Size() * sizeof(C), seed);
+}
+
+template<Character C>
+inline U64 Hash(const C* string, U64 seed = 0)
+{
+	return Hash(StringViewBase<C>(string), seed);
+}
+
+/// <summary>
+/// Hashes the bytes of a trivially copyable value, types with padding should be hashed field by field with HashCombine
+/// </summary>
+template<class Type> requires (std::is_trivially_copyable_v<Type> && !IsStringType<Type> && !IsStringLiteral<Type>)
+inline U64 Hash(const Type& value, U64 seed = 0)
+{
+	if constexpr (sizeof(Type) <= 8 && (std::is_integral_v<Type> || std::is_enum_v<Type> || std::is_pointer_v<Type>))
+	{
+		U64 v = 0;
+		memcpy(&v, &value, sizeof(Type));
+		return HashMix(v ^ seed ^ HASH_SECRET0, HASH_SECRET1 ^ sizeof(Type));
+	}
+	else { return HashBytes(&value, sizeof(Type), seed); }
+}
+
+/// <summary>
+/// Folds hash into seed, use to build the hash of a composite key from the hashes of its fields
+/// </summary>
+static inline U64 HashCombine(U64 seed, U64 hash)
+{
+	return HashMix(seed ^ HASH_SECRET2, hash ^ HASH_SECRET3);
+}
+
+/// <summary>
+/// Holds a value together with its hash so the hash is computed once, Hash on a Hashed returns the stored hash
+/// </summary>
+template<class Type>
+struct Hashed
+{
+	Hashed() : value{}, hash{ ::Hash(value) } {}
+	Hashed(const Type& value) : value{ value }, hash{ ::Hash(this->value) } {}
+	Hashed(Type&& value) noexcept : value{ std::move(value) }, hash{ ::Hash(this->value) } {}
+
+	const Type& Value() const { return value; }
+	U64 Hash() const { return hash; }
+
+	friend bool operator==(const Hashed& a, const Hashed& b) { return a.hash == b.hash && a.value == b.value; }
+	friend bool operator!=(const Hashed& a, const Hashed& b) { return !(a == b); }
+
+private:
+	Type value;
+	U64 hash;
+};
+
+/// <summary>
+/// Returns the stored hash, it was computed without a seed so there's no seeded overload, fold a seed in with HashCombine
+/// </summary>
+template<class Type>
+inline U64 Hash(const Hashed<Type>& hashed)
+{
+	return hashed.Hash();
+}
+
+/// <summary>
+/// Function object over Hash, for containers that take a hasher type
+/// </summary>
+template<class Type>
+struct Hasher
+{
+	U64 operator()(const Type& value) const { return Hash(value); }
+};
@@ -1,13 +1,1266 @@
 #pragma once
 
-#include "Defines.h"
-#include "Initiazer.h"
+#include "ContainerDefines.hpp"
+#include "Hash.hpp"
 
-//quadratic probing hashed array
+#include <stdlib.h>
+#include <new>
+#include <bit>
+#include <utility>
+#include <type_traits>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+static inline constexpr U64 HASHMAP_GROUP_WIDTH = 16;	//Control bytes compared at once, one SSE2 register
+static inline constexpr U64 HASHMAP_MIN_CAPACITY = 16;	//Slots allocated by the first insert, one group
+static inline constexpr F32 HASHMAP_MAX_LOAD = 0.875f;	//Default fraction of slots filled before the table grows
+static inline constexpr F32 HASHMAP_LOWEST_MAX_LOAD = 0.25f;	//Smallest max load SetMaxLoad accepts
+static inline constexpr F32 HASHMAP_HIGHEST_MAX_LOAD = 0.95f;	//Largest max load SetMaxLoad accepts
+static inline constexpr I8 HASHMAP_EMPTY = (I8)0x80;	//Control byte of a slot that was never filled since the last rehash, ends a probe
+static inline constexpr I8 HASHMAP_DELETED = (I8)0xFE;	//Control byte of a removed slot that a probe must step over
+static inline constexpr U64 HASHMAP_MAX_DISTANCE = 127;	//Robin Hood slots past the home slot a pair may sit, a pair that would go further grows the table
+static inline constexpr U64 HASHMAP_CUCKOO_PATH = 64;	//Pairs a cuckoo insert may displace before the table grows
+static inline constexpr U64 CONCURRENT_HASHMAP_MIN_CAPACITY = 64;	//Slots of a new concurrent table
+static inline constexpr U64 CONCURRENT_HASHMAP_STRIPES = 64;		//Write locks of a concurrent table, a key's lock is picked by the top bits of its hash
+static inline constexpr U64 CONCURRENT_HASHMAP_READER_SLOTS = 64;	//Counters readers announce themselves on, spread over threads so readers rarely share a cache line
+static inline constexpr U64 CONCURRENT_HASHMAP_RETIRE_BATCH = 256;	//Replaced nodes and tables kept before a writer waits out the readers and frees them
+
+/// <summary>
+/// How a Hashmap finds the slot of a key
+/// Robin Hood and cuckoo grow the table when a key can't be placed, so a hash that sends more than a run or two groups worth of keys to one home keeps growing it
+/// </summary>
+enum class HashmapProbing : U8
+{
+	Quadratic,	//Groups of 16 slots are stepped through with triangular steps, removing leaves a tombstone only in a full group
+	Linear,		//Groups of 16 slots are stepped through one after the other, removing leaves a tombstone only in a full group
+	RobinHood,	//Slots are stepped through one after the other, a pair further from home takes the slot, removing shifts the run back
+	Cuckoo		//A key lives in one of two groups of 16 slots, inserting into two full groups moves pairs to their other group
+};
+
+/// <summary>
+/// Probe lengths of a table, counted in groups compared for the grouped and cuckoo policies and in slots compared for Robin Hood
+/// </summary>
+struct HashmapProbeStats
+{
+	F64 averageHit{ 0.0 };	//Mean length of a lookup that finds its key, over every key in the map
+	F64 averageMiss{ 0.0 };	//Mean length of a lookup for a missing key, over every home position
+	U64 longestHit{ 0 };
+	U64 longestMiss{ 0 };
+};
+
+/// <summary>
+/// Open addressing hash table, a separate control byte per slot holds 7 bits of the key's hash so a probe compares a whole group of 16 slots with one SSE2 compare
+/// Groups are probed quadratically with triangular steps that visit every group, the table grows at 7/8 full
+/// Removing leaves no tombstone when the slot's group still has an empty slot, since no probe could have passed through that group
+/// Probing picks another strategy, Robin Hood keeps each slot's distance from home in its control byte instead of hash bits
+/// </summary>
+template<class Key, class Value, HashmapProbing Probing = HashmapProbing::Quadratic, class HashFunction = Hasher<Key>>
 struct Hashmap
 {
+	struct Pair
+	{
+		Key key;
+		Value value;
+	};
+
+	struct Iterator
+	{
+	public:
+		Iterator(const I8* control, const I8* last, Pair* pair) : control{ control }, last{ last }, pair{ pair } { SkipEmpty(); }
+
+		Pair& operator* () const { return *pair; }
+		Pair* operator-> () const { return pair; }
+
+		Iterator& operator++ ()
+		{
+			++control;
+			++pair;
+			SkipEmpty();
+			return *this;
+		}
+
+		Iterator operator++ (int)
+		{
+			Iterator temp = *this;
+			++*this;
+			return temp;
+		}
+
+		friend bool operator== (const Iterator& a, const Iterator& b) { return a.control == b.control; }
+		friend bool operator!= (const Iterator& a, const Iterator& b) { return a.control != b.control; }
+
+	private:
+		void SkipEmpty() { while (control != last && *control < 0) { ++control; ++pair; } }
+
+		const I8* control;
+		const I8* last;
+		Pair* pair;
+
+		friend struct Hashmap;
+	};
+
 public:
+	Hashmap() {}
+	Hashmap(const Hashmap& other);
+	Hashmap(Hashmap&& other) noexcept;
+	Hashmap& operator=(const Hashmap& other);
+	Hashmap& operator=(Hashmap&& other) noexcept;
+
+	~Hashmap();
+
+	/// <summary>
+	/// Destroys every pair and frees the table
+	/// </summary>
+	void Destroy();
+
+	/// <summary>
+	/// Destroys every pair but keeps the table for reuse
+	/// </summary>
+	void Clear();
+
+	/// <summary>
+	/// Grows the table so count pairs fit without another rehash
+	/// </summary>
+	void Reserve(U64 count);
+
+	/// <summary>
+	/// Sets the fraction of slots filled before the table grows, clamped to 0.25 - 0.95, at least one slot always stays empty
+	/// </summary>
+	void SetMaxLoad(F32 load);
+
+	/// <summary>
+	/// Adds key with value if key isn't in the map yet, an existing value is left untouched
+	/// </summary>
+	/// <returns>Whether the pair was added</returns>
+	bool Insert(const Key& key, const Value& value);
+	bool Insert(Key&& key, Value&& value);
+
+	/// <returns>The value of key, a default constructed value is added first if key isn't in the map</returns>
+	Value& operator[](const Key& key);
+	Value& operator[](Key&& key);
+
+	/// <returns>A pointer to the value of key, nullptr if key isn't in the map</returns>
+	Value* Find(const Key& key);
+	const Value* Find(const Key& key) const;
+	bool Contains(const Key& key) const;
+
+	/// <returns>Whether key was in the map</returns>
+	bool Remove(const Key& key);
+
+	/// <summary>
+	/// Removes the pair at position, position is moved to the next pair
+	/// </summary>
+	void Remove(Iterator& position);
+
+	/// <returns>Probe lengths of every key in the map and of a missing key from every home position, walks the whole table</returns>
+	HashmapProbeStats ProbeStats() const;
+
+	Iterator begin() { return { control, control + Slots(capacity), pairs }; }
+	Iterator end() { return { control + Slots(capacity), control + Slots(capacity), pairs + Slots(capacity) }; }
+	Iterator begin() const { return { control, control + Slots(capacity), pairs }; }
+	Iterator end() const { return { control + Slots(capacity), control + Slots(capacity), pairs + Slots(capacity) }; }
+
+	U64 Size() const { return size; }
+	U64 Capacity() const { return capacity; }
+	bool Empty() const { return size == 0; }
+	F32 MaxLoad() const { return maxLoad; }
+	F32 LoadFactor() const { return capacity ? (F32)size / capacity : 0.0f; }
 
 private:
+	static_assert(alignof(Pair) <= HASHMAP_GROUP_WIDTH, "Pairs aligned past a group aren't supported");
+
+	static constexpr U64 NONE = U64_MAX;
+	static constexpr bool GROUPED = Probing == HashmapProbing::Quadratic || Probing == HashmapProbing::Linear;
+
+	//Control bytes of a table that was never allocated, a probe stops at its first group without touching any pair
+	alignas(HASHMAP_GROUP_WIDTH) static inline const I8 EMPTY_GROUP[HASHMAP_GROUP_WIDTH]{ HASHMAP_EMPTY, HASHMAP_EMPTY, HASHMAP_EMPTY, HASHMAP_EMPTY,
+		HASHMAP_EMPTY, HASHMAP_EMPTY, HASHMAP_EMPTY, HASHMAP_EMPTY, HASHMAP_EMPTY, HASHMAP_EMPTY, HASHMAP_EMPTY, HASHMAP_EMPTY,
+		HASHMAP_EMPTY, HASHMAP_EMPTY, HASHMAP_EMPTY, HASHMAP_EMPTY };
+
+	template<typename K, typename... Args> inline Pair* Emplace(bool& inserted, K&& key, Args&&... args);
+	inline U64 FindIndex(const Key& key, U64 hash) const;
+	inline U64 Claim(U64 hash);
+	inline U64 ClaimCuckoo(U64 hash);
+	inline void EraseIndex(U64 index);
+	inline void Grow();
+	inline void Rehash(U64 newCapacity);
+	inline void Allocate(U64 newCapacity);
+	inline void CopyFrom(const Hashmap& other);
+	inline void Reset();
+	inline U64 Limit(U64 newCapacity) const;
+
+	static inline U32 MatchByte(const I8* group, I8 byte);
+	static inline U32 MatchFree(const I8* group);
+	static U64 Slots(U64 capacity) { return Probing == HashmapProbing::RobinHood && capacity ? capacity + HASHMAP_MAX_DISTANCE : capacity; }
+	static U64 NextGroup(U64 group, U64 step) { return Probing == HashmapProbing::Quadratic ? group + step : group + 1; }
+	static U64 CuckooOffset(U64 hash, U64 groupMask) { return ((hash >> 32) | 1) & groupMask; }
+	static I8 Fragment(U64 hash) { return (I8)(hash & 0x7F); }
+	U64 GroupMask() const { return capacity ? capacity / HASHMAP_GROUP_WIDTH - 1 : 0; }
+	U64 Home(U64 hash) const { return capacity ? (hash >> 7) & (capacity - 1) : 0; }
+	I8 ControlByte(U64 hash, U64 index) const { return Probing == HashmapProbing::RobinHood ? (I8)(index - Home(hash)) : Fragment(hash); }
+
+	I8* control{ (I8*)EMPTY_GROUP };
+	Pair* pairs{ nullptr };
+	U64 capacity{ 0 };
+	U64 size{ 0 };
+	U64 deleted{ 0 };
+	U64 limit{ 0 };
+	F32 maxLoad{ HASHMAP_MAX_LOAD };
+};
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline Hashmap<Key, Value, Probing, HashFunction>::Hashmap(const Hashmap& other)
+{
+	CopyFrom(other);
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline Hashmap<Key, Value, Probing, HashFunction>::Hashmap(Hashmap&& other) noexcept : control{ other.control },
+	pairs{ other.pairs }, capacity{ other.capacity }, size{ other.size }, deleted{ other.deleted }, limit{ other.limit }, maxLoad{ other.maxLoad }
+{
+	other.Reset();
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction>
+inline Hashmap<Key, Value, Probing, HashFunction>& Hashmap<Key, Value, Probing, HashFunction>::operator=(const Hashmap& other)
+{
+	if (&other == this) { return *this; }
+
+	Destroy();
+	CopyFrom(other);
+
+	return *this;
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction>
+inline Hashmap<Key, Value, Probing, HashFunction>& Hashmap<Key, Value, Probing, HashFunction>::operator=(Hashmap&& other) noexcept
+{
+	if (&other == this) { return *this; }
+
+	Destroy();
+
+	control = other.control;
+	pairs = other.pairs;
+	capacity = other.capacity;
+	size = other.size;
+	deleted = other.deleted;
+	limit = other.limit;
+	maxLoad = other.maxLoad;
+
+	other.Reset();
+
+	return *this;
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline Hashmap<Key, Value, Probing, HashFunction>::~Hashmap()
+{
+	Destroy();
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline void Hashmap<Key, Value, Probing, HashFunction>::Destroy()
+{
+	Clear();
+
+	if (capacity) { free(control); }
+	Reset();
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline void Hashmap<Key, Value, Probing, HashFunction>::Clear()
+{
+	if (!capacity) { return; }
+
+	U64 slots = Slots(capacity);
+
+	if constexpr (!std::is_trivially_destructible_v<Pair>)
+	{
+		for (U64 i = 0; i < slots; ++i) { if (control[i] >= 0) { pairs[i].~Pair(); } }
+	}
+
+	memset(control, (U8)HASHMAP_EMPTY, slots);
+	size = 0;
+	deleted = 0;
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline void Hashmap<Key, Value, Probing, HashFunction>::Reserve(U64 count)
+{
+	U64 newCapacity = capacity ? capacity : HASHMAP_MIN_CAPACITY;
+	while (Limit(newCapacity) < count) { newCapacity <<= 1; }
+
+	if (newCapacity > capacity) { Rehash(newCapacity); }
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline void Hashmap<Key, Value, Probing, HashFunction>::SetMaxLoad(F32 load)
+{
+	//A load near 0 would leave no room in any table, a load near 1 leaves probes nowhere to end
+	maxLoad = load < HASHMAP_LOWEST_MAX_LOAD ? HASHMAP_LOWEST_MAX_LOAD : load > HASHMAP_HIGHEST_MAX_LOAD ? HASHMAP_HIGHEST_MAX_LOAD : load;
+	limit = Limit(capacity);
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline bool Hashmap<Key, Value, Probing, HashFunction>::Insert(const Key& key, const Value& value)
+{
+	bool inserted;
+	Emplace(inserted, key, value);
+	return inserted;
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline bool Hashmap<Key, Value, Probing, HashFunction>::Insert(Key&& key, Value&& value)
+{
+	bool inserted;
+	Emplace(inserted, std::move(key), std::move(value));
+	return inserted;
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline Value& Hashmap<Key, Value, Probing, HashFunction>::operator[](const Key& key)
+{
+	bool inserted;
+	return Emplace(inserted, key)->value;
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline Value& Hashmap<Key, Value, Probing, HashFunction>::operator[](Key&& key)
+{
+	bool inserted;
+	return Emplace(inserted, std::move(key))->value;
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline Value* Hashmap<Key, Value, Probing, HashFunction>::Find(const Key& key)
+{
+	U64 index = FindIndex(key, HashFunction{}(key));
+	return index == NONE ? nullptr : &pairs[index].value;
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline const Value* Hashmap<Key, Value, Probing, HashFunction>::Find(const Key& key) const
+{
+	U64 index = FindIndex(key, HashFunction{}(key));
+	return index == NONE ? nullptr : &pairs[index].value;
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline bool Hashmap<Key, Value, Probing, HashFunction>::Contains(const Key& key) const
+{
+	return FindIndex(key, HashFunction{}(key)) != NONE;
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline bool Hashmap<Key, Value, Probing, HashFunction>::Remove(const Key& key)
+{
+	U64 index = FindIndex(key, HashFunction{}(key));
+	if (index == NONE) { return false; }
+
+	EraseIndex(index);
+	return true;
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline void Hashmap<Key, Value, Probing, HashFunction>::Remove(Iterator& position)
+{
+	if (position.control == position.last) { return; }
+
+	U64 index = (U64)(position.control - control);
+	EraseIndex(index);
+
+	//Robin Hood shifts the next pair of the run into the removed slot, it hasn't been visited yet since runs never wrap
+	if (Probing != HashmapProbing::RobinHood || control[index] < 0) { ++position; }
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline HashmapProbeStats Hashmap<Key, Value, Probing, HashFunction>::ProbeStats() const
+{
+	HashmapProbeStats stats;
+	if (!capacity) { return stats; }
+
+	U64 groupMask = GroupMask();
+	U64 hitTotal = 0;
+	U64 missTotal = 0;
+	U64 homes = 0;
+
+	for (U64 i = 0; i < Slots(capacity); ++i)
+	{
+		if (control[i] < 0) { continue; }
+
+		U64 hash = HashFunction{}(pairs[i].key);
+		U64 length = 1;
+
+		if constexpr (GROUPED)
+		{
+			for (U64 group = (hash >> 7) & groupMask, step = 1; group != i / HASHMAP_GROUP_WIDTH; ++step, ++length) { group = NextGroup(group, step) & groupMask; }
+		}
+		else if constexpr (Probing == HashmapProbing::RobinHood) { length = (U64)control[i] + 1; }
+		else { length = i / HASHMAP_GROUP_WIDTH == ((hash >> 7) & groupMask) ? 1 : 2; }
+
+		hitTotal += length;
+		if (length > stats.longestHit) { stats.longestHit = length; }
+	}
+
+	if constexpr (GROUPED)
+	{
+		for (U64 home = 0; home <= groupMask; ++home, ++homes)
+		{
+			U64 length = 1;
+			for (U64 group = home, step = 1; !MatchByte(control + group * HASHMAP_GROUP_WIDTH, HASHMAP_EMPTY); ++step, ++length) { group = NextGroup(group, step) & groupMask; }
+
+			missTotal += length;
+			if (length > stats.longestMiss) { stats.longestMiss = length; }
+		}
+	}
+	else if constexpr (Probing == HashmapProbing::RobinHood)
+	{
+		for (U64 home = 0; home < capacity; ++home, ++homes)
+		{
+			I64 distance = 0;
+			while (control[home + distance] >= distance) { ++distance; }
+
+			U64 length = (U64)distance + 1;
+			missTotal += length;
+			if (length > stats.longestMiss) { stats.longestMiss = length; }
+		}
+	}
+	else
+	{
+		//A missing key is looked for in both its groups, they're the same group only while the table is one group
+		homes = 1;
+		missTotal = groupMask ? 2 : 1;
+		stats.longestMiss = missTotal;
+	}
+
+	stats.averageHit = size ? (F64)hitTotal / size : 0.0;
+	stats.averageMiss = (F64)missTotal / homes;
+
+	return stats;
+}
+
+
+
+
+//Helpers
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> template<typename K, typename... Args>
+inline typename Hashmap<Key, Value, Probing, HashFunction>::Pair* Hashmap<Key, Value, Probing, HashFunction>::Emplace(bool& inserted, K&& key, Args&&... args)
+{
+	U64 hash = HashFunction{}(key);
+	U64 index = FindIndex(key, hash);
+
+	if (index != NONE)
+	{
+		inserted = false;
+		return &pairs[index];
+	}
+
+	inserted = true;
+
+	//Grouped probing never moves a pair to make room, so below the limit the pair is built in its slot
+	if constexpr (GROUPED)
+	{
+		if (size + deleted + 1 <= limit)
+		{
+			index = Claim(hash);
+			new (&pairs[index]) Pair{ Key(std::forward<K>(key)), Value(std::forward<Args>(args)...) };
+			control[index] = ControlByte(hash, index);
+			++size;
+
+			return &pairs[index];
+		}
+	}
+
+	//key and args may refer into the table that is about to move, so the pair is built before making room
+	Pair pair{ Key(std::forward<K>(key)), Value(std::forward<Args>(args)...) };
+
+	if (size + deleted + 1 > limit) { Grow(); }
+	while ((index = Claim(hash)) == NONE) { Rehash(capacity * 2); }
+
+	new (&pairs[index]) Pair(std::move(pair));
+	control[index] = ControlByte(hash, index);
+	++size;
+
+	return &pairs[index];
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline U64 Hashmap<Key, Value, Probing, HashFunction>::FindIndex(const Key& key, U64 hash) const
+{
+	if constexpr (Probing == HashmapProbing::RobinHood)
+	{
+		//A run holds its pairs in order of home slot, so the key is missing once a slot is closer to its home than the probe is
+		U64 index = Home(hash);
+
+		for (I64 distance = 0;; ++distance, ++index)
+		{
+			I8 byte = control[index];
+			if (byte < distance) { return NONE; }
+			if (byte == distance && pairs[index].key == key) { return index; }
+		}
+	}
+	else if constexpr (Probing == HashmapProbing::Cuckoo)
+	{
+		I8 fragment = Fragment(hash);
+		U64 groupMask = GroupMask();
+		U64 group = (hash >> 7) & groupMask;
+
+		for (U64 i = 0; i < 2; ++i, group ^= CuckooOffset(hash, groupMask))
+		{
+			for (U32 match = MatchByte(control + group * HASHMAP_GROUP_WIDTH, fragment); match; match &= match - 1)
+			{
+				U64 index = group * HASHMAP_GROUP_WIDTH + std::countr_zero(match);
+				if (pairs[index].key == key) { return index; }
+			}
+		}
+
+		return NONE;
+	}
+	else
+	{
+		I8 fragment = Fragment(hash);
+		U64 groupMask = GroupMask();
+		U64 group = (hash >> 7) & groupMask;
+
+		for (U64 step = 1;; ++step)
+		{
+			const I8* groupControl = control + group * HASHMAP_GROUP_WIDTH;
+
+			for (U32 match = MatchByte(groupControl, fragment); match; match &= match - 1)
+			{
+				U64 index = group * HASHMAP_GROUP_WIDTH + std::countr_zero(match);
+				if (pairs[index].key == key) { return index; }
+			}
+
+			if (MatchByte(groupControl, HASHMAP_EMPTY)) { return NONE; }
+
+			group = NextGroup(group, step) & groupMask;
+		}
+	}
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline U64 Hashmap<Key, Value, Probing, HashFunction>::Claim(U64 hash)
+{
+	if constexpr (Probing == HashmapProbing::RobinHood)
+	{
+		//The pair goes before the first pair of the run that is closer to its home
+		U64 index = Home(hash);
+		I64 distance = 0;
+
+		while (control[index] >= distance) { ++index; ++distance; }
+		if (distance >= (I64)HASHMAP_MAX_DISTANCE) { return NONE; }
+
+		U64 last = index;
+		for (; control[last] >= 0; ++last) { if (control[last] == (I8)(HASHMAP_MAX_DISTANCE - 1)) { return NONE; } }
+
+		//Every pair from there to the end of the run moves one slot further from home
+		for (U64 i = last; i > index; --i)
+		{
+			new (&pairs[i]) Pair(std::move(pairs[i - 1]));
+			pairs[i - 1].~Pair();
+			control[i] = (I8)(control[i - 1] + 1);
+		}
+
+		return index;
+	}
+	else if constexpr (Probing == HashmapProbing::Cuckoo) { return ClaimCuckoo(hash); }
+	else
+	{
+		U64 groupMask = GroupMask();
+		U64 group = (hash >> 7) & groupMask;
+
+		for (U64 step = 1;; ++step)
+		{
+			U32 match = MatchFree(control + group * HASHMAP_GROUP_WIDTH);
+
+			if (match)
+			{
+				U64 index = group * HASHMAP_GROUP_WIDTH + std::countr_zero(match);
+				if (control[index] == HASHMAP_DELETED) { --deleted; }
+				return index;
+			}
+
+			group = NextGroup(group, step) & groupMask;
+		}
+	}
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline U64 Hashmap<Key, Value, Probing, HashFunction>::ClaimCuckoo(U64 hash)
+{
+	U64 groupMask = GroupMask();
+	U64 first = (hash >> 7) & groupMask;
+	U64 second = first ^ CuckooOffset(hash, groupMask);
+
+	if (U32 match = MatchFree(control + first * HASHMAP_GROUP_WIDTH)) { return first * HASHMAP_GROUP_WIDTH + std::countr_zero(match); }
+	if (U32 match = MatchFree(control + second * HASHMAP_GROUP_WIDTH)) { return second * HASHMAP_GROUP_WIDTH + std::countr_zero(match); }
+
+	//Both groups are full, a random walk looks for a path of pairs that can each move to their other group before anything moves
+	U64 path[HASHMAP_CUCKOO_PATH];
+	U64 seed = hash | 1;
+	U64 group = (hash >> 6) & 1 ? second : first;
+
+	for (U64 length = 0; length < HASHMAP_CUCKOO_PATH; ++length)
+	{
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+
+		//A slot already on the path would be moved twice, the next slot of the group is tried instead
+		U64 victim = NONE;
+		for (U64 tries = 0; tries < HASHMAP_GROUP_WIDTH && victim == NONE; ++tries)
+		{
+			victim = group * HASHMAP_GROUP_WIDTH + ((seed + tries) & (HASHMAP_GROUP_WIDTH - 1));
+			for (U64 i = 0; i < length; ++i) { if (path[i] == victim) { victim = NONE; break; } }
+		}
+
+		if (victim == NONE) { return NONE; }
+
+		path[length] = victim;
+		group ^= CuckooOffset(HashFunction{}(pairs[victim].key), groupMask);
+
+		if (U32 match = MatchFree(control + group * HASHMAP_GROUP_WIDTH))
+		{
+			//Moves run from the end of the path so every pair lands on a slot that was just freed
+			U64 slot = group * HASHMAP_GROUP_WIDTH + std::countr_zero(match);
+
+			for (U64 i = length + 1; i-- > 0;)
+			{
+				new (&pairs[slot]) Pair(std::move(pairs[path[i]]));
+				pairs[path[i]].~Pair();
+				control[slot] = control[path[i]];
+				slot = path[i];
+			}
+
+			return slot;
+		}
+	}
+
+	return NONE;
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline void Hashmap<Key, Value, Probing, HashFunction>::EraseIndex(U64 index)
+{
+	pairs[index].~Pair();
+
+	if constexpr (Probing == HashmapProbing::RobinHood)
+	{
+		//The rest of the run shifts back a slot, so no lookup ever steps over a hole
+		for (U64 next = index + 1; control[next] > 0; ++index, ++next)
+		{
+			new (&pairs[index]) Pair(std::move(pairs[next]));
+			pairs[next].~Pair();
+			control[index] = (I8)(control[next] - 1);
+		}
+
+		control[index] = HASHMAP_EMPTY;
+	}
+	else if constexpr (Probing == HashmapProbing::Cuckoo) { control[index] = HASHMAP_EMPTY; }
+	else
+	{
+		//A group that still has an empty slot never sent a probe on to the next group, so the slot can be emptied outright
+		if (MatchByte(control + (index & ~(HASHMAP_GROUP_WIDTH - 1)), HASHMAP_EMPTY)) { control[index] = HASHMAP_EMPTY; }
+		else
+		{
+			control[index] = HASHMAP_DELETED;
+			++deleted;
+		}
+	}
+
+	--size;
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline void Hashmap<Key, Value, Probing, HashFunction>::Grow()
+{
+	//Mostly tombstones are cleaned out at the same capacity, otherwise the table doubles
+	if (capacity && size + 1 <= limit / 2) { Rehash(capacity); }
+	else
+	{
+		U64 newCapacity = capacity ? capacity * 2 : HASHMAP_MIN_CAPACITY;
+		while (Limit(newCapacity) < size + 1) { newCapacity <<= 1; }
+
+		Rehash(newCapacity);
+	}
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline void Hashmap<Key, Value, Probing, HashFunction>::Rehash(U64 newCapacity)
+{
+	I8* oldControl = control;
+	Pair* oldPairs = pairs;
+	U64 oldSlots = Slots(capacity);
 
-};
\ No newline at end of file
+	Allocate(newCapacity);
+
+	for (U64 i = 0; i < oldSlots; ++i)
+	{
+		if (oldControl[i] < 0) { continue; }
+
+		//Robin Hood and cuckoo may fail to place a pair, the table then grows again and the rest go into the larger one
+		U64 hash = HashFunction{}(oldPairs[i].key);
+		U64 index;
+		while ((index = Claim(hash)) == NONE) { Rehash(capacity * 2); }
+
+		new (&pairs[index]) Pair(std::move(oldPairs[i]));
+		oldPairs[i].~Pair();
+		control[index] = ControlByte(hash, index);
+	}
+
+	if (oldSlots) { free(oldControl); }
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline void Hashmap<Key, Value, Probing, HashFunction>::Allocate(U64 newCapacity)
+{
+	//Control bytes and pairs share one block, the pairs start after the control bytes rounded up to a group
+	U64 slots = Slots(newCapacity);
+	U64 controlSize = (slots + HASHMAP_GROUP_WIDTH - 1) & ~(HASHMAP_GROUP_WIDTH - 1);
+
+	control = (I8*)malloc(controlSize + slots * sizeof(Pair));
+	pairs = (Pair*)(control + controlSize);
+	capacity = newCapacity;
+	deleted = 0;
+	limit = Limit(newCapacity);
+
+	memset(control, (U8)HASHMAP_EMPTY, controlSize);
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline void Hashmap<Key, Value, Probing, HashFunction>::CopyFrom(const Hashmap& other)
+{
+	maxLoad = other.maxLoad;
+	if (!other.capacity) { return; }
+
+	Allocate(other.capacity);
+
+	U64 slots = Slots(capacity);
+	for (U64 i = 0; i < slots; ++i)
+	{
+		if (other.control[i] >= 0) { new (&pairs[i]) Pair(other.pairs[i]); }
+	}
+
+	memcpy(control, other.control, slots);
+	size = other.size;
+	deleted = other.deleted;
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline void Hashmap<Key, Value, Probing, HashFunction>::Reset()
+{
+	control = (I8*)EMPTY_GROUP;
+	pairs = nullptr;
+	capacity = 0;
+	size = 0;
+	deleted = 0;
+	limit = 0;
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline U64 Hashmap<Key, Value, Probing, HashFunction>::Limit(U64 newCapacity) const
+{
+	//At least one slot stays empty so every probe for a missing key ends
+	U64 count = (U64)(newCapacity * maxLoad);
+	return newCapacity && count >= newCapacity ? newCapacity - 1 : count;
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline U32 Hashmap<Key, Value, Probing, HashFunction>::MatchByte(const I8* group, I8 byte)
+{
+	__m128i block = _mm_load_si128((const __m128i*)group);
+	return (U32)_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8(byte)));
+}
+
+template<class Key, class Value, HashmapProbing Probing, class HashFunction> inline U32 Hashmap<Key, Value, Probing, HashFunction>::MatchFree(const I8* group)
+{
+	//Empty and deleted are the only control bytes with the sign bit set
+	return (U32)_mm_movemask_epi8(_mm_load_si128((const __m128i*)group));
+}
+
+/// <summary>
+/// Hash table many threads can use at once, Find never takes a lock and never waits, writers lock one of 64 stripes picked by the key's hash
+/// Slots hold the full hash and a pointer to an immutable node, a write publishes a new node and the old one is freed once every reader that could see it has left
+/// Growing locks every stripe, builds a larger table from the same nodes and publishes it with one store, readers keep using the old table meanwhile
+/// Removed keys leave their slot claimed until the next resize, a key with the same hash takes it back
+/// </summary>
+template<class Key, class Value, class HashFunction = Hasher<Key>>
+struct ConcurrentHashmap
+{
+public:
+	ConcurrentHashmap() : table{ AllocateTable(CONCURRENT_HASHMAP_MIN_CAPACITY) } {}
+	ConcurrentHashmap(const ConcurrentHashmap&) = delete;
+	ConcurrentHashmap& operator=(const ConcurrentHashmap&) = delete;
+
+	~ConcurrentHashmap();
+
+	/// <summary>
+	/// Grows the table so count keys fit without another resize
+	/// </summary>
+	void Reserve(U64 count);
+
+	/// <summary>
+	/// Adds key with value if key isn't in the map yet, an existing value is left untouched
+	/// </summary>
+	/// <returns>Whether the key was added</returns>
+	bool Insert(const Key& key, const Value& value);
+
+	/// <summary>
+	/// Adds key with value, or replaces the value if key is already in the map
+	/// </summary>
+	/// <returns>Whether the key was added</returns>
+	bool Set(const Key& key, const Value& value);
+
+	/// <summary>
+	/// Copies the value of key into value without locking
+	/// </summary>
+	/// <returns>Whether key was in the map</returns>
+	bool Find(const Key& key, Value& value) const;
+	bool Contains(const Key& key) const;
+
+	/// <returns>Whether key was in the map</returns>
+	bool Remove(const Key& key);
+
+	/// <summary>
+	/// Frees replaced nodes and tables no reader can still see, waits for readers that started before the call
+	/// </summary>
+	void Reclaim();
+
+	U64 Size() const { return size.load(std::memory_order_relaxed); }
+	U64 Capacity() const;
+
+private:
+	static_assert(std::has_single_bit(CONCURRENT_HASHMAP_STRIPES), "Stripes are picked by the top bits of the hash");
+
+	struct Node
+	{
+		Key key;
+		Value value;
+		Node* retired;
+	};
+
+	//A hash of 0 marks a slot that was never claimed and ends a probe, a claimed slot with no node is a removed key or one being written
+	struct Slot
+	{
+		std::atomic<U64> hash;
+		std::atomic<Node*> node;
+	};
+
+	struct Table
+	{
+		Slot* slots;
+		U64 capacity;
+		U64 limit;
+		std::atomic<U64> used;
+		Table* retired;
+	};
+
+	struct alignas(64) Stripe
+	{
+		std::mutex lock;
+	};
+
+	struct alignas(64) ReaderCount
+	{
+		std::atomic<U64> count{ 0 };
+	};
+
+	template<bool Replace> inline bool Write(const Key& key, const Value& value);
+	inline void Resize(Table* observed, U64 minimum);
+	inline U64 EnterRead() const;
+	inline void LeaveRead(U64 phase) const;
+	inline bool RetireNode(Node* node);
+	inline bool RetireTable(Table* old);
+
+	static inline Table* AllocateTable(U64 capacity);
+	static inline void FreeTable(Table* old);
+	static inline Node* CreateNode(const Key& key, const Value& value);
+	static inline void FreeNode(Node* node);
+	static U64 HashOf(const Key& key) { U64 hash = HashFunction{}(key); return hash ? hash : 1; }
+	static U64 Limit(U64 capacity) { return capacity - capacity / 4; }
+	Stripe& StripeOf(U64 hash) { return stripes[hash >> (64 - std::countr_zero(CONCURRENT_HASHMAP_STRIPES))]; }
+
+	//Readers spread over the counters by thread, the slot is picked the first time a thread reads any map
+	static inline std::atomic<U64> nextReader{ 0 };
+	static inline thread_local U64 readerSlot{ nextReader.fetch_add(1, std::memory_order_relaxed) % CONCURRENT_HASHMAP_READER_SLOTS };
+
+	std::atomic<Table*> table;
+	std::atomic<U64> size{ 0 };
+	Stripe stripes[CONCURRENT_HASHMAP_STRIPES];
+
+	//Readers count themselves under the current phase, reclaiming flips the phase and waits for the old phase's counts to drain
+	mutable ReaderCount readers[2][CONCURRENT_HASHMAP_READER_SLOTS];
+	std::atomic<U64> phase{ 0 };
+
+	std::mutex retireLock;
+	std::mutex reclaimLock;
+	Node* retiredNodes{ nullptr };
+	Table* retiredTables{ nullptr };
+	U64 retiredCount{ 0 };
+};
+
+template<class Key, class Value, class HashFunction> inline ConcurrentHashmap<Key, Value, HashFunction>::~ConcurrentHashmap()
+{
+	Table* current = table.load(std::memory_order_acquire);
+
+	for (U64 i = 0; i < current->capacity; ++i)
+	{
+		if (Node* node = current->slots[i].node.load(std::memory_order_relaxed)) { FreeNode(node); }
+	}
+
+	FreeTable(current);
+
+	for (Node* node = retiredNodes; node;)
+	{
+		Node* next = node->retired;
+		FreeNode(node);
+		node = next;
+	}
+
+	for (Table* old = retiredTables; old;)
+	{
+		Table* next = old->retired;
+		FreeTable(old);
+		old = next;
+	}
+}
+
+template<class Key, class Value, class HashFunction> inline void ConcurrentHashmap<Key, Value, HashFunction>::Reserve(U64 count)
+{
+	Table* current = table.load(std::memory_order_acquire);
+	if (Limit(current->capacity) < count) { Resize(current, count); }
+}
+
+template<class Key, class Value, class HashFunction> inline bool ConcurrentHashmap<Key, Value, HashFunction>::Insert(const Key& key, const Value& value)
+{
+	return Write<false>(key, value);
+}
+
+template<class Key, class Value, class HashFunction> inline bool ConcurrentHashmap<Key, Value, HashFunction>::Set(const Key& key, const Value& value)
+{
+	return Write<true>(key, value);
+}
+
+template<class Key, class Value, class HashFunction> inline bool ConcurrentHashmap<Key, Value, HashFunction>::Find(const Key& key, Value& value) const
+{
+	U64 hash = HashOf(key);
+	U64 readPhase = EnterRead();
+
+	Table* current = table.load(std::memory_order_acquire);
+	U64 mask = current->capacity - 1;
+	bool found = false;
+
+	for (U64 index = hash & mask;; index = (index + 1) & mask)
+	{
+		Slot& slot = current->slots[index];
+		U64 slotHash = slot.hash.load(std::memory_order_acquire);
+
+		if (!slotHash) { break; }
+		if (slotHash != hash) { continue; }
+
+		Node* node = slot.node.load(std::memory_order_acquire);
+		if (node && node->key == key)
+		{
+			value = node->value;
+			found = true;
+			break;
+		}
+	}
+
+	LeaveRead(readPhase);
+	return found;
+}
+
+template<class Key, class Value, class HashFunction> inline bool ConcurrentHashmap<Key, Value, HashFunction>::Contains(const Key& key) const
+{
+	U64 hash = HashOf(key);
+	U64 readPhase = EnterRead();
+
+	Table* current = table.load(std::memory_order_acquire);
+	U64 mask = current->capacity - 1;
+	bool found = false;
+
+	for (U64 index = hash & mask;; index = (index + 1) & mask)
+	{
+		Slot& slot = current->slots[index];
+		U64 slotHash = slot.hash.load(std::memory_order_acquire);
+
+		if (!slotHash) { break; }
+		if (slotHash != hash) { continue; }
+
+		Node* node = slot.node.load(std::memory_order_acquire);
+		if (node && node->key == key)
+		{
+			found = true;
+			break;
+		}
+	}
+
+	LeaveRead(readPhase);
+	return found;
+}
+
+template<class Key, class Value, class HashFunction> inline bool ConcurrentHashmap<Key, Value, HashFunction>::Remove(const Key& key)
+{
+	U64 hash = HashOf(key);
+	Node* removed = nullptr;
+
+	{
+		std::lock_guard<std::mutex> guard(StripeOf(hash).lock);
+
+		Table* current = table.load(std::memory_order_acquire);
+		U64 mask = current->capacity - 1;
+
+		for (U64 index = hash & mask;; index = (index + 1) & mask)
+		{
+			Slot& slot = current->slots[index];
+			U64 slotHash = slot.hash.load(std::memory_order_acquire);
+
+			if (!slotHash) { break; }
+			if (slotHash != hash) { continue; }
+
+			//Keys with this hash are only written under this stripe, so the node can't change underneath
+			Node* node = slot.node.load(std::memory_order_relaxed);
+			if (node && node->key == key)
+			{
+				slot.node.store(nullptr, std::memory_order_release);
+				size.fetch_sub(1, std::memory_order_relaxed);
+				removed = node;
+				break;
+			}
+		}
+	}
+
+	if (!removed) { return false; }
+
+	if (RetireNode(removed)) { Reclaim(); }
+
+	return true;
+}
+
+template<class Key, class Value, class HashFunction> inline U64 ConcurrentHashmap<Key, Value, HashFunction>::Capacity() const
+{
+	U64 readPhase = EnterRead();
+	U64 capacity = table.load(std::memory_order_acquire)->capacity;
+	LeaveRead(readPhase);
+
+	return capacity;
+}
+
+template<class Key, class Value, class HashFunction> inline void ConcurrentHashmap<Key, Value, HashFunction>::Reclaim()
+{
+	std::unique_lock<std::mutex> reclaimGuard(reclaimLock, std::try_to_lock);
+	if (!reclaimGuard) { return; }
+
+	Node* nodes;
+	Table* tables;
+
+	{
+		std::lock_guard<std::mutex> guard(retireLock);
+
+		nodes = retiredNodes;
+		tables = retiredTables;
+		retiredNodes = nullptr;
+		retiredTables = nullptr;
+		retiredCount = 0;
+	}
+
+	if (!nodes && !tables) { return; }
+
+	//Everything taken above was unlinked before the flip, readers that entered under the old phase are the only ones that can still see it
+	U64 oldPhase = phase.load(std::memory_order_relaxed);
+	phase.store(oldPhase ^ 1, std::memory_order_seq_cst);
+
+	//These loads are seq_cst to pair with EnterRead's increment and phase recheck, a reader either sees the new phase or is counted here
+	for (ReaderCount& reader : readers[oldPhase])
+	{
+		while (reader.count.load(std::memory_order_seq_cst)) { std::this_thread::yield(); }
+	}
+
+	for (Node* node = nodes; node;)
+	{
+		Node* next = node->retired;
+		FreeNode(node);
+		node = next;
+	}
+
+	for (Table* old = tables; old;)
+	{
+		Table* next = old->retired;
+		FreeTable(old);
+		old = next;
+	}
+}
+
+
+
+
+//Helpers
+template<class Key, class Value, class HashFunction> template<bool Replace>
+inline bool ConcurrentHashmap<Key, Value, HashFunction>::Write(const Key& key, const Value& value)
+{
+	U64 hash = HashOf(key);
+	Node* created = CreateNode(key, value);
+	Node* replaced = nullptr;
+	bool added = false;
+
+	for (;;)
+	{
+		std::unique_lock<std::mutex> guard(StripeOf(hash).lock);
+
+		Table* current = table.load(std::memory_order_acquire);
+		U64 mask = current->capacity - 1;
+		U64 index = hash & mask;
+		Slot* reuse = nullptr;
+		Node* existing = nullptr;
+
+		for (;; index = (index + 1) & mask)
+		{
+			Slot& slot = current->slots[index];
+			U64 slotHash = slot.hash.load(std::memory_order_acquire);
+
+			if (!slotHash) { break; }
+			if (slotHash != hash) { continue; }
+
+			//Keys with this hash are only written under this stripe, so the node can't change underneath
+			Node* node = slot.node.load(std::memory_order_relaxed);
+			if (!node)
+			{
+				if (!reuse) { reuse = &slot; }
+			}
+			else if (node->key == key)
+			{
+				existing = node;
+				if constexpr (Replace) { slot.node.store(created, std::memory_order_release); }
+				break;
+			}
+		}
+
+		if (existing)
+		{
+			if constexpr (Replace) { replaced = existing; }
+			else { replaced = created; }
+			break;
+		}
+
+		if (reuse)
+		{
+			reuse->node.store(created, std::memory_order_release);
+			added = true;
+			break;
+		}
+
+		//Claiming counts against the limit first, so writers racing for the last slots can't overfill the table
+		if (current->used.fetch_add(1, std::memory_order_relaxed) >= current->limit)
+		{
+			current->used.fetch_sub(1, std::memory_order_relaxed);
+			guard.unlock();
+
+			Resize(current, size.load(std::memory_order_relaxed) + 1);
+			continue;
+		}
+
+		//Writers of other stripes may take the empty slot first, the probe goes on past them
+		for (;; index = (index + 1) & mask)
+		{
+			U64 empty = 0;
+			if (current->slots[index].hash.compare_exchange_strong(empty, hash, std::memory_order_acq_rel)) { break; }
+		}
+
+		current->slots[index].node.store(created, std::memory_order_release);
+		added = true;
+		break;
+	}
+
+	if (added) { size.fetch_add(1, std::memory_order_relaxed); }
+
+	//A node that was never published is freed right away, a replaced one may still be in use by a reader
+	if (replaced == created) { FreeNode(created); }
+	else if (replaced && RetireNode(replaced)) { Reclaim(); }
+
+	return added;
+}
+
+template<class Key, class Value, class HashFunction> inline void ConcurrentHashmap<Key, Value, HashFunction>::Resize(Table* observed, U64 minimum)
+{
+	for (Stripe& stripe : stripes) { stripe.lock.lock(); }
+
+	//Another writer may have resized while this one waited for the stripes
+	Table* current = table.load(std::memory_order_acquire);
+
+	if (current == observed)
+	{
+		//Room for twice the keys, a table that is mostly removed slots is rebuilt at the same capacity
+		U64 live = size.load(std::memory_order_relaxed);
+		if (minimum < live * 2) { minimum = live * 2; }
+
+		U64 capacity = current->capacity;
+		while (Limit(capacity) < minimum) { capacity <<= 1; }
+
+		Table* grown = AllocateTable(capacity);
+		U64 mask = capacity - 1;
+		U64 used = 0;
+
+		for (U64 i = 0; i < current->capacity; ++i)
+		{
+			Node* node = current->slots[i].node.load(std::memory_order_relaxed);
+			if (!node) { continue; }
+
+			U64 hash = current->slots[i].hash.load(std::memory_order_relaxed);
+			U64 index = hash & mask;
+			while (grown->slots[index].hash.load(std::memory_order_relaxed)) { index = (index + 1) & mask; }
+
+			grown->slots[index].hash.store(hash, std::memory_order_relaxed);
+			grown->slots[index].node.store(node, std::memory_order_relaxed);
+			++used;
+		}
+
+		grown->used.store(used, std::memory_order_relaxed);
+		table.store(grown, std::memory_order_release);
+	}
+
+	for (Stripe& stripe : stripes) { stripe.lock.unlock(); }
+
+	if (current == observed && RetireTable(current)) { Reclaim(); }
+}
+
+template<class Key, class Value, class HashFunction> inline U64 ConcurrentHashmap<Key, Value, HashFunction>::EnterRead() const
+{
+	//A reader that counted itself under a phase that flipped meanwhile may not have been waited for, it counts itself again
+	for (;;)
+	{
+		U64 readPhase = phase.load(std::memory_order_seq_cst);
+		readers[readPhase][readerSlot].count.fetch_add(1, std::memory_order_seq_cst);
+
+		if (phase.load(std::memory_order_seq_cst) == readPhase) { return readPhase; }
+
+		readers[readPhase][readerSlot].count.fetch_sub(1, std::memory_order_release);
+	}
+}
+
+template<class Key, class Value, class HashFunction> inline void ConcurrentHashmap<Key, Value, HashFunction>::LeaveRead(U64 readPhase) const
+{
+	readers[readPhase][readerSlot].count.fetch_sub(1, std::memory_order_release);
+}
+
+template<class Key, class Value, class HashFunction> inline bool ConcurrentHashmap<Key, Value, HashFunction>::RetireNode(Node* node)
+{
+	std::lock_guard<std::mutex> guard(retireLock);
+
+	node->retired = retiredNodes;
+	retiredNodes = node;
+	return ++retiredCount >= CONCURRENT_HASHMAP_RETIRE_BATCH;
+}
+
+template<class Key, class Value, class HashFunction> inline bool ConcurrentHashmap<Key, Value, HashFunction>::RetireTable(Table* old)
+{
+	//A table is freed as soon as the readers allow, it's as large as every node it replaced
+	std::lock_guard<std::mutex> guard(retireLock);
+
+	old->retired = retiredTables;
+	retiredTables = old;
+	retiredCount += CONCURRENT_HASHMAP_RETIRE_BATCH;
+	return true;
+}
+
+template<class Key, class Value, class HashFunction> inline typename ConcurrentHashmap<Key, Value, HashFunction>::Table* ConcurrentHashmap<Key, Value, HashFunction>::AllocateTable(U64 capacity)
+{
+	//The slots follow the table header in one block
+	Table* created = (Table*)malloc(sizeof(Table) + capacity * sizeof(Slot));
+	Slot* slots = (Slot*)(created + 1);
+
+	for (U64 i = 0; i < capacity; ++i) { new (&slots[i]) Slot{ 0, nullptr }; }
+
+	return new (created) Table{ slots, capacity, Limit(capacity), 0, nullptr };
+}
+
+template<class Key, class Value, class HashFunction> inline void ConcurrentHashmap<Key, Value, HashFunction>::FreeTable(Table* old)
+{
+	old->~Table();
+	free(old);
+}
+
+template<class Key, class Value, class HashFunction> inline typename ConcurrentHashmap<Key, Value, HashFunction>::Node* ConcurrentHashmap<Key, Value, HashFunction>::CreateNode(const Key& key, const Value& value)
+{
+	return new (malloc(sizeof(Node))) Node{ key, value, nullptr };
+}
+
+template<class Key, class Value, class HashFunction> inline void ConcurrentHashmap<Key, Value, HashFunction>::FreeNode(Node* node)
+{
+	node->~Node();
+	free(node);
+}
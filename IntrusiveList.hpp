@@ -0,0 +1,356 @@
+#pragma once
+
+#include "ContainerDefines.hpp"
+
+/// <summary>
+/// Links embedded in an object so it can be placed in an IntrusiveList without any allocation, an object can be in one list per hook
+/// Copies of an object start unlinked and an object that is destroyed while linked unlinks itself
+/// </summary>
+struct ListHook
+{
+	ListHook() {}
+	ListHook(const ListHook&) {}
+	ListHook& operator=(const ListHook&) { return *this; }
+	~ListHook() { Unlink(); }
+
+	/// <returns>Whether the object is in a list</returns>
+	bool Linked() const { return next != nullptr; }
+
+	/// <summary>
+	/// Removes the object from whichever list holds it in constant time, does nothing if it isn't linked
+	/// </summary>
+	void Unlink()
+	{
+		if (!next) { return; }
+
+		prev->next = next;
+		next->prev = prev;
+		next = nullptr;
+		prev = nullptr;
+	}
+
+	ListHook* next{ nullptr };
+	ListHook* prev{ nullptr };
+};
+
+/// <summary>
+/// Doubly linked list of objects that embed a ListHook, the list links the objects themselves instead of copying them into nodes
+/// The list doesn't own its objects, they must outlive their time in it, Size walks the list since objects can unlink themselves
+/// </summary>
+template<class T, ListHook T::* Hook>
+struct IntrusiveList
+{
+	static_assert(std::is_standard_layout_v<T>, "The hook is found from its offset, which is only fixed for standard layout types");
+
+	struct Iterator
+	{
+	public:
+		Iterator(ListHook* hook) : hook{ hook } {}
+
+		T& operator* () const { return *Owner(hook); }
+		T* operator-> () { return Owner(hook); }
+
+		Iterator& operator++ () { hook = hook->next; return *this; }
+		Iterator& operator-- () { hook = hook->prev; return *this; }
+
+		Iterator operator++ (int)
+		{
+			Iterator temp = *this;
+			hook = hook->next;
+			return temp;
+		}
+
+		Iterator operator-- (int)
+		{
+			Iterator temp = *this;
+			hook = hook->prev;
+			return temp;
+		}
+
+		friend bool operator== (const Iterator& a, const Iterator& b) { return a.hook == b.hook; }
+		friend bool operator!= (const Iterator& a, const Iterator& b) { return a.hook != b.hook; }
+
+	private:
+		ListHook* hook;
+
+		friend struct IntrusiveList;
+	};
+
+public:
+	IntrusiveList();
+	IntrusiveList(IntrusiveList&& other) noexcept;
+	IntrusiveList& operator=(IntrusiveList&& other) noexcept;
+	IntrusiveList(const IntrusiveList&) = delete;
+	IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+	~IntrusiveList();
+
+	/// <summary>
+	/// Unlinks every object, the objects themselves are untouched
+	/// </summary>
+	void Clear();
+
+	/// <summary>
+	/// Links object at the back, object must not be in another list through the same hook
+	/// </summary>
+	void PushBack(T& object);
+	void PushFront(T& object);
+	void PopBack();
+	void PopFront();
+
+	/// <summary>
+	/// Links object after position, at end it's linked at the back
+	/// </summary>
+	void InsertBack(Iterator& position, T& object);
+
+	/// <summary>
+	/// Links object before position
+	/// </summary>
+	void InsertFront(Iterator& position, T& object);
+
+	/// <summary>
+	/// Unlinks object in constant time, object must be in this list
+	/// </summary>
+	void Remove(T& object);
+
+	/// <summary>
+	/// Unlinks the object at position, position is moved to the object after it
+	/// </summary>
+	void Remove(Iterator& position);
+	template<typename Predicate> U64 RemoveIf(Predicate predicate);
+
+	/// <summary>
+	/// Unlinks object from whichever list holds it, only the object is needed
+	/// </summary>
+	static void Unlink(T& object) { (object.*Hook).Unlink(); }
+
+	/// <summary>
+	/// Moves every object of other before position in constant time, other is left empty
+	/// </summary>
+	void Splice(Iterator& position, IntrusiveList& other);
+	void Splice(U64 index, IntrusiveList& other);
+
+	/// <summary>
+	/// Merges the sorted objects of other into this sorted list by relinking them, stable and linear, other is left empty
+	/// </summary>
+	void Merge(IntrusiveList& other);
+	template<typename Compare> void Merge(IntrusiveList& other, Compare compare);
+
+	Iterator begin() { return { root.next }; }
+	Iterator end() { return { &root }; }
+	Iterator begin() const { return { root.next }; }
+	Iterator end() const { return { (ListHook*)&root }; }
+
+	bool Empty() const { return root.next == &root; }
+	U64 Size() const;
+	T& Front() { return *Owner(root.next); }
+	const T& Front() const { return *Owner(root.next); }
+	T& Back() { return *Owner(root.prev); }
+	const T& Back() const { return *Owner(root.prev); }
+
+private:
+	static inline T* Owner(ListHook* hook);
+	static inline void LinkBefore(ListHook* position, ListHook* hook);
+	inline void Reset();
+
+	ListHook root;
+};
+
+template<class T, ListHook T::* Hook> inline IntrusiveList<T, Hook>::IntrusiveList()
+{
+	Reset();
+}
+
+template<class T, ListHook T::* Hook> inline IntrusiveList<T, Hook>::IntrusiveList(IntrusiveList&& other) noexcept
+{
+	Reset();
+
+	Iterator position = end();
+	Splice(position, other);
+}
+
+template<class T, ListHook T::* Hook> inline IntrusiveList<T, Hook>& IntrusiveList<T, Hook>::operator=(IntrusiveList&& other) noexcept
+{
+	if (&other == this) { return *this; }
+
+	Clear();
+
+	Iterator position = end();
+	Splice(position, other);
+
+	return *this;
+}
+
+template<class T, ListHook T::* Hook> inline IntrusiveList<T, Hook>::~IntrusiveList()
+{
+	Clear();
+	root.next = nullptr;
+}
+
+template<class T, ListHook T::* Hook> inline void IntrusiveList<T, Hook>::Clear()
+{
+	for (ListHook* hook = root.next; hook != &root;)
+	{
+		ListHook* next = hook->next;
+		hook->next = nullptr;
+		hook->prev = nullptr;
+		hook = next;
+	}
+
+	Reset();
+}
+
+template<class T, ListHook T::* Hook> inline void IntrusiveList<T, Hook>::PushBack(T& object)
+{
+	LinkBefore(&root, &(object.*Hook));
+}
+
+template<class T, ListHook T::* Hook> inline void IntrusiveList<T, Hook>::PushFront(T& object)
+{
+	LinkBefore(root.next, &(object.*Hook));
+}
+
+template<class T, ListHook T::* Hook> inline void IntrusiveList<T, Hook>::PopBack()
+{
+	if (!Empty()) { root.prev->Unlink(); }
+}
+
+template<class T, ListHook T::* Hook> inline void IntrusiveList<T, Hook>::PopFront()
+{
+	if (!Empty()) { root.next->Unlink(); }
+}
+
+template<class T, ListHook T::* Hook> inline void IntrusiveList<T, Hook>::InsertBack(Iterator& position, T& object)
+{
+	//The root follows the last object, so after end is the front
+	LinkBefore(position.hook == &root ? &root : position.hook->next, &(object.*Hook));
+}
+
+template<class T, ListHook T::* Hook> inline void IntrusiveList<T, Hook>::InsertFront(Iterator& position, T& object)
+{
+	LinkBefore(position.hook, &(object.*Hook));
+}
+
+template<class T, ListHook T::* Hook> inline void IntrusiveList<T, Hook>::Remove(T& object)
+{
+	(object.*Hook).Unlink();
+}
+
+template<class T, ListHook T::* Hook> inline void IntrusiveList<T, Hook>::Remove(Iterator& position)
+{
+	if (position.hook == &root) { return; }
+
+	ListHook* hook = position.hook;
+	position.hook = hook->next;
+	hook->Unlink();
+}
+
+template<class T, ListHook T::* Hook> template<typename Predicate> inline U64 IntrusiveList<T, Hook>::RemoveIf(Predicate predicate)
+{
+	U64 removed = 0;
+
+	for (ListHook* hook = root.next; hook != &root;)
+	{
+		ListHook* next = hook->next;
+
+		if (predicate(*Owner(hook)))
+		{
+			hook->Unlink();
+			++removed;
+		}
+
+		hook = next;
+	}
+
+	return removed;
+}
+
+template<class T, ListHook T::* Hook> inline void IntrusiveList<T, Hook>::Splice(Iterator& position, IntrusiveList& other)
+{
+	if (&other == this || other.Empty()) { return; }
+
+	ListHook* first = other.root.next;
+	ListHook* last = other.root.prev;
+	ListHook* after = position.hook;
+	ListHook* before = after->prev;
+
+	before->next = first;
+	first->prev = before;
+	last->next = after;
+	after->prev = last;
+
+	other.Reset();
+}
+
+template<class T, ListHook T::* Hook> inline void IntrusiveList<T, Hook>::Splice(U64 index, IntrusiveList& other)
+{
+	Iterator position = begin();
+	for (U64 i = 0; i < index && position.hook != &root; ++i) { ++position; }
+
+	Splice(position, other);
+}
+
+template<class T, ListHook T::* Hook> inline void IntrusiveList<T, Hook>::Merge(IntrusiveList& other)
+{
+	Merge(other, [](const T& a, const T& b) { return a < b; });
+}
+
+template<class T, ListHook T::* Hook> template<typename Compare> inline void IntrusiveList<T, Hook>::Merge(IntrusiveList& other, Compare compare)
+{
+	if (&other == this) { return; }
+
+	ListHook* position = root.next;
+
+	//Objects of other only move in front of strictly greater ones, so equal objects keep this list's first
+	while (position != &root && !other.Empty())
+	{
+		ListHook* hook = other.root.next;
+
+		if (compare(*Owner(hook), *Owner(position)))
+		{
+			hook->Unlink();
+			LinkBefore(position, hook);
+		}
+		else { position = position->next; }
+	}
+
+	Iterator back = end();
+	Splice(back, other);
+}
+
+template<class T, ListHook T::* Hook> inline U64 IntrusiveList<T, Hook>::Size() const
+{
+	U64 size = 0;
+	for (const ListHook* hook = root.next; hook != &root; hook = hook->next) { ++size; }
+
+	return size;
+}
+
+
+
+//Helpers
+template<class T, ListHook T::* Hook> inline T* IntrusiveList<T, Hook>::Owner(ListHook* hook)
+{
+	//A data member pointer starts with the member's offset on both MSVC and the Itanium ABI, the copy folds to a constant
+	static_assert(sizeof(Hook) >= sizeof(I32));
+
+	ListHook T::* member = Hook;
+	I32 offset;
+	memcpy(&offset, &member, sizeof(I32));
+
+	return (T*)((U8*)hook - offset);
+}
+
+template<class T, ListHook T::* Hook> inline void IntrusiveList<T, Hook>::LinkBefore(ListHook* position, ListHook* hook)
+{
+	hook->next = position;
+	hook->prev = position->prev;
+	position->prev->next = hook;
+	position->prev = hook;
+}
+
+template<class T, ListHook T::* Hook> inline void IntrusiveList<T, Hook>::Reset()
+{
+	root.next = &root;
+	root.prev = &root;
+}
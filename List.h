@@ -1,13 +1,22 @@
 #pragma once
 
 #include "ContainerDefines.hpp"
+#include "NodePool.hpp"
 
+#include <new>
+#include <utility>
+#include <type_traits>
+
+/// <summary>
+/// Doubly linked list, nodes are carved from slabs owned by the list, recycled when erased and released together by Destroy
+/// </summary>
 template<typename T>
 struct List
 {
 	struct Node
 	{
 		Node(const T& value) : value{ value }, next{ nullptr }, prev{ nullptr } {}
+		Node(T&& value) : value{ std::move(value) }, next{ nullptr }, prev{ nullptr } {}
 
 		T value;
 		Node* next;
@@ -77,6 +86,8 @@ struct List
 
 	private:
 		Node* ptr;
+
+		friend struct List;
 	};
 
 public:
@@ -87,9 +98,16 @@ public:
 	List& operator=(List&& other);
 
 	~List();
+
+	/// <summary>
+	/// Destroys every value and releases all node slabs at once
+	/// </summary>
 	void Destroy();
-	void* operator new(U64 size);
-	void operator delete(void* ptr);
+
+	/// <summary>
+	/// Makes room for count more nodes in one contiguous slab, so values appended in order afterwards are adjacent in memory
+	/// </summary>
+	void Reserve(U64 count);
 
 	void PushBack(const T& value);
 	void PushBack(T&& value);
@@ -103,6 +121,10 @@ public:
 	void InsertFront(Iterator& position, const T& value);
 	void InsertBack(Iterator& position, T&& value);
 	void InsertFront(Iterator& position, T&& value);
+
+	/// <summary>
+	/// Inserts copies of the values of other, the overloads taking an rvalue list splice its nodes in constant time instead
+	/// </summary>
 	void Insert(U64 index, const List& other);
 	void InsertBack(Iterator& position, const List& other);
 	void InsertBack(Iterator& position, List&& other);
@@ -110,6 +132,10 @@ public:
 	void InsertFront(Iterator& position, List&& other);
 	void Remove(U64 index);
 	void Remove(Iterator& position);
+
+	/// <summary>
+	/// Removes the values from start up to but not including end, start is moved to end
+	/// </summary>
 	void Remove(Iterator& start, Iterator& end);
 	void RemoveAll(const T& value);
 
@@ -119,10 +145,28 @@ public:
 	template<T... Args> void Insert(Iterator& position, const Args&... args);*/
 	template<typename Predicate> U64 RemoveIf(Predicate);
 
+	/// <summary>
+	/// Reverses the order of the values by swapping the links of every node, no value is moved
+	/// </summary>
 	void Reverse();
+
+	/// <summary>
+	/// Moves every node of other before position in constant time, other is left empty and its node slabs are handed to this list
+	/// </summary>
 	void Splice(U64 index, List& other);
 	void Splice(Iterator& position, List& other);
+
+	/// <summary>
+	/// Merges the sorted values of other into this sorted list by relinking nodes, stable and linear, other is left empty
+	/// </summary>
 	void Merge(List& other);
+	template<typename Compare> void Merge(List& other, Compare compare);
+
+	/// <summary>
+	/// Stable bottom-up merge sort that relinks nodes in place, never allocates and never moves a value
+	/// </summary>
+	void Sort();
+	template<typename Compare> void Sort(Compare compare);
 
 	Iterator begin() { return { head }; }
 	Iterator end() { if (tail) { return { tail->next }; } return { tail }; }
@@ -139,24 +183,28 @@ private:
 	U64 size;
 	Node* head;
 	Node* tail;
+	NodePool<Node> pool;
 
+	template<typename Value> inline Node* CreateNode(Value&& value);
+	inline void LinkBack(Node* node);
+	inline void LinkFront(Node* node);
+	inline void LinkAfter(Node* position, Node* node);
+	inline void LinkBefore(Node* position, Node* node);
 	inline void EraseNode(Node* node);
+	inline void SpliceBefore(Node* position, List& other);
+	template<typename Compare> static inline Node* MergeRuns(Node* a, Node* aTail, Node* b, Node* bTail, Node*& mergedTail, Compare& compare);
 };
 
 template<typename T> inline List<T>::List() : size{ 0 }, head{ nullptr }, tail{ nullptr } {}
 
-template<typename T> inline List<T>::List(const List<T>& other) : size{ other.size }, head{ nullptr }, tail{ nullptr }
+template<typename T> inline List<T>::List(const List<T>& other) : size{ 0 }, head{ nullptr }, tail{ nullptr }
 {
-	Node* node = other.head;
-	Node* newNode = head;
-	while (node)
-	{
-		PushBack(node->value);
-		node->next;
-	}
+	pool.Reserve(other.size);
+
+	for (Node* node = other.head; node; node = node->next) { PushBack(node->value); }
 }
 
-template<typename T> inline List<T>::List(List<T>&& other) : size{ other.size }, head{ other.head }, tail{ other.tail }
+template<typename T> inline List<T>::List(List<T>&& other) : size{ other.size }, head{ other.head }, tail{ other.tail }, pool{ std::move(other.pool) }
 {
 	other.head = nullptr;
 	other.tail = nullptr;
@@ -165,293 +213,170 @@ template<typename T> inline List<T>::List(List<T>&& other) : size{ other.size },
 
 template<typename T> inline List<T>& List<T>::operator=(const List<T>& other)
 {
-	size = other.size;
+	if (&other == this) { return *this; }
 
-	Node* node = other.head;
-	while (node)
-	{
-		PushBack(node->value);
-		node->next;
-	}
+	Destroy();
+	pool.Reserve(other.size);
+
+	for (Node* node = other.head; node; node = node->next) { PushBack(node->value); }
+
+	return *this;
 }
 
 template<typename T> inline List<T>& List<T>::operator=(List<T>&& other)
 {
+	if (&other == this) { return *this; }
+
+	Destroy();
+
 	head = other.head;
 	tail = other.tail;
 	size = other.size;
+	pool = std::move(other.pool);
 
 	other.head = nullptr;
 	other.tail = nullptr;
 	other.size = 0;
+
+	return *this;
 }
 
 template<typename T> inline List<T>::~List()
 {
-
+	Destroy();
 }
 
 template<typename T> inline void List<T>::Destroy()
 {
+	if constexpr (!std::is_trivially_destructible_v<T>)
+	{
+		for (Node* node = head; node; node = node->next) { node->~Node(); }
+	}
 
-}
-
-template<typename T> inline void* List<T>::operator new(U64 size)
-{
+	pool.Destroy();
 
+	head = nullptr;
+	tail = nullptr;
+	size = 0;
 }
 
-template<typename T> inline void List<T>::operator delete(void* ptr)
+template<typename T> inline void List<T>::Reserve(U64 count)
 {
-
+	pool.Reserve(count);
 }
 
 template<typename T> inline void List<T>::PushBack(const T& value)
 {
-	Node* newNode = (Node*)malloc(sizeof(Node));
-	newNode->value = value;
-	newNode->next = nullptr;
-	++size;
-
-	if (head)
-	{
-		tail->next = newNode;
-		newNode->prev = tail;
-	}
-	else
-	{
-		head = newNode;
-		head->prev = nullptr;
-	}
-
-	tail = newNode;
+	LinkBack(CreateNode(value));
 }
 
 template<typename T> inline void List<T>::PushBack(T&& value)
 {
-	Node* newNode = (Node*)malloc(sizeof(Node));
-	newNode->value = Move(value);
-	newNode->next = nullptr;
-	++size;
-
-	if (head)
-	{
-		tail->next = newNode;
-		newNode->prev = tail;
-	}
-	else 
-	{ 
-		head = newNode;
-		head->prev = nullptr;
-	}
-
-	tail = newNode;
+	LinkBack(CreateNode(std::move(value)));
 }
 
 template<typename T> inline void List<T>::PopBack()
 {
-	if (size)
-	{
-		Node* node = tail;
-		tail = tail->prev;
-		EraseNode(node);
-	}
+	if (size) { EraseNode(tail); }
 }
 
 template<typename T> inline void List<T>::PushFront(const T& value)
 {
-	Node* newNode = (Node*)malloc(sizeof(Node));
-	newNode->value = value;
-	newNode->prev = nullptr;
-	++size;
-
-	if (head)
-	{
-		head->prev = newNode;
-		newNode->next = head;
-	}
-	else 
-	{ 
-		tail = newNode; 
-		tail->next = nullptr;
-	}
-
-	head = newNode;
+	LinkFront(CreateNode(value));
 }
 
 template<typename T> inline void List<T>::PushFront(T&& value)
 {
-	Node* newNode = (Node*)malloc(sizeof(Node));
-	newNode->value = Move(value);
-	newNode->prev = nullptr;
-	++size;
-
-	if (head)
-	{
-		head->prev = newNode;
-		newNode->next = head;
-	}
-	else
-	{
-		tail = newNode;
-		tail->next = nullptr;
-	}
-
-	head = newNode;
+	LinkFront(CreateNode(std::move(value)));
 }
 
 template<typename T> inline void List<T>::PopFront()
 {
-	if (size)
-	{
-		Node* node = head;
-		head = head->next;
-		EraseNode(node);
-	}
+	if (size) { EraseNode(head); }
 }
 
 template<typename T> inline void List<T>::Insert(U64 index, const T& value)
 {
 	if (index == 0) { PushFront(value); }
-	else if (index == size) { PushBack(value); }
+	else if (index >= size) { PushBack(value); }
 	else
 	{
 		Node* node = head;
 		for (U64 i = 1; i < index; ++i) { node = node->next; }
 
-		Node* newNode = (Node*)malloc(sizeof(Node));
-		newNode->value = value;
-
-		node->next->prev = newNode;
-		newNode->next = node->next;
-		node->next = newNode;
-		newNode->prev = node;
-
-		++size;
+		LinkAfter(node, CreateNode(value));
 	}
 }
 
 template<typename T> inline void List<T>::Insert(U64 index, T&& value)
 {
-	if (index == 0) { PushFront(value); }
-	else if (index == size) { PushBack(value); }
+	if (index == 0) { PushFront(std::move(value)); }
+	else if (index >= size) { PushBack(std::move(value)); }
 	else
 	{
 		Node* node = head;
 		for (U64 i = 1; i < index; ++i) { node = node->next; }
 
-		Node* newNode = (Node*)malloc(sizeof(Node));
-		newNode->value = Move(value);
-
-		node->next->prev = newNode;
-		newNode->next = node->next;
-		node->next = newNode;
-		newNode->prev = node;
-
-		++size;
+		LinkAfter(node, CreateNode(std::move(value)));
 	}
 }
 
 template<typename T> inline void List<T>::InsertBack(Iterator& position, const T& value)
 {
-	if (position == end() || position == end() - 1) { PushBack(); }
-	else
-	{
-		Node* node = position->ptr;
-		Node* newNode = (Node*)malloc(sizeof(Node));
-		newNode->value = value;
-
-		node->next->prev = newNode;
-		newNode->next = node->next;
-		node->next = newNode;
-		newNode->prev = node;
-
-		++size;
-	}
+	if (!position.ptr) { PushBack(value); }
+	else { LinkAfter(position.ptr, CreateNode(value)); }
 }
 
 template<typename T> inline void List<T>::InsertFront(Iterator& position, const T& value)
 {
-	if (position == begin()) { PushFront(); }
-	else if (position == end()) { PushBack(); }
-	else
-	{
-		Node* node = position->ptr;
-		Node* newNode = (Node*)malloc(sizeof(Node));
-		newNode->value = value;
-
-		node->prev->next = newNode;
-		newNode->prev = node->prev;
-		node->prev = newNode;
-		newNode->next = node;
-
-		++size;
-	}
+	if (!position.ptr) { PushBack(value); }
+	else { LinkBefore(position.ptr, CreateNode(value)); }
 }
 
 template<typename T> inline void List<T>::InsertBack(Iterator& position, T&& value)
 {
-	if (position == end() || position == end() - 1) { PushBack(); }
-	else
-	{
-		Node* node = position->ptr;
-		Node* newNode = (Node*)malloc(sizeof(Node));
-		newNode->value = Move(value);
-
-		node->next->prev = newNode;
-		newNode->next = node->next;
-		node->next = newNode;
-		newNode->prev = node;
-
-		++size;
-	}
+	if (!position.ptr) { PushBack(std::move(value)); }
+	else { LinkAfter(position.ptr, CreateNode(std::move(value))); }
 }
 
 template<typename T> inline void List<T>::InsertFront(Iterator& position, T&& value)
 {
-	if (position == begin()) { PushFront(); }
-	else
-	{
-		Node* node = position->ptr;
-		Node* newNode = (Node*)malloc(sizeof(Node));
-		newNode->value = Move(value);
-
-		node->prev->next = newNode;
-		newNode->prev = node->prev;
-		node->prev = newNode;
-		newNode->next = node;
-
-		++size;
-	}
+	if (!position.ptr) { PushBack(std::move(value)); }
+	else { LinkBefore(position.ptr, CreateNode(std::move(value))); }
 }
 
 template<typename T> inline void List<T>::Insert(U64 index, const List<T>& other)
 {
-
+	List<T> copy(other);
+	Splice(index, copy);
 }
 
 template<typename T> inline void List<T>::InsertBack(Iterator& position, const List<T>& other)
 {
-
+	List<T> copy(other);
+	SpliceBefore(position.ptr ? position.ptr->next : nullptr, copy);
 }
 
 template<typename T> inline void List<T>::InsertBack(Iterator& position, List<T>&& other)
 {
-
+	SpliceBefore(position.ptr ? position.ptr->next : nullptr, other);
 }
 
 template<typename T> inline void List<T>::InsertFront(Iterator& position, const List<T>& other)
 {
-
+	List<T> copy(other);
+	SpliceBefore(position.ptr, copy);
 }
 
 template<typename T> inline void List<T>::InsertFront(Iterator& position, List<T>&& other)
 {
-
+	SpliceBefore(position.ptr, other);
 }
 
 template<typename T> inline void List<T>::Remove(U64 index)
 {
+	if (index >= size) { return; }
+
 	Node* node = head;
 	for (U64 i = 0; i < index; ++i) { node = node->next; }
 
@@ -460,17 +385,33 @@ template<typename T> inline void List<T>::Remove(U64 index)
 
 template<typename T> inline void List<T>::Remove(Iterator& position)
 {
+	Node* node = position.ptr;
+	if (!node) { return; }
 
+	position.ptr = node->next;
+	EraseNode(node);
 }
 
 template<typename T> inline void List<T>::Remove(Iterator& start, Iterator& end)
 {
+	for (Node* node = start.ptr; node && node != end.ptr;)
+	{
+		Node* next = node->next;
+		EraseNode(node);
+		node = next;
+	}
 
+	start.ptr = end.ptr;
 }
 
 template<typename T> inline void List<T>::RemoveAll(const T& value)
 {
-
+	for (Node* node = head; node;)
+	{
+		Node* next = node->next;
+		if (node->value == value) { EraseNode(node); }
+		node = next;
+	}
 }
 
 //template<typename T> template<T... Args> inline void List<T>::PushBack(const Args&... args)
@@ -504,8 +445,9 @@ template<typename T> template<typename Predicate> inline U64 List<T>::RemoveIf(P
 		if (predicate(value))
 		{
 			++removed;
+			Node* node = it.ptr;
 			++it;
-			EraseNode(it.ptr);
+			EraseNode(node);
 		}
 		else { ++it; }
 	}
@@ -515,24 +457,161 @@ template<typename T> template<typename Predicate> inline U64 List<T>::RemoveIf(P
 
 template<typename T> inline void List<T>::Reverse()
 {
+	for (Node* node = head; node; node = node->prev)
+	{
+		Node* next = node->next;
+		node->next = node->prev;
+		node->prev = next;
+	}
 
+	Node* first = head;
+	head = tail;
+	tail = first;
 }
 
 template<typename T> inline void List<T>::Splice(U64 index, List<T>& other)
 {
+	Node* position = nullptr;
+
+	if (index < size)
+	{
+		position = head;
+		for (U64 i = 0; i < index; ++i) { position = position->next; }
+	}
 
+	SpliceBefore(position, other);
 }
 
 template<typename T> inline void List<T>::Splice(Iterator& position, List<T>& other)
 {
-
+	SpliceBefore(position.ptr, other);
 }
 
 template<typename T> inline void List<T>::Merge(List<T>& other)
 {
+	Merge(other, [](const T& a, const T& b) { return a < b; });
+}
+
+template<typename T> template<typename Compare> inline void List<T>::Merge(List<T>& other, Compare compare)
+{
+	if (&other == this || !other.head) { return; }
+	if (!head) { SpliceBefore(nullptr, other); return; }
+
+	head = MergeRuns(head, tail, other.head, other.tail, tail, compare);
+	size += other.size;
+	pool.Take(other.pool);
+
+	other.head = nullptr;
+	other.tail = nullptr;
+	other.size = 0;
+}
+
+template<typename T> inline void List<T>::Sort()
+{
+	Sort([](const T& a, const T& b) { return a < b; });
+}
+
+template<typename T> template<typename Compare> inline void List<T>::Sort(Compare compare)
+{
+	if (size < 2) { return; }
+
+	//runs[i] holds a sorted run of 2^i nodes, each node is carried into the runs like a bit into a binary counter,
+	//so runs are merged while they are still small and hot in cache, 64 runs cover any list
+	Node* runs[64]{};
+	Node* tails[64]{};
+	U64 count = 0;
+
+	for (Node* node = head; node;)
+	{
+		Node* run = node;
+		Node* runTail = node;
+		node = node->next;
+		run->next = nullptr;
+		run->prev = nullptr;
+
+		U64 i = 0;
+		for (; runs[i]; ++i)
+		{
+			run = MergeRuns(runs[i], tails[i], run, runTail, runTail, compare);
+			runs[i] = nullptr;
+		}
+
+		runs[i] = run;
+		tails[i] = runTail;
+		if (i >= count) { count = i + 1; }
+	}
+
+	//Higher runs hold earlier nodes, so they go first in every merge to keep equal values in order
+	Node* sorted = nullptr;
+	Node* sortedTail = nullptr;
+	for (U64 i = 0; i < count; ++i)
+	{
+		if (!runs[i]) { continue; }
+
+		if (sorted) { sorted = MergeRuns(runs[i], tails[i], sorted, sortedTail, sortedTail, compare); }
+		else
+		{
+			sorted = runs[i];
+			sortedTail = tails[i];
+		}
+	}
+
+	head = sorted;
+	tail = sortedTail;
+}
+
+
+
+
+//Helpers
+template<typename T> template<typename Value> inline typename List<T>::Node* List<T>::CreateNode(Value&& value)
+{
+	return new (pool.Allocate()) Node(std::forward<Value>(value));
+}
+
+template<typename T> inline void List<T>::LinkBack(Node* node)
+{
+	node->prev = tail;
+
+	if (tail) { tail->next = node; }
+	else { head = node; }
+
+	tail = node;
+	++size;
+}
+
+template<typename T> inline void List<T>::LinkFront(Node* node)
+{
+	node->next = head;
+
+	if (head) { head->prev = node; }
+	else { tail = node; }
+
+	head = node;
+	++size;
+}
+
+template<typename T> inline void List<T>::LinkAfter(Node* position, Node* node)
+{
+	if (position == tail) { LinkBack(node); return; }
 
+	node->prev = position;
+	node->next = position->next;
+	position->next->prev = node;
+	position->next = node;
+	++size;
 }
 
+template<typename T> inline void List<T>::LinkBefore(Node* position, Node* node)
+{
+	if (position == head) { LinkFront(node); return; }
+
+	node->next = position;
+	node->prev = position->prev;
+	position->prev->next = node;
+	position->prev = node;
+	++size;
+}
 
 template<typename T> inline void List<T>::EraseNode(Node* node)
 {
@@ -542,6 +621,78 @@ template<typename T> inline void List<T>::EraseNode(Node* node)
 	if (node->prev) { node->prev->next = node->next; }
 	else { head = node->next; }
 
-	free(node);
+	node->~Node();
+	pool.Free(node);
 	--size;
-}
\ No newline at end of file
+}
+
+template<typename T> inline void List<T>::SpliceBefore(Node* position, List& other)
+{
+	if (&other == this || !other.head) { return; }
+
+	Node* first = other.head;
+	Node* last = other.tail;
+
+	if (!position)
+	{
+		first->prev = tail;
+		if (tail) { tail->next = first; }
+		else { head = first; }
+		tail = last;
+	}
+	else
+	{
+		first->prev = position->prev;
+		if (position->prev) { position->prev->next = first; }
+		else { head = first; }
+
+		last->next = position;
+		position->prev = last;
+	}
+
+	size += other.size;
+	pool.Take(other.pool);
+
+	other.head = nullptr;
+	other.tail = nullptr;
+	other.size = 0;
+}
+
+template<typename T> template<typename Compare> inline typename List<T>::Node* List<T>::MergeRuns(Node* a, Node* aTail, Node* b, Node* bTail, Node*& mergedTail, Compare& compare)
+{
+	//Merges two null terminated runs and links both directions while each node is being touched anyway, a holds the earlier nodes and wins ties
+	Node* first;
+	Node* last;
+
+	if (compare(b->value, a->value)) { first = b; b = b->next; }
+	else { first = a; a = a->next; }
+
+	first->prev = nullptr;
+	last = first;
+
+	while (a && b)
+	{
+		Node* node;
+		if (compare(b->value, a->value)) { node = b; b = b->next; }
+		else { node = a; a = a->next; }
+
+		last->next = node;
+		node->prev = last;
+		last = node;
+	}
+
+	if (a)
+	{
+		last->next = a;
+		a->prev = last;
+		mergedTail = aTail;
+	}
+	else
+	{
+		last->next = b;
+		if (b) { b->prev = last; mergedTail = bTail; }
+		else { mergedTail = last; }
+	}
+
+	return first;
+}
@@ -0,0 +1,276 @@
+#pragma once
+
+#include "ContainerDefines.hpp"
+#include "List.h"
+
+#include <stdlib.h>
+#include <new>
+#include <utility>
+#include <atomic>
+#include <thread>
+#include <type_traits>
+
+static inline constexpr U64 MPSC_LIST_SPINS = 64;	//Times PopAll spins on a link that is still being published before yielding to the producer
+
+/// <summary>
+/// Linked queue any number of threads can push to without locking while one consumer takes everything pushed so far at once
+/// A push is one atomic exchange on the tail followed by a store of the back link, PopAll detaches the whole chain with one exchange
+/// and restores the forward links, a producer paused between its exchange and its store delays PopAll until it resumes
+/// Nodes have the List node layout, so a batch is iterated with List iterators, freed batches are recycled into a cache each producer thread takes whole
+/// </summary>
+template<typename T>
+struct MPSCList
+{
+	using Node = typename List<T>::Node;
+	using Iterator = typename List<T>::Iterator;
+
+	/// <summary>
+	/// Chain of nodes taken by PopAll, in the order they were pushed, the batch owns the nodes and recycles them when destroyed
+	/// </summary>
+	struct Batch
+	{
+	public:
+		Batch() : head{ nullptr }, tail{ nullptr }, size{ 0 } {}
+		Batch(Batch&& other) noexcept : head{ other.head }, tail{ other.tail }, size{ other.size } { other.head = nullptr; other.tail = nullptr; other.size = 0; }
+		Batch& operator=(Batch&& other) noexcept;
+		Batch(const Batch&) = delete;
+		Batch& operator=(const Batch&) = delete;
+
+		~Batch() { Destroy(); }
+
+		/// <summary>
+		/// Destroys every value and recycles every node
+		/// </summary>
+		void Destroy();
+
+		/// <summary>
+		/// Moves every value to the back of list and recycles the nodes
+		/// </summary>
+		void MoveTo(List<T>& list);
+
+		Iterator begin() const { return { head }; }
+		Iterator end() const { return { nullptr }; }
+
+		bool Empty() const { return !head; }
+		U64 Size() const { return size; }
+		T& Front() { return head->value; }
+		const T& Front() const { return head->value; }
+		T& Back() { return tail->value; }
+		const T& Back() const { return tail->value; }
+
+	private:
+		Node* head;
+		Node* tail;
+		U64 size;
+
+		friend struct MPSCList;
+	};
+
+public:
+	MPSCList() {}
+	MPSCList(const MPSCList&) = delete;
+	MPSCList& operator=(const MPSCList&) = delete;
+
+	~MPSCList();
+
+	/// <summary>
+	/// Pushes value to the back, safe to call from any number of threads at once
+	/// </summary>
+	void PushBack(const T& value);
+	void PushBack(T&& value);
+
+	/// <summary>
+	/// Takes every value pushed so far in push order, only one thread may call it at a time
+	/// </summary>
+	Batch PopAll();
+
+	/// <summary>
+	/// Moves every value pushed so far to the back of list
+	/// </summary>
+	void PopAll(List<T>& list);
+
+	/// <returns>Whether nothing was pushed since the last PopAll, only a hint while producers are running</returns>
+	bool Empty() const { return !tail.load(std::memory_order_relaxed); }
+
+private:
+	//Nodes of freed batches, shared by every list of T, producers take the whole chain at once so popping can't suffer ABA
+	struct Recycled
+	{
+		~Recycled() { FreeChain(top.load(std::memory_order_acquire)); }
+
+		std::atomic<Node*> top{ nullptr };
+	};
+
+	//Nodes a producer thread took from the recycled chain, freed when the thread exits
+	struct Cache
+	{
+		~Cache() { FreeChain(nodes); }
+
+		Node* nodes{ nullptr };
+	};
+
+	template<typename Value> inline void Push(Value&& value);
+	static inline Node* AllocateNode();
+	static inline void RecycleChain(Node* first, Node* last);
+	static inline void FreeChain(Node* node);
+
+	static inline Recycled recycled;
+	static inline thread_local Cache cache;
+
+	//Back link of a node whose producer hasn't stored it yet, the list itself is never a node
+	Node* Busy() { return (Node*)this; }
+
+	std::atomic<Node*> tail{ nullptr };
+};
+
+template<typename T> inline MPSCList<T>::~MPSCList()
+{
+	PopAll();
+}
+
+template<typename T> inline void MPSCList<T>::PushBack(const T& value)
+{
+	Push(value);
+}
+
+template<typename T> inline void MPSCList<T>::PushBack(T&& value)
+{
+	Push(std::move(value));
+}
+
+template<typename T> inline typename MPSCList<T>::Batch MPSCList<T>::PopAll()
+{
+	Batch batch;
+
+	Node* last = tail.exchange(nullptr, std::memory_order_acquire);
+	batch.tail = last;
+
+	//The chain is walked back from the last node, a node's back link is null only for the first node pushed after the previous PopAll
+	for (Node* node = last; node;)
+	{
+		std::atomic_ref<Node*> link(node->prev);
+		Node* prev = link.load(std::memory_order_acquire);
+
+		for (U64 spins = 0; prev == Busy(); prev = link.load(std::memory_order_acquire))
+		{
+			if (++spins < MPSC_LIST_SPINS) { _mm_pause(); }
+			else { std::this_thread::yield(); }
+		}
+
+		if (prev) { prev->next = node; }
+		else { batch.head = node; }
+
+		++batch.size;
+		node = prev;
+	}
+
+	return batch;
+}
+
+template<typename T> inline void MPSCList<T>::PopAll(List<T>& list)
+{
+	PopAll().MoveTo(list);
+}
+
+template<typename T> inline typename MPSCList<T>::Batch& MPSCList<T>::Batch::operator=(Batch&& other) noexcept
+{
+	if (&other == this) { return *this; }
+
+	Destroy();
+
+	head = other.head;
+	tail = other.tail;
+	size = other.size;
+
+	other.head = nullptr;
+	other.tail = nullptr;
+	other.size = 0;
+
+	return *this;
+}
+
+template<typename T> inline void MPSCList<T>::Batch::Destroy()
+{
+	if (!head) { return; }
+
+	if constexpr (!std::is_trivially_destructible_v<T>)
+	{
+		for (Node* node = head; node;)
+		{
+			Node* next = node->next;
+			node->~Node();
+			node->next = next;
+			node = next;
+		}
+	}
+
+	RecycleChain(head, tail);
+
+	head = nullptr;
+	tail = nullptr;
+	size = 0;
+}
+
+template<typename T> inline void MPSCList<T>::Batch::MoveTo(List<T>& list)
+{
+	if (!head) { return; }
+
+	list.Reserve(size);
+
+	for (Node* node = head; node;)
+	{
+		Node* next = node->next;
+		list.PushBack(std::move(node->value));
+		node->~Node();
+		node->next = next;
+		node = next;
+	}
+
+	RecycleChain(head, tail);
+
+	head = nullptr;
+	tail = nullptr;
+	size = 0;
+}
+
+
+
+
+//Helpers
+template<typename T> template<typename Value> inline void MPSCList<T>::Push(Value&& value)
+{
+	Node* node = new (AllocateNode()) Node(std::forward<Value>(value));
+	node->prev = Busy();
+
+	//The exchange publishes the node, its back link follows once the previous tail is known
+	Node* prev = tail.exchange(node, std::memory_order_acq_rel);
+	std::atomic_ref<Node*>(node->prev).store(prev, std::memory_order_release);
+}
+
+template<typename T> inline typename MPSCList<T>::Node* MPSCList<T>::AllocateNode()
+{
+	Node* node = cache.nodes;
+
+	if (!node && recycled.top.load(std::memory_order_relaxed)) { node = recycled.top.exchange(nullptr, std::memory_order_acquire); }
+	if (!node) { return (Node*)malloc(sizeof(Node)); }
+
+	cache.nodes = node->next;
+	return node;
+}
+
+template<typename T> inline void MPSCList<T>::RecycleChain(Node* first, Node* last)
+{
+	Node* top = recycled.top.load(std::memory_order_relaxed);
+
+	do { last->next = top; } while (!recycled.top.compare_exchange_weak(top, first, std::memory_order_release, std::memory_order_relaxed));
+}
+
+template<typename T> inline void MPSCList<T>::FreeChain(Node* node)
+{
+	while (node)
+	{
+		Node* next = node->next;
+		free(node);
+		node = next;
+	}
+}
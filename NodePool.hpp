@@ -0,0 +1,269 @@
+#pragma once
+
+#include "ContainerDefines.hpp"
+
+#include <stdlib.h>
+#include <stddef.h>
+
+static inline constexpr U64 NODE_POOL_FIRST_SLAB = 16;	//Nodes in the first slab of a pool, every slab after it doubles
+static inline constexpr U64 NODE_POOL_MAX_SLAB = 4096;	//Most nodes in a slab the pool grows by on its own, Reserve can allocate larger ones
+
+/// <summary>
+/// Hands out storage for nodes carved from slabs, freed nodes are recycled through a free list and every slab is released at once by Destroy
+/// Nodes allocated one after another come from consecutive slots of the same slab, so a list appended in order is laid out contiguously
+/// </summary>
+template<class Node>
+struct NodePool
+{
+	NodePool() {}
+	NodePool(NodePool&& other) noexcept;
+	NodePool& operator=(NodePool&& other) noexcept;
+	NodePool(const NodePool&) = delete;
+	NodePool& operator=(const NodePool&) = delete;
+
+	~NodePool();
+
+	/// <summary>
+	/// Releases every slab, nodes that are still in use must already be destroyed
+	/// </summary>
+	void Destroy();
+
+	/// <returns>Uninitialized storage for one node, a recycled node if there is one, otherwise the next slot of the current run, runs left in older slabs come after it</returns>
+	Node* Allocate();
+
+	/// <summary>
+	/// Returns the storage of a destroyed node to the free list
+	/// </summary>
+	void Free(Node* node);
+
+	/// <summary>
+	/// Makes room for count nodes in one contiguous run of slots, used once the recycled nodes run out and before the slots left in older slabs
+	/// </summary>
+	void Reserve(U64 count);
+
+	/// <summary>
+	/// Takes every slab, recycled node and unused run of other in constant time and leaves other empty, nodes allocated from other are freed to this pool from then on
+	/// </summary>
+	void Take(NodePool& other);
+
+	/// <returns>The amount of node slots in all slabs</returns>
+	U64 Capacity() const { return capacity; }
+
+private:
+	union Slot
+	{
+		Slot* next;
+		alignas(Node) U8 storage[sizeof(Node)];
+	};
+
+	struct Slab
+	{
+		Slab* next;
+		U64 count;
+	};
+
+	static_assert(alignof(Slot) <= alignof(max_align_t), "Over-aligned nodes aren't supported");
+	static constexpr U64 SLAB_HEADER = (sizeof(Slab) + alignof(Slot) - 1) & ~(alignof(Slot) - 1);
+
+	void Grow(U64 count);
+	void Stash(Slot* begin, Slot* end);
+	void Reset();
+
+	Slab* slabs{ nullptr };
+	Slab* lastSlab{ nullptr };
+	Slot* recycled{ nullptr };
+	Slot* lastRecycled{ nullptr };
+	Slot* fresh{ nullptr };
+	Slot* freshEnd{ nullptr };
+	Slot* spare{ nullptr };				//Runs of unused slots set aside when a new slab became the fresh run
+	Slot* lastSpare{ nullptr };
+	U64 capacity{ 0 };
+	U64 nextSlab{ NODE_POOL_FIRST_SLAB };
+};
+
+template<class Node>
+inline NodePool<Node>::NodePool(NodePool&& other) noexcept : slabs{ other.slabs }, lastSlab{ other.lastSlab }, recycled{ other.recycled },
+	lastRecycled{ other.lastRecycled }, fresh{ other.fresh }, freshEnd{ other.freshEnd }, spare{ other.spare }, lastSpare{ other.lastSpare },
+	capacity{ other.capacity }, nextSlab{ other.nextSlab }
+{
+	other.Reset();
+}
+
+template<class Node>
+inline NodePool<Node>& NodePool<Node>::operator=(NodePool&& other) noexcept
+{
+	if (&other == this) { return *this; }
+
+	Destroy();
+
+	slabs = other.slabs;
+	lastSlab = other.lastSlab;
+	recycled = other.recycled;
+	lastRecycled = other.lastRecycled;
+	fresh = other.fresh;
+	freshEnd = other.freshEnd;
+	spare = other.spare;
+	lastSpare = other.lastSpare;
+	capacity = other.capacity;
+	nextSlab = other.nextSlab;
+
+	other.Reset();
+
+	return *this;
+}
+
+template<class Node>
+inline NodePool<Node>::~NodePool()
+{
+	Destroy();
+}
+
+template<class Node>
+inline void NodePool<Node>::Destroy()
+{
+	for (Slab* slab = slabs; slab;)
+	{
+		Slab* next = slab->next;
+		free(slab);
+		slab = next;
+	}
+
+	Reset();
+}
+
+template<class Node>
+inline Node* NodePool<Node>::Allocate()
+{
+	if (recycled)
+	{
+		Slot* slot = recycled;
+		recycled = slot->next;
+		if (!recycled) { lastRecycled = nullptr; }
+
+		return (Node*)slot;
+	}
+
+	if (fresh == freshEnd)
+	{
+		if (spare)
+		{
+			fresh = spare;
+			freshEnd = spare[1].next;
+			spare = spare[0].next;
+			if (!spare) { lastSpare = nullptr; }
+		}
+		else
+		{
+			Grow(nextSlab);
+			if (nextSlab < NODE_POOL_MAX_SLAB) { nextSlab <<= 1; }
+		}
+	}
+
+	return (Node*)fresh++;
+}
+
+template<class Node>
+inline void NodePool<Node>::Free(Node* node)
+{
+	Slot* slot = (Slot*)node;
+	slot->next = recycled;
+
+	if (!recycled) { lastRecycled = slot; }
+	recycled = slot;
+}
+
+template<class Node>
+inline void NodePool<Node>::Reserve(U64 count)
+{
+	if ((U64)(freshEnd - fresh) < count) { Grow(count); }
+}
+
+template<class Node>
+inline void NodePool<Node>::Take(NodePool& other)
+{
+	if (&other == this || !other.slabs) { return; }
+
+	if (lastSlab) { lastSlab->next = other.slabs; }
+	else { slabs = other.slabs; }
+	lastSlab = other.lastSlab;
+
+	if (other.recycled)
+	{
+		other.lastRecycled->next = recycled;
+		if (!recycled) { lastRecycled = other.lastRecycled; }
+		recycled = other.recycled;
+	}
+
+	if (other.spare)
+	{
+		other.lastSpare[0].next = spare;
+		if (!spare) { lastSpare = other.lastSpare; }
+		spare = other.spare;
+	}
+
+	//The longer fresh run stays fresh, the shorter one is set aside
+	if (other.freshEnd - other.fresh > freshEnd - fresh)
+	{
+		Stash(fresh, freshEnd);
+		fresh = other.fresh;
+		freshEnd = other.freshEnd;
+	}
+	else { Stash(other.fresh, other.freshEnd); }
+
+	capacity += other.capacity;
+	if (other.nextSlab > nextSlab) { nextSlab = other.nextSlab; }
+
+	other.Reset();
+}
+
+
+
+//Helpers
+template<class Node>
+inline void NodePool<Node>::Grow(U64 count)
+{
+	//Slots left in the current slab are handed out once the new one is used up
+	Stash(fresh, freshEnd);
+
+	Slab* slab = (Slab*)malloc(SLAB_HEADER + count * sizeof(Slot));
+	slab->next = nullptr;
+	slab->count = count;
+
+	if (lastSlab) { lastSlab->next = slab; }
+	else { slabs = slab; }
+	lastSlab = slab;
+
+	fresh = (Slot*)((U8*)slab + SLAB_HEADER);
+	freshEnd = fresh + count;
+	capacity += count;
+}
+
+template<class Node>
+inline void NodePool<Node>::Stash(Slot* begin, Slot* end)
+{
+	//A run keeps the next run in its first slot and its end in its second, a single slot is simply recycled
+	if (end - begin == 1) { Free((Node*)begin); }
+	else if (end - begin > 1)
+	{
+		begin[0].next = spare;
+		begin[1].next = end;
+
+		if (!spare) { lastSpare = begin; }
+		spare = begin;
+	}
+}
+
+template<class Node>
+inline void NodePool<Node>::Reset()
+{
+	slabs = nullptr;
+	lastSlab = nullptr;
+	recycled = nullptr;
+	lastRecycled = nullptr;
+	fresh = nullptr;
+	freshEnd = nullptr;
+	spare = nullptr;
+	lastSpare = nullptr;
+	capacity = 0;
+	nextSlab = NODE_POOL_FIRST_SLAB;
+}
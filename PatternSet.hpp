@@ -0,0 +1,469 @@
+#pragma once
+
+#include "String.hpp"
+
+#include <algorithm>
+
+static inline constexpr U64 PATTERN_DENSE_BUDGET = 1 << 22;	//Most transition table entries kept for the dense states, deeper states fall back to sparse edges
+static inline constexpr U64 PATTERN_PREFILTER_SET = 16;		//Most distinct pattern starts the block prefilter skips ahead on
+static inline constexpr U32 PATTERN_REPORT = 0x80000000;	//Set on a transition whose target state ends at least one pattern
+
+/// <summary>
+/// Finds the first position in [it, end) where first[i] is followed by second[i] for some i, comparing a block against every pair at once
+/// Without second, finds the first character that is in first
+/// </summary>
+/// <returns>A pointer to the position, nullptr if there is none</returns>
+template<Character C>
+inline const C* PatternPrefilter(const C* it, const C* end, const C* first, const C* second, U64 count)
+{
+	constexpr U64 lanes = SEARCH_BLOCK / sizeof(C);
+
+	if (second)
+	{
+		for (; (U64)(end - it) > lanes; it += lanes)
+		{
+			U32 mask = 0;
+			for (U64 i = 0; i < count; ++i) { mask |= SearchCompare(it, first[i]) & SearchCompare(it + 1, second[i]); }
+			if (mask) { return it + std::countr_zero(mask) / sizeof(C); }
+		}
+
+		for (; it + 1 < end; ++it)
+		{
+			for (U64 i = 0; i < count; ++i) { if (it[0] == first[i] && it[1] == second[i]) { return it; } }
+		}
+
+		return nullptr;
+	}
+
+	for (; (U64)(end - it) >= lanes; it += lanes)
+	{
+		U32 mask = 0;
+		for (U64 i = 0; i < count; ++i) { mask |= SearchCompare(it, first[i]); }
+		if (mask) { return it + std::countr_zero(mask) / sizeof(C); }
+	}
+
+	for (; it != end; ++it)
+	{
+		for (U64 i = 0; i < count; ++i) { if (*it == first[i]) { return it; } }
+	}
+
+	return nullptr;
+}
+
+/// <summary>
+/// One occurrence found by a pattern set
+/// </summary>
+struct PatternMatch
+{
+	U64 offset;		//Index of the first character of the occurrence
+	U32 pattern;	//Index of the pattern in the list the set was built from
+
+	friend bool operator==(const PatternMatch& a, const PatternMatch& b) { return a.offset == b.offset && a.pattern == b.pattern; }
+};
+
+/// <summary>
+/// Compiled Aho-Corasick automaton that finds every occurrence of many patterns in a single pass over the text
+/// Characters are mapped to classes so transition rows only hold characters that appear in a pattern,
+/// states are numbered breadth first and the shallow ones, where scanning spends most of its time, get complete rows
+/// When the patterns start with only a few distinct character pairs, scanning skips ahead a block at a time while in the root state
+/// </summary>
+template<Character C>
+struct PatternSetBase
+{
+	PatternSetBase();
+
+	/// <summary>
+	/// Compiles patterns, a container of anything a StringViewBase can be made from, empty patterns never match
+	/// </summary>
+	template<class Container> PatternSetBase(const Container& patterns);
+	PatternSetBase(const PatternSetBase&) = delete;
+	PatternSetBase(PatternSetBase&& other) noexcept;
+
+	PatternSetBase& operator=(const PatternSetBase&) = delete;
+	PatternSetBase& operator=(PatternSetBase&& other) noexcept;
+
+	~PatternSetBase();
+	void Destroy();
+
+	/// <summary>
+	/// Replaces the compiled patterns, pattern indices in matches refer to positions in patterns
+	/// </summary>
+	template<class Container> void Build(const Container& patterns);
+
+	/// <summary>
+	/// Clears matches and pushes a PatternMatch for every occurrence in text, ordered by where the occurrence ends
+	/// Duplicate patterns are reported once, under the lowest index
+	/// </summary>
+	/// <returns>The amount of matches</returns>
+	template<class Container> U64 FindAll(const StringViewBase<C>& text, Container& matches) const;
+
+	/// <returns>True if any pattern occurs in text, stops at the first occurrence</returns>
+	bool ContainsAny(const StringViewBase<C>& text) const;
+
+	U32 PatternCount() const { return patternCount; }
+	U32 StateCount() const { return stateCount; }
+
+private:
+	struct State
+	{
+		U32 fail;		//Longest proper suffix of this state that is also a state
+		U32 output;		//Pattern ending at this state, U32_MAX if none
+		U32 dictionary;	//Nearest state on the fail chain with an output, 0 if none
+		U32 edgeStart;
+		U32 edgeCount;
+	};
+
+	struct Edge
+	{
+		U32 cls;
+		U32 target;
+	};
+
+	U32 Class(C c) const;
+
+	/// <returns>The state reached from state on cls, with PATTERN_REPORT set if it ends a pattern</returns>
+	U32 Next(U32 state, U32 cls) const;
+	U32 Child(U32 state, U32 cls) const;
+	template<class Container> void Report(U32 state, U64 end, Container& matches) const;
+
+	State* states{ nullptr };
+	Edge* edges{ nullptr };
+	U32* dense{ nullptr };
+	U32* lengths{ nullptr };
+	C* wideUnits{ nullptr };
+
+	U32 patternCount{ 0 };
+	U32 stateCount{ 0 };
+	U32 denseStates{ 0 };
+	U32 classCount{ 0 };
+	U32 rowShift{ 0 };
+	U32 wideCount{ 0 };
+	U32 prefilterCount{ 0 };
+	bool prefilterPairs{ false };
+	U32 classMap[256]{};
+	C prefilterFirst[PATTERN_PREFILTER_SET]{};
+	C prefilterSecond[PATTERN_PREFILTER_SET]{};
+};
+
+using PatternSet = PatternSetBase<char>;
+using PatternSet8 = PatternSetBase<char8_t>;
+using PatternSet16 = PatternSetBase<char16_t>;
+using PatternSet32 = PatternSetBase<char32_t>;
+using PatternSetW = PatternSetBase<wchar_t>;
+
+template<Character C>
+inline PatternSetBase<C>::PatternSetBase() {}
+
+template<Character C>
+template<class Container>
+inline PatternSetBase<C>::PatternSetBase(const Container& patterns)
+{
+	Build(patterns);
+}
+
+template<Character C>
+inline PatternSetBase<C>::PatternSetBase(PatternSetBase&& other) noexcept
+{
+	*this = std::move(other);
+}
+
+template<Character C>
+inline PatternSetBase<C>& PatternSetBase<C>::operator=(PatternSetBase&& other) noexcept
+{
+	if (&other == this) { return *this; }
+
+	Destroy();
+
+	memcpy((void*)this, &other, sizeof(PatternSetBase));
+	memset((void*)&other, 0, sizeof(PatternSetBase));
+
+	return *this;
+}
+
+template<Character C>
+inline PatternSetBase<C>::~PatternSetBase()
+{
+	Destroy();
+}
+
+template<Character C>
+inline void PatternSetBase<C>::Destroy()
+{
+	free(states);
+	free(edges);
+	free(dense);
+	free(lengths);
+	free(wideUnits);
+
+	memset((void*)this, 0, sizeof(PatternSetBase));
+}
+
+template<Character C>
+template<class Container>
+inline void PatternSetBase<C>::Build(const Container& patterns)
+{
+	using Unit = std::make_unsigned_t<C>;
+
+	Destroy();
+
+	for (const auto& pattern : patterns) { (void)pattern; ++patternCount; }
+	if (patternCount == 0) { return; }
+
+	StringViewBase<C>* views = (StringViewBase<C>*)malloc(patternCount * sizeof(StringViewBase<C>));
+	lengths = (U32*)malloc(patternCount * sizeof(U32));
+
+	U64 totalLength = 0;
+	U64 highUnits = 0;
+	U32 index = 0;
+
+	for (const auto& pattern : patterns)
+	{
+		views[index] = StringViewBase<C>(pattern);
+		lengths[index] = (U32)views[index].Size();
+		totalLength += views[index].Size();
+
+		for (C c : views[index]) { if ((Unit)c < 256) { classMap[(Unit)c] = 1; } else { ++highUnits; } }
+
+		++index;
+	}
+
+	//Classes are handed out in character order so edges sorted by character are also sorted by class
+	classCount = 1;
+	for (U32 i = 0; i < 256; ++i) { if (classMap[i]) { classMap[i] = classCount++; } }
+
+	if constexpr (sizeof(C) > 1)
+	{
+		if (highUnits)
+		{
+			wideUnits = (C*)malloc(highUnits * sizeof(C));
+			for (U32 i = 0; i < patternCount; ++i) { for (C c : views[i]) { if ((Unit)c >= 256) { wideUnits[wideCount++] = c; } } }
+
+			std::sort(wideUnits, wideUnits + wideCount, [](C a, C b) { return (Unit)a < (Unit)b; });
+			wideCount = (U32)(std::unique(wideUnits, wideUnits + wideCount) - wideUnits);
+			classCount += wideCount;
+		}
+	}
+
+	U32* order = (U32*)malloc(patternCount * sizeof(U32));
+	U32 orderCount = 0;
+	for (U32 i = 0; i < patternCount; ++i) { if (lengths[i]) { order[orderCount++] = i; } }
+
+	std::sort(order, order + orderCount, [views](U32 a, U32 b)
+		{
+			I32 result = CompareStrings(views[a].Data(), views[a].Size(), views[b].Data(), views[b].Size());
+			return result < 0 || (result == 0 && a < b);
+		});
+
+	//Every state is a distinct prefix, at most one per pattern character plus the root
+	U64 maxStates = totalLength + 1;
+	states = (State*)malloc(maxStates * sizeof(State));
+	edges = (Edge*)malloc(maxStates * sizeof(Edge));
+
+	//Rows are padded to a power of two so finding one is a shift
+	rowShift = (U32)std::bit_width(classCount - 1);
+	U64 denseLimit = PATTERN_DENSE_BUDGET >> rowShift;
+	denseStates = (U32)(maxStates < denseLimit ? maxStates : denseLimit);
+	dense = (U32*)malloc(((U64)denseStates << rowShift) * sizeof(U32));
+
+	//The sorted patterns sharing a state's prefix are contiguous, children split that range by the next character
+	U32* rangeStart = (U32*)malloc(maxStates * sizeof(U32));
+	U32* rangeEnd = (U32*)malloc(maxStates * sizeof(U32));
+	U32* depth = (U32*)malloc(maxStates * sizeof(U32));
+
+	states[0] = { 0, U32_MAX, 0, 0, 0 };
+	rangeStart[0] = 0;
+	rangeEnd[0] = orderCount;
+	depth[0] = 0;
+	stateCount = 1;
+	U32 edgeCount = 0;
+	C firstUnits[PATTERN_PREFILTER_SET];
+	U32 firstCount = 0;
+	U32 pairCount = 0;
+	bool singles = false;
+
+	for (U32 s = 0; s < stateCount; ++s)
+	{
+		State& state = states[s];
+		U32 d = depth[s];
+		U32 i = rangeStart[s];
+		U32 end = rangeEnd[s];
+
+		while (i < end && lengths[order[i]] == d) { ++i; }
+
+		state.edgeStart = edgeCount;
+
+		while (i < end)
+		{
+			C c = views[order[i]][d];
+			U32 groupStart = i;
+			while (i < end && views[order[i]][d] == c) { ++i; }
+
+			U32 cls = Class(c);
+			U32 child = stateCount++;
+			U32 fail = s == 0 ? 0 : Next(state.fail, cls) & ~PATTERN_REPORT;
+
+			//Outputs are set on creation, the fail target of a later state can be one that hasn't been expanded yet
+			U32 output = lengths[order[groupStart]] == d + 1 ? order[groupStart] : U32_MAX;
+			states[child] = { fail, output, states[fail].output != U32_MAX ? fail : states[fail].dictionary, 0, 0 };
+			rangeStart[child] = groupStart;
+			rangeEnd[child] = i;
+			depth[child] = d + 1;
+			edges[edgeCount++] = { cls, output != U32_MAX || states[child].dictionary ? child | PATTERN_REPORT : child };
+
+			//Pairs of first and second characters filter far better than first characters alone, unless a pattern is a single character
+			if (d == 0)
+			{
+				if (firstCount < PATTERN_PREFILTER_SET) { firstUnits[firstCount] = c; }
+				++firstCount;
+				singles |= output != U32_MAX;
+			}
+			else if (d == 1)
+			{
+				if (pairCount < PATTERN_PREFILTER_SET) { prefilterSecond[pairCount] = c; prefilterFirst[pairCount] = views[order[groupStart]][0]; }
+				++pairCount;
+			}
+		}
+
+		state.edgeCount = edgeCount - state.edgeStart;
+
+		if (s < denseStates)
+		{
+			U32* row = dense + ((U64)s << rowShift);
+
+			if (s == 0) { memset(row, 0, classCount * sizeof(U32)); }
+			else { memcpy(row, dense + ((U64)state.fail << rowShift), classCount * sizeof(U32)); }
+
+			for (U32 e = state.edgeStart; e < edgeCount; ++e) { row[edges[e].cls] = edges[e].target; }
+		}
+	}
+
+	if (denseStates > stateCount) { denseStates = stateCount; }
+	prefilterPairs = !singles && pairCount <= PATTERN_PREFILTER_SET;
+
+	if (prefilterPairs) { prefilterCount = pairCount; }
+	else if (firstCount <= PATTERN_PREFILTER_SET)
+	{
+		prefilterCount = firstCount;
+		Copy(prefilterFirst, firstUnits, firstCount);
+	}
+
+	free(rangeStart);
+	free(rangeEnd);
+	free(depth);
+	free(order);
+	free(views);
+}
+
+template<Character C>
+template<class Container>
+inline U64 PatternSetBase<C>::FindAll(const StringViewBase<C>& text, Container& matches) const
+{
+	matches.Clear();
+	if (stateCount <= 1) { return 0; }
+
+	const C* begin = text.Data();
+	const C* it = begin;
+	const C* end = begin + text.Size();
+	U32 state = 0;
+
+	while (it != end)
+	{
+		//With few distinct pattern starts the root is left only where one of them occurs
+		if (state == 0 && prefilterCount && !(it = PatternPrefilter(it, end, prefilterFirst, prefilterPairs ? prefilterSecond : nullptr, prefilterCount))) { break; }
+
+		state = Next(state, Class(*it++));
+
+		if (state & PATTERN_REPORT)
+		{
+			state &= ~PATTERN_REPORT;
+			Report(state, it - begin, matches);
+		}
+	}
+
+	return matches.Size();
+}
+
+template<Character C>
+inline bool PatternSetBase<C>::ContainsAny(const StringViewBase<C>& text) const
+{
+	if (stateCount <= 1) { return false; }
+
+	const C* it = text.Data();
+	const C* end = it + text.Size();
+	U32 state = 0;
+
+	while (it != end)
+	{
+		if (state == 0 && prefilterCount && !(it = PatternPrefilter(it, end, prefilterFirst, prefilterPairs ? prefilterSecond : nullptr, prefilterCount))) { break; }
+
+		state = Next(state, Class(*it++));
+		if (state & PATTERN_REPORT) { return true; }
+	}
+
+	return false;
+}
+
+
+
+//Helpers
+template<Character C>
+inline U32 PatternSetBase<C>::Class(C c) const
+{
+	using Unit = std::make_unsigned_t<C>;
+
+	if ((Unit)c < 256) { return classMap[(Unit)c]; }
+
+	U32 low = 0;
+	U32 high = wideCount;
+	while (low < high)
+	{
+		U32 mid = (low + high) >> 1;
+		if ((Unit)wideUnits[mid] < (Unit)c) { low = mid + 1; }
+		else { high = mid; }
+	}
+
+	return low < wideCount && wideUnits[low] == c ? classCount - wideCount + low : 0;
+}
+
+template<Character C>
+inline U32 PatternSetBase<C>::Next(U32 state, U32 cls) const
+{
+	//Fail links always lead to a shallower state, so the chain reaches a dense state
+	while (state >= denseStates)
+	{
+		U32 child = Child(state, cls);
+		if (child) { return child; }
+		state = states[state].fail;
+	}
+
+	return dense[((U64)state << rowShift) + cls];
+}
+
+template<Character C>
+template<class Container>
+inline void PatternSetBase<C>::Report(U32 state, U64 end, Container& matches) const
+{
+	U32 found = states[state].output != U32_MAX ? state : states[state].dictionary;
+
+	for (; found; found = states[found].dictionary)
+	{
+		U32 pattern = states[found].output;
+		matches.Push(PatternMatch{ end - lengths[pattern], pattern });
+	}
+}
+
+template<Character C>
+inline U32 PatternSetBase<C>::Child(U32 state, U32 cls) const
+{
+	const Edge* low = edges + states[state].edgeStart;
+	const Edge* high = low + states[state].edgeCount;
+
+	while (low < high)
+	{
+		const Edge* mid = low + ((high - low) >> 1);
+		if (mid->cls < cls) { low = mid + 1; }
+		else { high = mid; }
+	}
+
+	return low != edges + states[state].edgeStart + states[state].edgeCount && low->cls == cls ? low->target : 0;
+}
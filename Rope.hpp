@@ -0,0 +1,555 @@
+#pragma once
+
+#include "String.hpp"
+
+/// <summary>
+/// Height balanced tree of character chunks, insert, erase and concatenation are O(log n) and SubString shares the unchanged subtrees
+/// Nodes are reference counted without synchronization, ropes that share nodes must stay on one thread
+/// </summary>
+template<Character C>
+struct RopeBase
+{
+	RopeBase();
+	RopeBase(NullPointer);
+	explicit RopeBase(const StringViewBase<C>& other);
+	RopeBase(const RopeBase& other);
+	RopeBase(RopeBase&& other) noexcept;
+
+	RopeBase& operator=(NullPointer);
+	RopeBase& operator=(const StringViewBase<C>& other);
+	RopeBase& operator=(const RopeBase& other);
+	RopeBase& operator=(RopeBase&& other) noexcept;
+
+	~RopeBase();
+	void Destroy();
+
+	RopeBase& Append(const StringViewBase<C>& append);
+	RopeBase& Append(const RopeBase& append);
+	RopeBase& Prepend(const StringViewBase<C>& prepend);
+	RopeBase& Prepend(const RopeBase& prepend);
+	RopeBase& Insert(U64 index, const StringViewBase<C>& insert);
+	RopeBase& Insert(U64 index, const RopeBase& insert);
+	RopeBase& Erase(U64 start, U64 length = U64_MAX);
+
+	/// <summary>
+	/// Creates a rope over [start, start + length) that shares every node not cut by the range
+	/// </summary>
+	RopeBase SubString(U64 start, U64 length = U64_MAX) const;
+
+	/// <summary>
+	/// Copies every chunk into a single StringBase with one allocation
+	/// </summary>
+	StringBase<C> ToString() const;
+
+	/// <summary>
+	/// Copies every chunk into dst, dst must hold at least Size() characters
+	/// </summary>
+	void CopyTo(C* dst) const;
+
+	/// <summary>
+	/// Calls function with a StringViewBase of each chunk in order
+	/// </summary>
+	template<class Function> void ForEachChunk(Function function) const;
+
+	C operator[](U64 index) const;
+
+	U64 Size() const { return root ? root->size : 0; }
+	U32 Height() const { return root ? root->height : 0; }
+
+private:
+	struct Node
+	{
+		U64 references;
+		U64 size;
+		U32 height;
+		Node* left;
+		Node* right;
+
+		C* Data() { return (C*)(this + 1); }
+	};
+
+	static constexpr U64 LEAF_SIZE = 1024;	//Character capacity of a leaf
+
+	//Every helper consumes the references of the nodes passed in and returns an owned reference, Split only borrows node
+	static Node* Retain(Node* node);
+	static void Release(Node* node);
+	static Node* NewLeaf(const C* string, U64 size);
+	static Node* NewConcat(Node* left, Node* right);
+	static Node* Build(const C* string, U64 size);
+	static Node* Concat(Node* left, Node* right);
+	static Node* Join(Node* left, Node* right);
+	static Node* JoinRight(Node* left, Node* right);
+	static Node* JoinLeft(Node* left, Node* right);
+	static Node* RotateLeft(Node* node);
+	static Node* RotateRight(Node* node);
+	static void Split(Node* node, U64 index, Node*& left, Node*& right);
+	template<class Function> static void ForEachChunk(Node* node, Function& function);
+
+	RopeBase(Node* root) : root{ root } {}
+
+	Node* root{ nullptr };
+};
+
+using Rope = RopeBase<char>;
+using Rope8 = RopeBase<char8_t>;
+using Rope16 = RopeBase<char16_t>;
+using Rope32 = RopeBase<char32_t>;
+using RopeW = RopeBase<wchar_t>;
+
+template<Character C>
+inline RopeBase<C>::RopeBase() {}
+
+template<Character C>
+inline RopeBase<C>::RopeBase(NullPointer) {}
+
+template<Character C>
+inline RopeBase<C>::RopeBase(const StringViewBase<C>& other) : root{ Build(other.Data(), other.Size()) } {}
+
+template<Character C>
+inline RopeBase<C>::RopeBase(const RopeBase& other) : root{ Retain(other.root) } {}
+
+template<Character C>
+inline RopeBase<C>::RopeBase(RopeBase&& other) noexcept : root{ other.root }
+{
+	other.root = nullptr;
+}
+
+template<Character C>
+inline RopeBase<C>& RopeBase<C>::operator=(NullPointer)
+{
+	Destroy();
+
+	return *this;
+}
+
+template<Character C>
+inline RopeBase<C>& RopeBase<C>::operator=(const StringViewBase<C>& other)
+{
+	Node* node = Build(other.Data(), other.Size());
+	Release(root);
+	root = node;
+
+	return *this;
+}
+
+template<Character C>
+inline RopeBase<C>& RopeBase<C>::operator=(const RopeBase& other)
+{
+	Node* node = Retain(other.root);
+	Release(root);
+	root = node;
+
+	return *this;
+}
+
+template<Character C>
+inline RopeBase<C>& RopeBase<C>::operator=(RopeBase&& other) noexcept
+{
+	if (&other == this) { return *this; }
+
+	Release(root);
+	root = other.root;
+	other.root = nullptr;
+
+	return *this;
+}
+
+template<Character C>
+inline RopeBase<C>::~RopeBase()
+{
+	Destroy();
+}
+
+template<Character C>
+inline void RopeBase<C>::Destroy()
+{
+	Release(root);
+	root = nullptr;
+}
+
+template<Character C>
+inline RopeBase<C>& RopeBase<C>::Append(const StringViewBase<C>& append)
+{
+	if (append.Size() == 0) { return *this; }
+
+	//Fast path, the right spine is only owned by this rope and its last leaf has room
+	Node* node = root;
+	while (node && node->references == 1 && node->height) { node = node->right; }
+
+	if (node && node->references == 1 && node->size + append.Size() <= LEAF_SIZE)
+	{
+		Copy(node->Data() + node->size, append.Data(), append.Size());
+
+		for (Node* it = root; it != node; it = it->right) { it->size += append.Size(); }
+		node->size += append.Size();
+
+		return *this;
+	}
+
+	root = Join(root, Build(append.Data(), append.Size()));
+
+	return *this;
+}
+
+template<Character C>
+inline RopeBase<C>& RopeBase<C>::Append(const RopeBase& append)
+{
+	root = Join(root, Retain(append.root));
+
+	return *this;
+}
+
+template<Character C>
+inline RopeBase<C>& RopeBase<C>::Prepend(const StringViewBase<C>& prepend)
+{
+	if (prepend.Size() == 0) { return *this; }
+
+	//Fast path, the left spine is only owned by this rope and its first leaf has room
+	Node* node = root;
+	while (node && node->references == 1 && node->height) { node = node->left; }
+
+	if (node && node->references == 1 && node->size + prepend.Size() <= LEAF_SIZE)
+	{
+		Copy(node->Data() + prepend.Size(), node->Data(), node->size);
+		Copy(node->Data(), prepend.Data(), prepend.Size());
+
+		for (Node* it = root; it != node; it = it->left) { it->size += prepend.Size(); }
+		node->size += prepend.Size();
+
+		return *this;
+	}
+
+	root = Join(Build(prepend.Data(), prepend.Size()), root);
+
+	return *this;
+}
+
+template<Character C>
+inline RopeBase<C>& RopeBase<C>::Prepend(const RopeBase& prepend)
+{
+	root = Join(Retain(prepend.root), root);
+
+	return *this;
+}
+
+template<Character C>
+inline RopeBase<C>& RopeBase<C>::Insert(U64 index, const StringViewBase<C>& insert)
+{
+	if (index >= Size()) { return Append(insert); }
+	if (index == 0) { return Prepend(insert); }
+
+	Node* left;
+	Node* right;
+	Split(root, index, left, right);
+	Release(root);
+
+	root = Join(Join(left, Build(insert.Data(), insert.Size())), right);
+
+	return *this;
+}
+
+template<Character C>
+inline RopeBase<C>& RopeBase<C>::Insert(U64 index, const RopeBase& insert)
+{
+	Node* middle = Retain(insert.root);
+	Node* left;
+	Node* right;
+	Split(root, index, left, right);
+	Release(root);
+
+	root = Join(Join(left, middle), right);
+
+	return *this;
+}
+
+template<Character C>
+inline RopeBase<C>& RopeBase<C>::Erase(U64 start, U64 length)
+{
+	if (start >= Size() || length == 0) { return *this; }
+
+	Node* left;
+	Node* rest;
+	Node* middle;
+	Node* right;
+	Split(root, start, left, rest);
+	Split(rest, length, middle, right);
+	Release(root);
+	Release(rest);
+	Release(middle);
+
+	root = Join(left, right);
+
+	return *this;
+}
+
+template<Character C>
+inline RopeBase<C> RopeBase<C>::SubString(U64 start, U64 length) const
+{
+	if (start >= Size() || length == 0) { return {}; }
+
+	Node* left;
+	Node* rest;
+	Node* middle;
+	Node* right;
+	Split(root, start, left, rest);
+	Split(rest, length, middle, right);
+	Release(left);
+	Release(rest);
+	Release(right);
+
+	return RopeBase<C>(middle);
+}
+
+template<Character C>
+inline StringBase<C> RopeBase<C>::ToString() const
+{
+	StringBase<C> str(Size());
+	CopyTo(str.Data());
+	str.Data()[str.Size()] = '\0';
+
+	return std::move(str);
+}
+
+template<Character C>
+inline void RopeBase<C>::CopyTo(C* dst) const
+{
+	ForEachChunk([&dst](const StringViewBase<C>& chunk)
+	{
+		Copy(dst, chunk.Data(), chunk.Size());
+		dst += chunk.Size();
+	});
+}
+
+template<Character C>
+template<class Function>
+inline void RopeBase<C>::ForEachChunk(Function function) const
+{
+	if (root) { ForEachChunk(root, function); }
+}
+
+template<Character C>
+inline C RopeBase<C>::operator[](U64 index) const
+{
+	Node* node = root;
+
+	while (node->height)
+	{
+		if (index < node->left->size) { node = node->left; }
+		else
+		{
+			index -= node->left->size;
+			node = node->right;
+		}
+	}
+
+	return node->Data()[index];
+}
+
+
+
+//Helpers
+template<Character C>
+inline typename RopeBase<C>::Node* RopeBase<C>::Retain(Node* node)
+{
+	if (node) { ++node->references; }
+
+	return node;
+}
+
+template<Character C>
+inline void RopeBase<C>::Release(Node* node)
+{
+	if (node && --node->references == 0)
+	{
+		if (node->height)
+		{
+			Release(node->left);
+			Release(node->right);
+		}
+
+		free(node);
+	}
+}
+
+template<Character C>
+inline typename RopeBase<C>::Node* RopeBase<C>::NewLeaf(const C* string, U64 size)
+{
+	Node* node = (Node*)malloc(sizeof(Node) + LEAF_SIZE * sizeof(C));
+	node->references = 1;
+	node->size = size;
+	node->height = 0;
+	node->left = nullptr;
+	node->right = nullptr;
+	Copy(node->Data(), string, size);
+
+	return node;
+}
+
+template<Character C>
+inline typename RopeBase<C>::Node* RopeBase<C>::NewConcat(Node* left, Node* right)
+{
+	Node* node = (Node*)malloc(sizeof(Node));
+	node->references = 1;
+	node->size = left->size + right->size;
+	node->height = (left->height > right->height ? left->height : right->height) + 1;
+	node->left = left;
+	node->right = right;
+
+	return node;
+}
+
+template<Character C>
+inline typename RopeBase<C>::Node* RopeBase<C>::Build(const C* string, U64 size)
+{
+	if (size == 0) { return nullptr; }
+	if (size <= LEAF_SIZE) { return NewLeaf(string, size); }
+
+	U64 leaves = (size + LEAF_SIZE - 1) / LEAF_SIZE;
+	U64 half = leaves / 2 * LEAF_SIZE;
+
+	return NewConcat(Build(string, half), Build(string + half, size - half));
+}
+
+template<Character C>
+inline typename RopeBase<C>::Node* RopeBase<C>::Concat(Node* left, Node* right)
+{
+	if (left->height == 0 && right->height == 0 && left->size + right->size <= LEAF_SIZE)
+	{
+		Node* node = NewLeaf(left->Data(), left->size);
+		Copy(node->Data() + left->size, right->Data(), right->size);
+		node->size += right->size;
+
+		Release(left);
+		Release(right);
+
+		return node;
+	}
+
+	return NewConcat(left, right);
+}
+
+template<Character C>
+inline typename RopeBase<C>::Node* RopeBase<C>::Join(Node* left, Node* right)
+{
+	if (!left) { return right; }
+	if (!right) { return left; }
+
+	if (left->height > right->height + 1) { return JoinRight(left, right); }
+	if (right->height > left->height + 1) { return JoinLeft(left, right); }
+
+	return Concat(left, right);
+}
+
+template<Character C>
+inline typename RopeBase<C>::Node* RopeBase<C>::JoinRight(Node* left, Node* right)
+{
+	Node* a = Retain(left->left);
+	Node* b = Retain(left->right);
+	Release(left);
+
+	if (b->height <= right->height + 1)
+	{
+		Node* node = Concat(b, right);
+
+		if (node->height <= a->height + 1) { return NewConcat(a, node); }
+
+		return RotateLeft(NewConcat(a, RotateRight(node)));
+	}
+
+	Node* node = JoinRight(b, right);
+
+	if (node->height <= a->height + 1) { return NewConcat(a, node); }
+
+	return RotateLeft(NewConcat(a, node));
+}
+
+template<Character C>
+inline typename RopeBase<C>::Node* RopeBase<C>::JoinLeft(Node* left, Node* right)
+{
+	Node* a = Retain(right->left);
+	Node* b = Retain(right->right);
+	Release(right);
+
+	if (a->height <= left->height + 1)
+	{
+		Node* node = Concat(left, a);
+
+		if (node->height <= b->height + 1) { return NewConcat(node, b); }
+
+		return RotateRight(NewConcat(RotateLeft(node), b));
+	}
+
+	Node* node = JoinLeft(left, a);
+
+	if (node->height <= b->height + 1) { return NewConcat(node, b); }
+
+	return RotateRight(NewConcat(node, b));
+}
+
+template<Character C>
+inline typename RopeBase<C>::Node* RopeBase<C>::RotateLeft(Node* node)
+{
+	Node* a = Retain(node->left);
+	Node* b = Retain(node->right->left);
+	Node* c = Retain(node->right->right);
+	Release(node);
+
+	return NewConcat(NewConcat(a, b), c);
+}
+
+template<Character C>
+inline typename RopeBase<C>::Node* RopeBase<C>::RotateRight(Node* node)
+{
+	Node* a = Retain(node->left->left);
+	Node* b = Retain(node->left->right);
+	Node* c = Retain(node->right);
+	Release(node);
+
+	return NewConcat(a, NewConcat(b, c));
+}
+
+template<Character C>
+inline void RopeBase<C>::Split(Node* node, U64 index, Node*& left, Node*& right)
+{
+	if (!node || index == 0) { left = nullptr; right = Retain(node); return; }
+	if (index >= node->size) { left = Retain(node); right = nullptr; return; }
+
+	if (node->height == 0)
+	{
+		left = NewLeaf(node->Data(), index);
+		right = NewLeaf(node->Data() + index, node->size - index);
+		return;
+	}
+
+	U64 leftSize = node->left->size;
+
+	if (index < leftSize)
+	{
+		Node* rest;
+		Split(node->left, index, left, rest);
+		right = Join(rest, Retain(node->right));
+	}
+	else if (index == leftSize)
+	{
+		left = Retain(node->left);
+		right = Retain(node->right);
+	}
+	else
+	{
+		Node* rest;
+		Split(node->right, index - leftSize, rest, right);
+		left = Join(Retain(node->left), rest);
+	}
+}
+
+template<Character C>
+template<class Function>
+inline void RopeBase<C>::ForEachChunk(Node* node, Function& function)
+{
+	if (node->height)
+	{
+		ForEachChunk(node->left, function);
+		ForEachChunk(node->right, function);
+	}
+	else { function(StringViewBase<C>(node->Data(), node->size)); }
+}
@@ -0,0 +1,386 @@
+#pragma once
+
+#include "String.hpp"
+#include "Hash.hpp"
+
+#include <atomic>
+
+/// <summary>
+/// Immutable string whose characters are shared between copies, copying increments an atomic reference count instead of copying characters
+/// The characters, their NUL terminator and the reference count live in a single allocation that is freed when the last copy is destroyed
+/// </summary>
+template<Character C>
+struct SharedStringBase
+{
+	SharedStringBase();
+	SharedStringBase(NullPointer);
+	SharedStringBase(const C* other);
+	SharedStringBase(const C* other, U64 length);
+	SharedStringBase(const StringViewBase<C>& other);
+
+	/// <summary>
+	/// Takes the buffer of other without copying its characters, the reference count is placed in the unused capacity when it fits
+	/// </summary>
+	SharedStringBase(StringBase<C>&& other) noexcept;
+	SharedStringBase(const SharedStringBase& other);
+	SharedStringBase(SharedStringBase&& other) noexcept;
+
+	SharedStringBase& operator=(NullPointer);
+	SharedStringBase& operator=(StringBase<C>&& other) noexcept;
+	SharedStringBase& operator=(const SharedStringBase& other);
+	SharedStringBase& operator=(SharedStringBase&& other) noexcept;
+
+	~SharedStringBase();
+
+	/// <summary>
+	/// Releases this reference, the characters are freed if it was the last one
+	/// </summary>
+	void Destroy();
+
+	/// <returns>A view of the characters, valid as long as any copy of this string is alive</returns>
+	StringViewBase<C> View() const { return { string, size }; }
+	StringViewBase<C> SubString(U64 start, U64 length = U64_MAX) const;
+
+	/// <returns>A mutable copy of the characters</returns>
+	StringBase<C> ToString() const;
+
+	bool Blank() const;
+	I64 IndexOf(C c, U64 start = 0) const;
+	I64 LastIndexOf(C c, U64 start = 0) const;
+	I64 IndexOf(const StringViewBase<C>& find, U64 start = 0) const;
+	bool Contains(const StringViewBase<C>& find) const;
+	U64 CountOccurrences(const StringViewBase<C>& find) const;
+	StringViewBase<C> Trimmed() const;
+
+	SplitRange<C> Split(C delimiter) const;
+	SplitRange<C> Split(const StringViewBase<C>& delimiters) const;
+	SplitRange<C> SplitLines() const;
+	SplitRange<C> Tokenize(const StringViewBase<C>& delimiters) const;
+
+	U64 ParseI64(I64& value) const;
+	U64 ParseU64(U64& value) const;
+	U64 ParseF64(F64& value) const;
+
+	I32 Compare(const StringViewBase<C>& other) const;
+	bool EqualsIgnoreCase(const StringViewBase<C>& other) const;
+	I64 IndexOfIgnoreCase(const StringViewBase<C>& find, U64 start = 0) const;
+
+	friend bool operator==(const SharedStringBase& a, const SharedStringBase& b) { return EqualStrings(a.string, a.size, b.string, b.size); }
+	friend bool operator==(const SharedStringBase& a, const StringViewBase<C>& b) { return EqualStrings(a.string, a.size, b.Data(), b.Size()); }
+	friend bool operator==(const SharedStringBase& a, const C* b) { return a == StringViewBase<C>(b); }
+	friend std::strong_ordering operator<=>(const SharedStringBase& a, const SharedStringBase& b) { return CompareStrings(a.string, a.size, b.string, b.size) <=> 0; }
+	friend std::strong_ordering operator<=>(const SharedStringBase& a, const StringViewBase<C>& b) { return CompareStrings(a.string, a.size, b.Data(), b.Size()) <=> 0; }
+	friend std::strong_ordering operator<=>(const SharedStringBase& a, const C* b) { return a <=> StringViewBase<C>(b); }
+
+	/// <returns>The amount of strings sharing these characters, 0 if the string is empty</returns>
+	U64 References() const;
+
+	const U64& Size() const { return size; }
+	const C* Data() const { return string; }
+	operator const C* () const { return string; }
+	operator StringViewBase<C>() const { return { string, size }; }
+
+	const C& operator[](U64 index) const { return string[index]; }
+
+	const C* begin() const { return string; }
+	const C* end() const { return string + size; }
+
+private:
+	using Counter = std::atomic<U64>;
+
+	/// <returns>The byte offset of the reference count, just past the terminator and aligned for it</returns>
+	static constexpr U64 CounterOffset(U64 length) { return ((length + 1) * sizeof(C) + alignof(Counter) - 1) & ~(alignof(Counter) - 1); }
+
+	Counter& References(C* data) const { return *(Counter*)((U8*)data + CounterOffset(size)); }
+	void Create(const C* other, U64 length);
+	void Adopt(StringBase<C>& other);
+
+	U64 size{ 0 };
+	C* string{ nullptr };
+};
+
+using SharedString = SharedStringBase<char>;
+using SharedString8 = SharedStringBase<char8_t>;
+using SharedString16 = SharedStringBase<char16_t>;
+using SharedString32 = SharedStringBase<char32_t>;
+using SharedStringW = SharedStringBase<wchar_t>;
+
+template<Character C>
+inline SharedStringBase<C>::SharedStringBase() {}
+
+template<Character C>
+inline SharedStringBase<C>::SharedStringBase(NullPointer) {}
+
+template<Character C>
+inline SharedStringBase<C>::SharedStringBase(const C* other)
+{
+	StringViewBase<C> view(other);
+	Create(view.Data(), view.Size());
+}
+
+template<Character C>
+inline SharedStringBase<C>::SharedStringBase(const C* other, U64 length)
+{
+	Create(other, length);
+}
+
+template<Character C>
+inline SharedStringBase<C>::SharedStringBase(const StringViewBase<C>& other)
+{
+	Create(other.Data(), other.Size());
+}
+
+template<Character C>
+inline SharedStringBase<C>::SharedStringBase(StringBase<C>&& other) noexcept
+{
+	Adopt(other);
+}
+
+template<Character C>
+inline SharedStringBase<C>::SharedStringBase(const SharedStringBase& other) : size{ other.size }, string{ other.string }
+{
+	if (string) { References(string).fetch_add(1, std::memory_order_relaxed); }
+}
+
+template<Character C>
+inline SharedStringBase<C>::SharedStringBase(SharedStringBase&& other) noexcept : size{ other.size }, string{ other.string }
+{
+	other.size = 0;
+	other.string = nullptr;
+}
+
+template<Character C>
+inline SharedStringBase<C>& SharedStringBase<C>::operator=(NullPointer)
+{
+	Destroy();
+
+	return *this;
+}
+
+template<Character C>
+inline SharedStringBase<C>& SharedStringBase<C>::operator=(StringBase<C>&& other) noexcept
+{
+	Destroy();
+	Adopt(other);
+
+	return *this;
+}
+
+template<Character C>
+inline SharedStringBase<C>& SharedStringBase<C>::operator=(const SharedStringBase& other)
+{
+	if (other.string == string) { return *this; }
+
+	Destroy();
+
+	size = other.size;
+	string = other.string;
+
+	if (string) { References(string).fetch_add(1, std::memory_order_relaxed); }
+
+	return *this;
+}
+
+template<Character C>
+inline SharedStringBase<C>& SharedStringBase<C>::operator=(SharedStringBase&& other) noexcept
+{
+	if (&other == this) { return *this; }
+
+	Destroy();
+
+	size = other.size;
+	string = other.string;
+
+	other.size = 0;
+	other.string = nullptr;
+
+	return *this;
+}
+
+template<Character C>
+inline SharedStringBase<C>::~SharedStringBase()
+{
+	Destroy();
+}
+
+template<Character C>
+inline void SharedStringBase<C>::Destroy()
+{
+	if (string)
+	{
+		//Release so this copy's reads happen before the free, acquire so the free happens after every other copy's reads
+		if (References(string).fetch_sub(1, std::memory_order_release) == 1)
+		{
+			std::atomic_thread_fence(std::memory_order_acquire);
+			free(string);
+		}
+
+		string = nullptr;
+	}
+
+	size = 0;
+}
+
+template<Character C>
+inline StringViewBase<C> SharedStringBase<C>::SubString(U64 start, U64 length) const
+{
+	return View().SubString(start, length);
+}
+
+template<Character C>
+inline StringBase<C> SharedStringBase<C>::ToString() const
+{
+	return StringBase<C>(View());
+}
+
+template<Character C>
+inline bool SharedStringBase<C>::Blank() const
+{
+	return View().Blank();
+}
+
+template<Character C>
+inline I64 SharedStringBase<C>::IndexOf(C c, U64 start) const
+{
+	return View().IndexOf(c, start);
+}
+
+template<Character C>
+inline I64 SharedStringBase<C>::LastIndexOf(C c, U64 start) const
+{
+	return View().LastIndexOf(c, start);
+}
+
+template<Character C>
+inline I64 SharedStringBase<C>::IndexOf(const StringViewBase<C>& find, U64 start) const
+{
+	return View().IndexOf(find, start);
+}
+
+template<Character C>
+inline bool SharedStringBase<C>::Contains(const StringViewBase<C>& find) const
+{
+	return View().Contains(find);
+}
+
+template<Character C>
+inline U64 SharedStringBase<C>::CountOccurrences(const StringViewBase<C>& find) const
+{
+	return View().CountOccurrences(find);
+}
+
+template<Character C>
+inline StringViewBase<C> SharedStringBase<C>::Trimmed() const
+{
+	return View().Trimmed();
+}
+
+template<Character C>
+inline SplitRange<C> SharedStringBase<C>::Split(C delimiter) const
+{
+	return View().Split(delimiter);
+}
+
+template<Character C>
+inline SplitRange<C> SharedStringBase<C>::Split(const StringViewBase<C>& delimiters) const
+{
+	return View().Split(delimiters);
+}
+
+template<Character C>
+inline SplitRange<C> SharedStringBase<C>::SplitLines() const
+{
+	return View().SplitLines();
+}
+
+template<Character C>
+inline SplitRange<C> SharedStringBase<C>::Tokenize(const StringViewBase<C>& delimiters) const
+{
+	return View().Tokenize(delimiters);
+}
+
+template<Character C>
+inline U64 SharedStringBase<C>::ParseI64(I64& value) const
+{
+	return View().ParseI64(value);
+}
+
+template<Character C>
+inline U64 SharedStringBase<C>::ParseU64(U64& value) const
+{
+	return View().ParseU64(value);
+}
+
+template<Character C>
+inline U64 SharedStringBase<C>::ParseF64(F64& value) const
+{
+	return View().ParseF64(value);
+}
+
+template<Character C>
+inline I32 SharedStringBase<C>::Compare(const StringViewBase<C>& other) const
+{
+	return View().Compare(other);
+}
+
+template<Character C>
+inline bool SharedStringBase<C>::EqualsIgnoreCase(const StringViewBase<C>& other) const
+{
+	return View().EqualsIgnoreCase(other);
+}
+
+template<Character C>
+inline I64 SharedStringBase<C>::IndexOfIgnoreCase(const StringViewBase<C>& find, U64 start) const
+{
+	return View().IndexOfIgnoreCase(find, start);
+}
+
+template<Character C>
+inline U64 SharedStringBase<C>::References() const
+{
+	return string ? References(string).load(std::memory_order_relaxed) : 0;
+}
+
+/// <summary>
+/// Hashes the characters, a shared string hashes equal to any other string type holding the same characters
+/// </summary>
+template<Character C>
+inline U64 Hash(const SharedStringBase<C>& string, U64 seed = 0)
+{
+	return HashBytes(string.Data(), string.Size() * sizeof(C), seed);
+}
+
+
+
+//Helpers
+template<Character C>
+inline void SharedStringBase<C>::Create(const C* other, U64 length)
+{
+	if (length == 0) { return; }
+
+	size = length;
+	string = (C*)malloc(CounterOffset(size) + sizeof(Counter));
+	Copy(string, other, size);
+	string[size] = '\0';
+
+	new (&References(string)) Counter{ 1 };
+}
+
+template<Character C>
+inline void SharedStringBase<C>::Adopt(StringBase<C>& other)
+{
+	if (other.size == 0) { other.Destroy(); return; }
+
+	size = other.size;
+	string = other.string;
+
+	U64 required = CounterOffset(size) + sizeof(Counter);
+	if (other.capacity * sizeof(C) < required) { string = (C*)realloc(string, required); }
+
+	string[size] = '\0';
+	new (&References(string)) Counter{ 1 };
+
+	other.size = 0;
+	other.capacity = 0;
+	other.string = nullptr;
+}
@@ -0,0 +1,536 @@
+#pragma once
+
+#include "ContainerDefines.hpp"
+
+#include <stdlib.h>
+#include <stddef.h>
+#include <new>
+#include <utility>
+#include <type_traits>
+
+static inline constexpr U64 SKIP_LIST_MAX_LEVEL = 32;	//Most levels a node can link on, enough for 4^32 values with one in four nodes promoted per level
+
+/// <summary>
+/// Sequence with O(log n) positional access, every node links forward on a random number of levels and each link stores how many values it skips
+/// At, Insert, Remove and iterator jumps follow the widest links that fit, while stepping an iterator only follows the bottom level
+/// </summary>
+template<typename T>
+struct SkipList
+{
+	struct Node;
+
+	struct Link
+	{
+		Node* next;
+		U64 width;	//Values between the owner of the link and next, counting next, a link to nothing spans to one past the last value
+	};
+
+	struct Node
+	{
+		Node(const T& value, U64 levels) : value{ value }, prev{ nullptr }, levels{ levels } {}
+		Node(T&& value, U64 levels) : value{ std::move(value) }, prev{ nullptr }, levels{ levels } {}
+
+		Link* Links() { return (Link*)(this + 1); }
+
+		T value;
+		Node* prev;
+		U64 levels;
+	};
+
+	struct Iterator
+	{
+	public:
+		Iterator(SkipList* list, Node* ptr) : list{ list }, ptr{ ptr } {}
+
+		T& operator* () const { return ptr->value; }
+		T* operator-> () { return &ptr->value; }
+
+		Iterator& operator++ () { ptr = ptr->Links()[0].next; return *this; }
+		Iterator& operator-- () { ptr = ptr ? ptr->prev : list->tail; return *this; }
+
+		Iterator operator++ (int)
+		{
+			Iterator temp = *this;
+			++*this;
+			return temp;
+		}
+
+		Iterator operator-- (int)
+		{
+			Iterator temp = *this;
+			--*this;
+			return temp;
+		}
+
+		/// <summary>
+		/// Jumps forward along the widest links that fit in O(log i), jumping past the last value gives end
+		/// </summary>
+		Iterator& operator+= (int i)
+		{
+			if (i < 0) { return *this -= -i; }
+
+			ptr = list->Advance(ptr, (U64)i);
+			return *this;
+		}
+
+		/// <summary>
+		/// Jumps back by searching from the front in O(log n), jumping before the first value gives end
+		/// </summary>
+		Iterator& operator-= (int i)
+		{
+			if (i < 0) { return *this += -i; }
+
+			U64 index = list->Index(*this);
+			ptr = (U64)i <= index ? list->NodeAt(index - i) : nullptr;
+			return *this;
+		}
+
+		Iterator operator+ (int i)
+		{
+			Iterator it = *this;
+			return it += i;
+		}
+
+		Iterator operator- (int i)
+		{
+			Iterator it = *this;
+			return it -= i;
+		}
+
+		friend bool operator== (const Iterator& a, const Iterator& b) { return a.ptr == b.ptr; }
+		friend bool operator!= (const Iterator& a, const Iterator& b) { return a.ptr != b.ptr; }
+
+		operator bool() { return ptr; }
+
+	private:
+		SkipList* list;
+		Node* ptr;
+
+		friend struct SkipList;
+	};
+
+public:
+	SkipList();
+	SkipList(const SkipList& other);
+	SkipList(SkipList&& other) noexcept;
+	SkipList& operator=(const SkipList& other);
+	SkipList& operator=(SkipList&& other) noexcept;
+
+	~SkipList();
+
+	/// <summary>
+	/// Destroys every value and frees every node
+	/// </summary>
+	void Destroy();
+
+	void PushBack(const T& value);
+	void PushBack(T&& value);
+	void PopBack();
+	void PushFront(const T& value);
+	void PushFront(T&& value);
+	void PopFront();
+
+	/// <summary>
+	/// Inserts value so it ends up at index in O(log n), an index past the end inserts at the back
+	/// </summary>
+	void Insert(U64 index, const T& value);
+	void Insert(U64 index, T&& value);
+	void InsertBack(Iterator& position, const T& value);
+	void InsertBack(Iterator& position, T&& value);
+	void InsertFront(Iterator& position, const T& value);
+	void InsertFront(Iterator& position, T&& value);
+
+	/// <summary>
+	/// Removes the value at index in O(log n)
+	/// </summary>
+	void Remove(U64 index);
+
+	/// <summary>
+	/// Removes the value at position, position is moved to the value after it
+	/// </summary>
+	void Remove(Iterator& position);
+	template<typename Predicate> U64 RemoveIf(Predicate predicate);
+
+	/// <returns>The value at index in O(log n)</returns>
+	T& At(U64 index) { return NodeAt(index)->value; }
+	const T& At(U64 index) const { return NodeAt(index)->value; }
+	T& operator[](U64 index) { return NodeAt(index)->value; }
+	const T& operator[](U64 index) const { return NodeAt(index)->value; }
+
+	/// <returns>The index of the value at position in O(log n), Size for end</returns>
+	U64 Index(const Iterator& position) const;
+
+	Iterator begin() { return { this, head[0].next }; }
+	Iterator end() { return { this, nullptr }; }
+	Iterator begin() const { return { (SkipList*)this, head[0].next }; }
+	Iterator end() const { return { (SkipList*)this, nullptr }; }
+
+	U64 Size() const { return size; }
+	T& Front() { return head[0].next->value; }
+	const T& Front() const { return head[0].next->value; }
+	T& Back() { return tail->value; }
+	const T& Back() const { return tail->value; }
+
+private:
+	static_assert(alignof(T) <= alignof(max_align_t), "Over-aligned values aren't supported");
+
+	template<typename Value> inline void InsertAt(U64 index, Value&& value);
+	inline void EraseAt(U64 index);
+	inline Node* NodeAt(U64 index) const;
+	inline Node* Advance(Node* node, U64 count) const;
+	inline U64 RandomLevel();
+	inline void Reset();
+
+	Link head[SKIP_LIST_MAX_LEVEL];
+	Node* tail;
+	U64 levels;
+	U64 size;
+	U64 seed;
+};
+
+template<typename T> inline SkipList<T>::SkipList()
+{
+	seed = 0x9E3779B97F4A7C15ULL;
+	Reset();
+}
+
+template<typename T> inline SkipList<T>::SkipList(const SkipList<T>& other)
+{
+	seed = 0x9E3779B97F4A7C15ULL;
+	Reset();
+
+	for (const T& value : other) { PushBack(value); }
+}
+
+template<typename T> inline SkipList<T>::SkipList(SkipList<T>&& other) noexcept : tail{ other.tail }, levels{ other.levels }, size{ other.size }, seed{ other.seed }
+{
+	for (U64 i = 0; i < SKIP_LIST_MAX_LEVEL; ++i) { head[i] = other.head[i]; }
+
+	other.Reset();
+}
+
+template<typename T> inline SkipList<T>& SkipList<T>::operator=(const SkipList<T>& other)
+{
+	if (&other == this) { return *this; }
+
+	Destroy();
+
+	for (const T& value : other) { PushBack(value); }
+
+	return *this;
+}
+
+template<typename T> inline SkipList<T>& SkipList<T>::operator=(SkipList<T>&& other) noexcept
+{
+	if (&other == this) { return *this; }
+
+	Destroy();
+
+	for (U64 i = 0; i < SKIP_LIST_MAX_LEVEL; ++i) { head[i] = other.head[i]; }
+	tail = other.tail;
+	levels = other.levels;
+	size = other.size;
+
+	other.Reset();
+
+	return *this;
+}
+
+template<typename T> inline SkipList<T>::~SkipList()
+{
+	Destroy();
+}
+
+template<typename T> inline void SkipList<T>::Destroy()
+{
+	for (Node* node = head[0].next; node;)
+	{
+		Node* next = node->Links()[0].next;
+		node->~Node();
+		free(node);
+		node = next;
+	}
+
+	Reset();
+}
+
+template<typename T> inline void SkipList<T>::PushBack(const T& value)
+{
+	InsertAt(size, value);
+}
+
+template<typename T> inline void SkipList<T>::PushBack(T&& value)
+{
+	InsertAt(size, std::move(value));
+}
+
+template<typename T> inline void SkipList<T>::PopBack()
+{
+	if (size) { EraseAt(size - 1); }
+}
+
+template<typename T> inline void SkipList<T>::PushFront(const T& value)
+{
+	InsertAt(0, value);
+}
+
+template<typename T> inline void SkipList<T>::PushFront(T&& value)
+{
+	InsertAt(0, std::move(value));
+}
+
+template<typename T> inline void SkipList<T>::PopFront()
+{
+	if (size) { EraseAt(0); }
+}
+
+template<typename T> inline void SkipList<T>::Insert(U64 index, const T& value)
+{
+	InsertAt(index < size ? index : size, value);
+}
+
+template<typename T> inline void SkipList<T>::Insert(U64 index, T&& value)
+{
+	InsertAt(index < size ? index : size, std::move(value));
+}
+
+template<typename T> inline void SkipList<T>::InsertBack(Iterator& position, const T& value)
+{
+	InsertAt(position.ptr ? Index(position) + 1 : size, value);
+}
+
+template<typename T> inline void SkipList<T>::InsertBack(Iterator& position, T&& value)
+{
+	InsertAt(position.ptr ? Index(position) + 1 : size, std::move(value));
+}
+
+template<typename T> inline void SkipList<T>::InsertFront(Iterator& position, const T& value)
+{
+	InsertAt(Index(position), value);
+}
+
+template<typename T> inline void SkipList<T>::InsertFront(Iterator& position, T&& value)
+{
+	InsertAt(Index(position), std::move(value));
+}
+
+template<typename T> inline void SkipList<T>::Remove(U64 index)
+{
+	if (index < size) { EraseAt(index); }
+}
+
+template<typename T> inline void SkipList<T>::Remove(Iterator& position)
+{
+	if (!position.ptr) { return; }
+
+	U64 index = Index(position);
+	position.ptr = position.ptr->Links()[0].next;
+	EraseAt(index);
+}
+
+template<typename T> template<typename Predicate> inline U64 SkipList<T>::RemoveIf(Predicate predicate)
+{
+	U64 removed = 0;
+	U64 index = 0;
+
+	for (Node* node = head[0].next; node;)
+	{
+		Node* next = node->Links()[0].next;
+
+		if (predicate(node->value))
+		{
+			EraseAt(index);
+			++removed;
+		}
+		else { ++index; }
+
+		node = next;
+	}
+
+	return removed;
+}
+
+template<typename T> inline U64 SkipList<T>::Index(const Iterator& position) const
+{
+	if (!position.ptr) { return size; }
+
+	//Following the highest link of each node climbs towards the top levels, the widths add up to the distance to one past the last value
+	U64 distance = 0;
+
+	for (Node* node = position.ptr;;)
+	{
+		const Link& top = node->Links()[node->levels - 1];
+		distance += top.width;
+
+		if (!top.next) { break; }
+		node = top.next;
+	}
+
+	//The value at index sits at position index + 1 and one past the last value at size + 1
+	return size - distance;
+}
+
+
+
+
+//Helpers
+template<typename T> template<typename Value> inline void SkipList<T>::InsertAt(U64 index, Value&& value)
+{
+	Link* update[SKIP_LIST_MAX_LEVEL];
+	U64 positions[SKIP_LIST_MAX_LEVEL];
+
+	//Positions count from the head at 0, so the value at index sits at index + 1
+	Link* links = head;
+	Node* prev = nullptr;
+	U64 position = 0;
+
+	for (U64 level = levels; level--;)
+	{
+		while (links[level].next && position + links[level].width <= index)
+		{
+			position += links[level].width;
+			prev = links[level].next;
+			links = prev->Links();
+		}
+
+		update[level] = links;
+		positions[level] = position;
+	}
+
+	U64 nodeLevels = RandomLevel();
+
+	for (; levels < nodeLevels; ++levels)
+	{
+		head[levels].next = nullptr;
+		head[levels].width = size + 1;
+		update[levels] = head;
+		positions[levels] = 0;
+	}
+
+	Node* node = new (malloc(sizeof(Node) + nodeLevels * sizeof(Link))) Node(std::forward<Value>(value), nodeLevels);
+	Link* nodeLinks = node->Links();
+	U64 nodePosition = index + 1;
+
+	for (U64 level = 0; level < nodeLevels; ++level)
+	{
+		Link& before = update[level][level];
+
+		nodeLinks[level].next = before.next;
+		nodeLinks[level].width = positions[level] + before.width + 1 - nodePosition;
+		before.next = node;
+		before.width = nodePosition - positions[level];
+	}
+
+	for (U64 level = nodeLevels; level < levels; ++level) { ++update[level][level].width; }
+
+	node->prev = prev;
+	if (nodeLinks[0].next) { nodeLinks[0].next->prev = node; }
+	else { tail = node; }
+
+	++size;
+}
+
+template<typename T> inline void SkipList<T>::EraseAt(U64 index)
+{
+	Link* update[SKIP_LIST_MAX_LEVEL];
+
+	Link* links = head;
+	U64 position = 0;
+
+	for (U64 level = levels; level--;)
+	{
+		while (links[level].next && position + links[level].width <= index)
+		{
+			position += links[level].width;
+			links = links[level].next->Links();
+		}
+
+		update[level] = links;
+	}
+
+	Node* node = update[0][0].next;
+	Link* nodeLinks = node->Links();
+
+	for (U64 level = 0; level < node->levels; ++level)
+	{
+		Link& before = update[level][level];
+		before.next = nodeLinks[level].next;
+		before.width += nodeLinks[level].width - 1;
+	}
+
+	for (U64 level = node->levels; level < levels; ++level) { --update[level][level].width; }
+
+	if (nodeLinks[0].next) { nodeLinks[0].next->prev = node->prev; }
+	else { tail = node->prev; }
+
+	while (levels > 1 && !head[levels - 1].next) { --levels; }
+
+	node->~Node();
+	free(node);
+	--size;
+}
+
+template<typename T> inline typename SkipList<T>::Node* SkipList<T>::NodeAt(U64 index) const
+{
+	if (index >= size) { return nullptr; }
+
+	const Link* links = head;
+	Node* node = nullptr;
+	U64 position = 0;
+	U64 target = index + 1;
+
+	for (U64 level = levels; level--;)
+	{
+		while (links[level].next && position + links[level].width <= target)
+		{
+			position += links[level].width;
+			node = links[level].next;
+			links = node->Links();
+		}
+
+		if (position == target) { break; }
+	}
+
+	return node;
+}
+
+template<typename T> inline typename SkipList<T>::Node* SkipList<T>::Advance(Node* node, U64 count) const
+{
+	//Each step takes the highest link of the current node that doesn't overshoot, so long jumps climb onto taller nodes
+	while (count && node)
+	{
+		Link* links = node->Links();
+		U64 level = node->levels;
+
+		while (level && (!links[level - 1].next || links[level - 1].width > count)) { --level; }
+		if (!level) { return nullptr; }
+
+		count -= links[level - 1].width;
+		node = links[level - 1].next;
+	}
+
+	return node;
+}
+
+template<typename T> inline U64 SkipList<T>::RandomLevel()
+{
+	seed ^= seed << 13;
+	seed ^= seed >> 7;
+	seed ^= seed << 17;
+
+	//Each pair of bits promotes a node one more level with a chance of one in four
+	U64 bits = seed;
+	U64 level = 1;
+	while ((bits & 3) == 0 && level < SKIP_LIST_MAX_LEVEL) { ++level; bits >>= 2; }
+
+	return level;
+}
+
+template<typename T> inline void SkipList<T>::Reset()
+{
+	head[0].next = nullptr;
+	head[0].width = 1;
+	tail = nullptr;
+	levels = 1;
+	size = 0;
+}
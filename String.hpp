@@ -5,6 +5,10 @@
 #include <type_traits>
 #include <string>
 #include <bit>
+#include <charconv>
+#include <limits>
+#include <compare>
+#include <memory>
 
 template <class Type, U64 Count> struct GetPointerCount { static constexpr U64 count = Count; };
 template <class Type, U64 Count> struct GetPointerCount<Type*, Count> : public GetPointerCount<Type, Count + 1> { };
@@ -15,6 +19,9 @@ template <class Type> inline constexpr bool IsCharacter = std::_Is_any_of_v<std:
 template <class Type> concept Character = IsCharacter<Type>;
 
 template<Character C> struct StringBase;
+template<Character C> struct StringViewBase;
+template<Character C> struct SplitRange;
+template<Character C> struct SharedStringBase;
 
 using String = StringBase<char>;
 using String8 = StringBase<char8_t>;
@@ -22,536 +29,3303 @@ using String16 = StringBase<char16_t>;
 using String32 = StringBase<char32_t>;
 using StringW = StringBase<wchar_t>;
 
+using StringView = StringViewBase<char>;
+using StringView8 = StringViewBase<char8_t>;
+using StringView16 = StringViewBase<char16_t>;
+using StringView32 = StringViewBase<char32_t>;
+using StringViewW = StringViewBase<wchar_t>;
+
 template <class Type> constexpr const bool IsStringLiteral = IsCharacter<std::remove_extent_t<std::remove_pointer_t<Type>>> && (PointerCount<Type> == 1 || std::rank_v<Type> == 1);
 template <class Type> concept StringLiteral = IsStringLiteral<Type>;
-template <class Type> inline constexpr bool IsStringType = std::_Is_any_of_v<std::remove_cvref_t<Type>, String, String8, String16, String32, StringW>;
+template <class Type> inline constexpr bool IsStringType = std::_Is_any_of_v<std::remove_cvref_t<Type>, String, String8, String16, String32, StringW, StringView, StringView8, StringView16, StringView32, StringViewW>;
 template <class Type> concept StringType = IsStringType<Type>;
 template <class Type> inline constexpr bool IsNonStringPointer = std::is_pointer_v<Type> && !IsStringLiteral<Type>;
 template <class Type> concept NonStringPointer = IsNonStringPointer<Type>;
 template <class Type> inline constexpr bool IsNonStringClass = std::is_class_v<Type> && !IsStringType<Type>;
 template <class Type> concept NonStringClass = IsNonStringClass<Type>;
 
-//TODO:
-//Formatting
-//
+//Search
+#if defined(__AVX2__)
+static inline constexpr U64 SEARCH_BLOCK = 32;	//Bytes compared per step by the search kernels
+#else
+static inline constexpr U64 SEARCH_BLOCK = 16;	//Bytes compared per step by the search kernels
+#endif
+static inline constexpr U64 SEARCH_SHORT_NEEDLE = 32;	//Longest needle handled by the first/last character filter, longer needles use Two-Way
+static inline constexpr U64 SEARCH_SMALL_SET = 8;	//Largest delimiter set SearchAny compares a block at a time
+
+/// <summary>
+/// Compares one block of characters against c
+/// </summary>
+/// <returns>A byte mask with the lowest bit of every matching lane set</returns>
 template<Character C>
-struct StringBase
+inline U32 SearchCompare(const C* it, C c)
 {
-	StringBase();
-	StringBase(NullPointer);
-	StringBase(U64 length);
-	StringBase(const C* other);
-	StringBase(const C* other, U64 length);
-	StringBase(const StringBase& other);
-	StringBase(StringBase&& other) noexcept;
-
-	StringBase& operator=(NullPointer);
-	StringBase& operator=(const C* other);
-	StringBase& operator=(const StringBase& other);
-	StringBase& operator=(StringBase&& other) noexcept;
-
-	~StringBase();
-	void Destroy();
-	void Clear();
-	void Resize();
-	void Reserve(U64 capacity);
-
-	StringBase SubString(U64 start, U64 length = U64_MAX) const;
-	StringBase Appended(const StringBase& append) const;
-	StringBase Prepended(const StringBase& prepend) const;
-	StringBase Surrounded(const StringBase& prepend, const StringBase& append) const;
-
-	StringBase& Shave(U64 start, U64 length = U64_MAX);
-	StringBase& Append(const StringBase& append);
-	StringBase& Prepend(const StringBase& prepend);
-	StringBase& Surround(const StringBase& prepend, const StringBase& append);
-
-	bool Blank() const;
-	I64 IndexOf(C c, U64 start = 0) const;
-	I64 LastIndexOf(C c, U64 start = 0) const;
-
-	StringBase& Trim();
-	StringBase& ToUpper();
-	StringBase& ToLower();
-	StringBase& ToCapital();
-
-	const U64& Size() const;
-	const U64& Capacity() const;
-
-	C* Data();
-	const C* Data() const;
-	operator C* ();
-	operator const C* () const;
-
-	C* begin();
-	C* end();
-	const C* begin() const;
-	const C* end() const;
-
-	C* rbegin();
-	C* rend();
-	const C* rbegin() const;
-	const C* rend() const;
+#if defined(__AVX2__)
+	__m256i block = _mm256_loadu_si256((const __m256i*)it);
+	U32 mask;
+	if constexpr (sizeof(C) == 1) { mask = (U32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, _mm256_set1_epi8((char)c))); }
+	else if constexpr (sizeof(C) == 2) { mask = (U32)_mm256_movemask_epi8(_mm256_cmpeq_epi16(block, _mm256_set1_epi16((short)c))); }
+	else { mask = (U32)_mm256_movemask_epi8(_mm256_cmpeq_epi32(block, _mm256_set1_epi32((int)c))); }
+#else
+	__m128i block = _mm_loadu_si128((const __m128i*)it);
+	U32 mask;
+	if constexpr (sizeof(C) == 1) { mask = (U32)_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8((char)c))); }
+	else if constexpr (sizeof(C) == 2) { mask = (U32)_mm_movemask_epi8(_mm_cmpeq_epi16(block, _mm_set1_epi16((short)c))); }
+	else { mask = (U32)_mm_movemask_epi8(_mm_cmpeq_epi32(block, _mm_set1_epi32((int)c))); }
+#endif
+
+	if constexpr (sizeof(C) == 1) { return mask; }
+	else if constexpr (sizeof(C) == 2) { return mask & 0x55555555U; }
+	else { return mask & 0x11111111U; }
+}
 
-private:
-	void Allocate(U64 length);
-	void Reallocate(U64 length);
-	constexpr U64 Length(const C* str) const;
-	bool Blank(C c) const;
-	bool NotBlank(C c) const;
+/// <summary>
+/// Finds the first occurrence of c in [it, end)
+/// </summary>
+/// <returns>Pointer to the occurrence, nullptr if there is none</returns>
+template<Character C>
+constexpr inline const C* SearchChar(const C* it, const C* end, C c)
+{
+	constexpr U64 lanes = SEARCH_BLOCK / sizeof(C);
 
-	U64 size{ 0 };
-	U64 capacity{ 0 };
-	C* string{ nullptr };
-};
+	if (!std::is_constant_evaluated())
+	{
+		for (; (U64)(end - it) >= lanes; it += lanes)
+		{
+			U32 mask = SearchCompare(it, c);
+			if (mask) { return it + std::countr_zero(mask) / sizeof(C); }
+		}
+	}
+
+	for (; it != end; ++it) { if (*it == c) { return it; } }
+
+	return nullptr;
+}
 
+/// <summary>
+/// Finds the first character of [it, end) that is in set, sets of up to SEARCH_SMALL_SET characters are compared a block at a time
+/// </summary>
+/// <returns>Pointer to the occurrence, nullptr if there is none</returns>
 template<Character C>
-inline StringBase<C>::StringBase() {}
+inline const C* SearchAny(const C* it, const C* end, const C* set, U64 setSize)
+{
+	constexpr U64 lanes = SEARCH_BLOCK / sizeof(C);
+
+	if (setSize == 0) { return nullptr; }
+	if (setSize == 1) { return SearchChar(it, end, *set); }
+
+	if (setSize <= SEARCH_SMALL_SET)
+	{
+		for (; (U64)(end - it) >= lanes; it += lanes)
+		{
+			U32 mask = 0;
+			for (U64 i = 0; i < setSize; ++i) { mask |= SearchCompare(it, set[i]); }
+			if (mask) { return it + std::countr_zero(mask) / sizeof(C); }
+		}
+	}
+	else if constexpr (sizeof(C) == 1)
+	{
+		U64 bitmap[4] = {};
+		for (U64 i = 0; i < setSize; ++i) { U8 c = (U8)set[i]; bitmap[c >> 6] |= 1ULL << (c & 63); }
+
+		for (; it != end; ++it) { U8 c = (U8)*it; if (bitmap[c >> 6] & (1ULL << (c & 63))) { return it; } }
+		return nullptr;
+	}
+
+	for (; it != end; ++it)
+	{
+		for (U64 i = 0; i < setSize; ++i) { if (*it == set[i]) { return it; } }
+	}
 
+	return nullptr;
+}
+
+/// <summary>
+/// Finds needles of up to SEARCH_SHORT_NEEDLE characters by comparing a block of candidate first and last characters at once, only lanes where both match are verified
+/// </summary>
 template<Character C>
-inline StringBase<C>::StringBase(NullPointer) {}
+inline I64 SearchShort(const C* string, U64 size, const C* find, U64 findSize)
+{
+	constexpr U64 lanes = SEARCH_BLOCK / sizeof(C);
+
+	const C first = find[0];
+	const C last = find[findSize - 1];
+	const U64 last0 = findSize - 1;
+	U64 i = 0;
 
+	for (; i + last0 + lanes <= size; i += lanes)
+	{
+		U32 mask = SearchCompare(string + i, first) & SearchCompare(string + i + last0, last);
+
+		while (mask)
+		{
+			U64 index = i + std::countr_zero(mask) / sizeof(C);
+			if (memcmp(string + index + 1, find + 1, (findSize - 2) * sizeof(C)) == 0) { return index; }
+			mask &= mask - 1;
+		}
+	}
+
+	for (; i + findSize <= size; ++i)
+	{
+		if (string[i] == first && string[i + last0] == last && memcmp(string + i + 1, find + 1, (findSize - 2) * sizeof(C)) == 0) { return i; }
+	}
+
+	return -1;
+}
+
+/// <summary>
+/// Crochemore-Perrin Two-Way search with a bad character shift, linear worst case and constant extra space
+/// </summary>
 template<Character C>
-inline StringBase<C>::StringBase(U64 length) : size{ length }
+inline I64 SearchTwoWay(const C* string, U64 size, const C* find, U64 findSize)
 {
-	Allocate(size);
+	U64 charset[4]{};
+	U64 shift[256];
+
+	for (U64 i = 0; i < findSize; ++i)
+	{
+		U8 bucket = (U8)find[i];
+		charset[bucket >> 6] |= 1ULL << (bucket & 63);
+		shift[bucket] = i + 1;
+	}
+
+	//Maximal suffix
+	U64 ip = U64_MAX, jp = 0, k = 1, p = 1;
+	while (jp + k < findSize)
+	{
+		if (find[ip + k] == find[jp + k])
+		{
+			if (k == p) { jp += p; k = 1; }
+			else { ++k; }
+		}
+		else if (find[ip + k] > find[jp + k]) { jp += k; k = 1; p = jp - ip; }
+		else { ip = jp++; k = p = 1; }
+	}
+	U64 ms = ip;
+	U64 p0 = p;
+
+	//Maximal suffix with the opposite order
+	ip = U64_MAX; jp = 0; k = p = 1;
+	while (jp + k < findSize)
+	{
+		if (find[ip + k] == find[jp + k])
+		{
+			if (k == p) { jp += p; k = 1; }
+			else { ++k; }
+		}
+		else if (find[ip + k] < find[jp + k]) { jp += k; k = 1; p = jp - ip; }
+		else { ip = jp++; k = p = 1; }
+	}
+	if (ip + 1 > ms + 1) { ms = ip; }
+	else { p = p0; }
+
+	U64 memory0;
+	if (memcmp(find, find + p, (ms + 1) * sizeof(C)))
+	{
+		memory0 = 0;
+		p = (ms > findSize - ms - 1 ? ms : findSize - ms - 1) + 1;
+	}
+	else { memory0 = findSize - p; }
+
+	U64 memory = 0;
+	const C* it = string;
+	const C* end = string + size;
+
+	while ((U64)(end - it) >= findSize)
+	{
+		U8 bucket = (U8)it[findSize - 1];
+		if (charset[bucket >> 6] & (1ULL << (bucket & 63)))
+		{
+			k = findSize - shift[bucket];
+			if (k)
+			{
+				it += k < memory ? memory : k;
+				memory = 0;
+				continue;
+			}
+		}
+		else
+		{
+			it += findSize;
+			memory = 0;
+			continue;
+		}
+
+		//Right half
+		for (k = ms + 1 > memory ? ms + 1 : memory; k < findSize && find[k] == it[k]; ++k);
+		if (k < findSize)
+		{
+			it += k - ms;
+			memory = 0;
+			continue;
+		}
+
+		//Left half
+		for (k = ms + 1; k > memory && find[k - 1] == it[k - 1]; --k);
+		if (k <= memory) { return it - string; }
+
+		it += p;
+		memory = memory0;
+	}
+
+	return -1;
 }
 
+template<bool IgnoreCase, Character C> constexpr U64 CompareMismatch(const C* a, const C* b, U64 size);
+
+/// <summary>
+/// Finds the first occurrence of find in string, picks the algorithm based on the length of find, during constant evaluation every position is compared
+/// </summary>
+/// <returns>The index of the occurrence, -1 if there is none</returns>
 template<Character C>
-inline StringBase<C>::StringBase(const C* other) : size{ Length(other) }
+constexpr inline I64 Search(const C* string, U64 size, const C* find, U64 findSize)
 {
-	Allocate(size);
-	Copy(string, other, size);
-	string[size] = '\0';
+	if (findSize == 0) { return 0; }
+	if (findSize > size) { return -1; }
+
+	if (findSize == 1)
+	{
+		const C* it = SearchChar(string, string + size, *find);
+		return it ? it - string : -1;
+	}
+
+	if (std::is_constant_evaluated())
+	{
+		for (U64 i = 0; i <= size - findSize; ++i) { if (CompareMismatch<false>(string + i, find, findSize) == findSize) { return i; } }
+		return -1;
+	}
+
+	if (findSize <= SEARCH_SHORT_NEEDLE) { return SearchShort(string, size, find, findSize); }
+
+	return SearchTwoWay(string, size, find, findSize);
 }
 
+//Comparison
+#if defined(__AVX2__)
+/// <summary>
+/// Flips ASCII letters in [from, from + 26) to the other case, other characters pass through
+/// </summary>
 template<Character C>
-inline StringBase<C>::StringBase(const C* other, U64 length) : size{ length }
+inline __m256i CaseFoldBlock(__m256i block, C from)
 {
-	Allocate(size);
-	Copy(string, other, size);
-	string[size] = '\0';
+	__m256i inRange;
+	if constexpr (sizeof(C) == 1) { inRange = _mm256_and_si256(_mm256_cmpgt_epi8(block, _mm256_set1_epi8((char)(from - 1))), _mm256_cmpgt_epi8(_mm256_set1_epi8((char)(from + 26)), block)); }
+	else if constexpr (sizeof(C) == 2) { inRange = _mm256_and_si256(_mm256_cmpgt_epi16(block, _mm256_set1_epi16((short)(from - 1))), _mm256_cmpgt_epi16(_mm256_set1_epi16((short)(from + 26)), block)); }
+	else { inRange = _mm256_and_si256(_mm256_cmpgt_epi32(block, _mm256_set1_epi32((int)(from - 1))), _mm256_cmpgt_epi32(_mm256_set1_epi32((int)(from + 26)), block)); }
+
+	__m256i flip;
+	if constexpr (sizeof(C) == 1) { flip = _mm256_set1_epi8(0x20); }
+	else if constexpr (sizeof(C) == 2) { flip = _mm256_set1_epi16(0x20); }
+	else { flip = _mm256_set1_epi32(0x20); }
+
+	return _mm256_xor_si256(block, _mm256_and_si256(inRange, flip));
 }
 
+/// <summary>
+/// Converts the ASCII letters of one block from [from, from + 26) to the other case in place
+/// </summary>
 template<Character C>
-inline StringBase<C>::StringBase(const StringBase& other) : size{ other.size }
+inline void CaseFold(C* it, C from)
 {
-	Allocate(size);
-	Copy(string, other.string, size + 1);
+	_mm256_storeu_si256((__m256i*)it, CaseFoldBlock(_mm256_loadu_si256((const __m256i*)it), from));
+}
+
+/// <returns>A byte mask with a bit set for every byte that differs between the blocks at a and b, letters lowered first if IgnoreCase</returns>
+template<bool IgnoreCase, Character C>
+inline U32 CompareBlock(const C* a, const C* b)
+{
+	__m256i x = _mm256_loadu_si256((const __m256i*)a);
+	__m256i y = _mm256_loadu_si256((const __m256i*)b);
+
+	if constexpr (IgnoreCase)
+	{
+		x = CaseFoldBlock(x, (C)'A');
+		y = CaseFoldBlock(y, (C)'A');
+	}
+
+	return ~(U32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y));
 }
 
+/// <summary>
+/// Compares one block of characters against c, which must already be lowercase, ignoring ASCII case
+/// </summary>
+/// <returns>A byte mask with the lowest bit of every matching lane set</returns>
 template<Character C>
-inline StringBase<C>::StringBase(StringBase&& other) noexcept : size{ other.size }, capacity{ other.capacity }, string{ other.string }
+inline U32 SearchCompareIgnoreCase(const C* it, C c)
 {
-	other.size = 0;
-	other.capacity = 0;
-	other.string = nullptr;
+	__m256i block = CaseFoldBlock(_mm256_loadu_si256((const __m256i*)it), (C)'A');
+	U32 mask;
+	if constexpr (sizeof(C) == 1) { mask = (U32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, _mm256_set1_epi8((char)c))); }
+	else if constexpr (sizeof(C) == 2) { mask = (U32)_mm256_movemask_epi8(_mm256_cmpeq_epi16(block, _mm256_set1_epi16((short)c))) & 0x55555555U; }
+	else { mask = (U32)_mm256_movemask_epi8(_mm256_cmpeq_epi32(block, _mm256_set1_epi32((int)c))) & 0x11111111U; }
+
+	return mask;
+}
+#else
+/// <summary>
+/// Flips ASCII letters in [from, from + 26) to the other case, other characters pass through
+/// </summary>
+template<Character C>
+inline __m128i CaseFoldBlock(__m128i block, C from)
+{
+	__m128i inRange;
+	if constexpr (sizeof(C) == 1) { inRange = _mm_and_si128(_mm_cmpgt_epi8(block, _mm_set1_epi8((char)(from - 1))), _mm_cmpgt_epi8(_mm_set1_epi8((char)(from + 26)), block)); }
+	else if constexpr (sizeof(C) == 2) { inRange = _mm_and_si128(_mm_cmpgt_epi16(block, _mm_set1_epi16((short)(from - 1))), _mm_cmpgt_epi16(_mm_set1_epi16((short)(from + 26)), block)); }
+	else { inRange = _mm_and_si128(_mm_cmpgt_epi32(block, _mm_set1_epi32((int)(from - 1))), _mm_cmpgt_epi32(_mm_set1_epi32((int)(from + 26)), block)); }
+
+	__m128i flip;
+	if constexpr (sizeof(C) == 1) { flip = _mm_set1_epi8(0x20); }
+	else if constexpr (sizeof(C) == 2) { flip = _mm_set1_epi16(0x20); }
+	else { flip = _mm_set1_epi32(0x20); }
+
+	return _mm_xor_si128(block, _mm_and_si128(inRange, flip));
 }
 
+/// <summary>
+/// Converts the ASCII letters of one block from [from, from + 26) to the other case in place
+/// </summary>
 template<Character C>
-inline StringBase<C>& StringBase<C>::operator=(NullPointer)
+inline void CaseFold(C* it, C from)
 {
-	Destroy();
+	_mm_storeu_si128((__m128i*)it, CaseFoldBlock(_mm_loadu_si128((const __m128i*)it), from));
+}
 
-	return *this;
+/// <returns>A byte mask with a bit set for every byte that differs between the blocks at a and b, letters lowered first if IgnoreCase</returns>
+template<bool IgnoreCase, Character C>
+inline U32 CompareBlock(const C* a, const C* b)
+{
+	__m128i x = _mm_loadu_si128((const __m128i*)a);
+	__m128i y = _mm_loadu_si128((const __m128i*)b);
+
+	if constexpr (IgnoreCase)
+	{
+		x = CaseFoldBlock(x, (C)'A');
+		y = CaseFoldBlock(y, (C)'A');
+	}
+
+	return ~(U32)_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) & 0xFFFFU;
+}
+
+/// <summary>
+/// Compares one block of characters against c, which must already be lowercase, ignoring ASCII case
+/// </summary>
+/// <returns>A byte mask with the lowest bit of every matching lane set</returns>
+template<Character C>
+inline U32 SearchCompareIgnoreCase(const C* it, C c)
+{
+	__m128i block = CaseFoldBlock(_mm_loadu_si128((const __m128i*)it), (C)'A');
+	U32 mask;
+	if constexpr (sizeof(C) == 1) { mask = (U32)_mm_movemask_epi8(_mm_cmpeq_epi8(block, _mm_set1_epi8((char)c))); }
+	else if constexpr (sizeof(C) == 2) { mask = (U32)_mm_movemask_epi8(_mm_cmpeq_epi16(block, _mm_set1_epi16((short)c))) & 0x55555555U; }
+	else { mask = (U32)_mm_movemask_epi8(_mm_cmpeq_epi32(block, _mm_set1_epi32((int)c))) & 0x11111111U; }
+
+	return mask;
+}
+#endif
+
+template<Character C>
+constexpr inline C CaseLower(C c) { return c >= 'A' && c <= 'Z' ? (C)(c + 32) : c; }
+
+template<Character C>
+constexpr inline C CaseUpper(C c) { return c >= 'a' && c <= 'z' ? (C)(c - 32) : c; }
+
+/// <summary>
+/// Converts the ASCII letters of [it, end) from [from, from + 26) to the other case, a block at a time
+/// </summary>
+template<Character C>
+constexpr inline void CaseConvert(C* it, C* end, C from)
+{
+	constexpr U64 lanes = SEARCH_BLOCK / sizeof(C);
+
+	if (!std::is_constant_evaluated()) { for (; (U64)(end - it) >= lanes; it += lanes) { CaseFold(it, from); } }
+	for (; it != end; ++it) { if (*it >= from && *it < from + 26) { *it ^= 0x20; } }
+}
+
+/// <returns>The index of the first character that differs between a and b in their first size characters, size if there is none</returns>
+template<bool IgnoreCase, Character C>
+constexpr inline U64 CompareMismatch(const C* a, const C* b, U64 size)
+{
+	constexpr U64 lanes = SEARCH_BLOCK / sizeof(C);
+
+	U64 i = 0;
+	if (!std::is_constant_evaluated())
+	{
+		for (; i + lanes <= size; i += lanes)
+		{
+			U32 mask = CompareBlock<IgnoreCase>(a + i, b + i);
+			if (mask) { return i + std::countr_zero(mask) / sizeof(C); }
+		}
+	}
+
+	for (; i < size; ++i)
+	{
+		if constexpr (IgnoreCase) { if (CaseLower(a[i]) != CaseLower(b[i])) { return i; } }
+		else { if (a[i] != b[i]) { return i; } }
+	}
+
+	return size;
+}
+
+/// <summary>
+/// Orders two strings by their characters as unsigned code units, a string that is a prefix of the other comes first
+/// </summary>
+/// <returns>Negative if a comes first, 0 if they are equal, positive if b comes first</returns>
+template<Character C>
+constexpr inline I32 CompareStrings(const C* a, U64 aSize, const C* b, U64 bSize)
+{
+	using Unit = std::make_unsigned_t<C>;
+
+	U64 size = aSize < bSize ? aSize : bSize;
+	U64 index = CompareMismatch<false>(a, b, size);
+
+	if (index < size) { return (Unit)a[index] < (Unit)b[index] ? -1 : 1; }
+	return aSize < bSize ? -1 : aSize > bSize ? 1 : 0;
+}
+
+/// <summary>
+/// Checks equality, strings of different lengths are rejected before any character is read
+/// </summary>
+template<Character C>
+constexpr inline bool EqualStrings(const C* a, U64 aSize, const C* b, U64 bSize)
+{
+	return aSize == bSize && (a == b || CompareMismatch<false>(a, b, aSize) == aSize);
+}
+
+//Formatting
+static inline constexpr char FORMAT_DIGIT_PAIRS[] =
+	"00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+	"40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+	"8081828384858687888990919293949596979899";
+
+static inline constexpr U64 FORMAT_POWERS[] = {
+	1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL, 1000000000ULL,
+	10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL, 100000000000000ULL, 1000000000000000ULL,
+	10000000000000000ULL, 100000000000000000ULL, 1000000000000000000ULL, 10000000000000000000ULL
+};
+
+static inline constexpr U64 FORMAT_FLOAT_SIZE = 24;	//Longest shortest round-trip double, "-2.2250738585072014e-308"
+
+/// <returns>The amount of decimal digits in value</returns>
+static inline U64 FormatDigits(U64 value)
+{
+	U64 guess = ((U64)std::bit_width(value | 1) * 1233) >> 12;
+	return guess + ((value | 1) >= FORMAT_POWERS[guess]);
+}
+
+template<Character C>
+inline C* FormatUnsigned(C* it, U64 value)
+{
+	C* end = it + FormatDigits(value);
+	it = end;
+
+	while (value >= 100)
+	{
+		const char* pair = FORMAT_DIGIT_PAIRS + (value % 100) * 2;
+		value /= 100;
+		*--it = (C)pair[1];
+		*--it = (C)pair[0];
+	}
+
+	if (value >= 10)
+	{
+		const char* pair = FORMAT_DIGIT_PAIRS + value * 2;
+		*--it = (C)pair[1];
+		*--it = (C)pair[0];
+	}
+	else { *--it = (C)('0' + value); }
+
+	return end;
+}
+
+/// <returns>The most characters FormatValue can write for arg</returns>
+template<Character C, class Arg>
+inline U64 FormatBound(const Arg& arg)
+{
+	using Type = std::decay_t<Arg>;
+
+	if constexpr (std::is_same_v<Type, bool>) { return 5; }
+	else if constexpr (IsCharacter<Type>) { return 1; }
+	else if constexpr (std::is_enum_v<Type>) { return 20; }
+	else if constexpr (std::is_integral_v<Type>) { return 20; }
+	else if constexpr (std::is_floating_point_v<Type>) { return FORMAT_FLOAT_SIZE; }
+	else if constexpr (std::is_same_v<Type, const C*> || std::is_same_v<Type, C*>)
+	{
+		//Only real pointers can be null, arrays decay to a pointer that never is
+		const C* it = arg;
+		if constexpr (std::is_pointer_v<Arg>) { if (!it) { return 0; } }
+		while (*it) { ++it; }
+		return it - arg;
+	}
+	else if constexpr (std::is_same_v<Type, StringBase<C>> || std::is_same_v<Type, StringViewBase<C>>) { return arg.Size(); }
+	else if constexpr (IsNonStringPointer<Type> || std::is_null_pointer_v<Type>) { return 18; }
+	else { static_assert(IsNonStringPointer<Type>, "Type can't be formatted into this string"); return 0; }
+}
+
+/// <summary>
+/// Writes arg at it, the caller has made room for FormatBound(arg) characters
+/// </summary>
+/// <returns>One past the last character written</returns>
+template<Character C, class Arg>
+inline C* FormatValue(C* it, const Arg& arg)
+{
+	using Type = std::decay_t<Arg>;
+
+	if constexpr (std::is_same_v<Type, bool>)
+	{
+		const char* text = arg ? "true" : "false";
+		while (*text) { *it++ = (C)*text++; }
+		return it;
+	}
+	else if constexpr (IsCharacter<Type>) { *it = (C)arg; return it + 1; }
+	else if constexpr (std::is_enum_v<Type>) { return FormatValue(it, (std::underlying_type_t<Type>)arg); }
+	else if constexpr (std::is_integral_v<Type> && std::is_signed_v<Type>)
+	{
+		if (arg < 0) { *it++ = '-'; return FormatUnsigned(it, 0ULL - (U64)arg); }
+		return FormatUnsigned(it, (U64)arg);
+	}
+	else if constexpr (std::is_integral_v<Type>) { return FormatUnsigned(it, (U64)arg); }
+	else if constexpr (std::is_floating_point_v<Type>)
+	{
+		using Float = std::conditional_t<std::is_same_v<Type, float>, float, double>;
+
+		if constexpr (std::is_same_v<C, char>) { return std::to_chars(it, it + FORMAT_FLOAT_SIZE, (Float)arg).ptr; }
+		else
+		{
+			char buffer[FORMAT_FLOAT_SIZE];
+			char* end = std::to_chars(buffer, buffer + FORMAT_FLOAT_SIZE, (Float)arg).ptr;
+			for (char* c = buffer; c != end; ++c) { *it++ = (C)*c; }
+			return it;
+		}
+	}
+	else if constexpr (std::is_same_v<Type, const C*> || std::is_same_v<Type, C*>)
+	{
+		if constexpr (std::is_pointer_v<Arg>) { if (!arg) { return it; } }
+		for (const C* c = arg; *c; ++c) { *it++ = *c; }
+		return it;
+	}
+	else if constexpr (std::is_same_v<Type, StringBase<C>> || std::is_same_v<Type, StringViewBase<C>>)
+	{
+		return Copy(it, arg.Data(), arg.Size()) + arg.Size();
+	}
+	else
+	{
+		static constexpr char HEX[] = "0123456789ABCDEF";
+
+		U64 value = (U64)arg;
+		*it++ = '0';
+		*it++ = 'x';
+		for (I32 shift = 60; shift >= 0; shift -= 4) { *it++ = (C)HEX[(value >> shift) & 0xF]; }
+		return it;
+	}
+}
+
+/// <summary>
+/// Copies format up to the next "{}", "{{" and "}}" are written as single braces
+/// </summary>
+/// <returns>True if a placeholder was consumed</returns>
+template<Character C>
+inline bool FormatLiteral(C*& it, const C*& format, const C* end)
+{
+	while (format != end)
+	{
+		C c = *format++;
+
+		if (c == '{' && format != end)
+		{
+			if (*format == '}') { ++format; return true; }
+			if (*format == '{') { ++format; }
+		}
+		else if (c == '}' && format != end && *format == '}') { ++format; }
+
+		*it++ = c;
+	}
+
+	return false;
+}
+
+//Parsing
+static inline constexpr F64 PARSE_POWERS[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+static inline constexpr I64 PARSE_SMALLEST_POWER = -342;	//Below this any nineteen digit mantissa rounds to zero
+static inline constexpr I64 PARSE_LARGEST_POWER = 308;		//Above this any mantissa overflows to infinity
+
+//5^q for q in PARSE_SMALLEST_POWER to PARSE_LARGEST_POWER, normalized so the top bit is set and truncated to 128 bits as high, low pairs
+static inline constexpr U64 PARSE_POWERS_OF_FIVE[] = {
+	0xEEF453D6923BD65AULL, 0x113FAA2906A13B3FULL, 0x9558B4661B6565F8ULL, 0x4AC7CA59A424C507ULL,
+	0xBAAEE17FA23EBF76ULL, 0x5D79BCF00D2DF649ULL, 0xE95A99DF8ACE6F53ULL, 0xF4D82C2C107973DCULL,
+	0x91D8A02BB6C10594ULL, 0x79071B9B8A4BE869ULL, 0xB64EC836A47146F9ULL, 0x9748E2826CDEE284ULL,
+	0xE3E27A444D8D98B7ULL, 0xFD1B1B2308169B25ULL, 0x8E6D8C6AB0787F72ULL, 0xFE30F0F5E50E20F7ULL,
+	0xB208EF855C969F4FULL, 0xBDBD2D335E51A935ULL, 0xDE8B2B66B3BC4723ULL, 0xAD2C788035E61382ULL,
+	0x8B16FB203055AC76ULL, 0x4C3BCB5021AFCC31ULL, 0xADDCB9E83C6B1793ULL, 0xDF4ABE242A1BBF3DULL,
+	0xD953E8624B85DD78ULL, 0xD71D6DAD34A2AF0DULL, 0x87D4713D6F33AA6BULL, 0x8672648C40E5AD68ULL,
+	0xA9C98D8CCB009506ULL, 0x680EFDAF511F18C2ULL, 0xD43BF0EFFDC0BA48ULL, 0x0212BD1B2566DEF2ULL,
+	0x84A57695FE98746DULL, 0x014BB630F7604B57ULL, 0xA5CED43B7E3E9188ULL, 0x419EA3BD35385E2DULL,
+	0xCF42894A5DCE35EAULL, 0x52064CAC828675B9ULL, 0x818995CE7AA0E1B2ULL, 0x7343EFEBD1940993ULL,
+	0xA1EBFB4219491A1FULL, 0x1014EBE6C5F90BF8ULL, 0xCA66FA129F9B60A6ULL, 0xD41A26E077774EF6ULL,
+	0xFD00B897478238D0ULL, 0x8920B098955522B4ULL, 0x9E20735E8CB16382ULL, 0x55B46E5F5D5535B0ULL,
+	0xC5A890362FDDBC62ULL, 0xEB2189F734AA831DULL, 0xF712B443BBD52B7BULL, 0xA5E9EC7501D523E4ULL,
+	0x9A6BB0AA55653B2DULL, 0x47B233C92125366EULL, 0xC1069CD4EABE89F8ULL, 0x999EC0BB696E840AULL,
+	0xF148440A256E2C76ULL, 0xC00670EA43CA250DULL, 0x96CD2A865764DBCAULL, 0x380406926A5E5728ULL,
+	0xBC807527ED3E12BCULL, 0xC605083704F5ECF2ULL, 0xEBA09271E88D976BULL, 0xF7864A44C633682EULL,
+	0x93445B8731587EA3ULL, 0x7AB3EE6AFBE0211DULL, 0xB8157268FDAE9E4CULL, 0x5960EA05BAD82964ULL,
+	0xE61ACF033D1A45DFULL, 0x6FB92487298E33BDULL, 0x8FD0C16206306BABULL, 0xA5D3B6D479F8E056ULL,
+	0xB3C4F1BA87BC8696ULL, 0x8F48A4899877186CULL, 0xE0B62E2929ABA83CULL, 0x331ACDABFE94DE87ULL,
+	0x8C71DCD9BA0B4925ULL, 0x9FF0C08B7F1D0B14ULL, 0xAF8E5410288E1B6FULL, 0x07ECF0AE5EE44DD9ULL,
+	0xDB71E91432B1A24AULL, 0xC9E82CD9F69D6150ULL, 0x892731AC9FAF056EULL, 0xBE311C083A225CD2ULL,
+	0xAB70FE17C79AC6CAULL, 0x6DBD630A48AAF406ULL, 0xD64D3D9DB981787DULL, 0x092CBBCCDAD5B108ULL,
+	0x85F0468293F0EB4EULL, 0x25BBF56008C58EA5ULL, 0xA76C582338ED2621ULL, 0xAF2AF2B80AF6F24EULL,
+	0xD1476E2C07286FAAULL, 0x1AF5AF660DB4AEE1ULL, 0x82CCA4DB847945CAULL, 0x50D98D9FC890ED4DULL,
+	0xA37FCE126597973CULL, 0xE50FF107BAB528A0ULL, 0xCC5FC196FEFD7D0CULL, 0x1E53ED49A96272C8ULL,
+	0xFF77B1FCBEBCDC4FULL, 0x25E8E89C13BB0F7AULL, 0x9FAACF3DF73609B1ULL, 0x77B191618C54E9ACULL,
+	0xC795830D75038C1DULL, 0xD59DF5B9EF6A2417ULL, 0xF97AE3D0D2446F25ULL, 0x4B0573286B44AD1DULL,
+	0x9BECCE62836AC577ULL, 0x4EE367F9430AEC32ULL, 0xC2E801FB244576D5ULL, 0x229C41F793CDA73FULL,
+	0xF3A20279ED56D48AULL, 0x6B43527578C1110FULL, 0x9845418C345644D6ULL, 0x830A13896B78AAA9ULL,
+	0xBE5691EF416BD60CULL, 0x23CC986BC656D553ULL, 0xEDEC366B11C6CB8FULL, 0x2CBFBE86B7EC8AA8ULL,
+	0x94B3A202EB1C3F39ULL, 0x7BF7D71432F3D6A9ULL, 0xB9E08A83A5E34F07ULL, 0xDAF5CCD93FB0CC53ULL,
+	0xE858AD248F5C22C9ULL, 0xD1B3400F8F9CFF68ULL, 0x91376C36D99995BEULL, 0x23100809B9C21FA1ULL,
+	0xB58547448FFFFB2DULL, 0xABD40A0C2832A78AULL, 0xE2E69915B3FFF9F9ULL, 0x16C90C8F323F516CULL,
+	0x8DD01FAD907FFC3BULL, 0xAE3DA7D97F6792E3ULL, 0xB1442798F49FFB4AULL, 0x99CD11CFDF41779CULL,
+	0xDD95317F31C7FA1DULL, 0x40405643D711D583ULL, 0x8A7D3EEF7F1CFC52ULL, 0x482835EA666B2572ULL,
+	0xAD1C8EAB5EE43B66ULL, 0xDA3243650005EECFULL, 0xD863B256369D4A40ULL, 0x90BED43E40076A82ULL,
+	0x873E4F75E2224E68ULL, 0x5A7744A6E804A291ULL, 0xA90DE3535AAAE202ULL, 0x711515D0A205CB36ULL,
+	0xD3515C2831559A83ULL, 0x0D5A5B44CA873E03ULL, 0x8412D9991ED58091ULL, 0xE858790AFE9486C2ULL,
+	0xA5178FFF668AE0B6ULL, 0x626E974DBE39A872ULL, 0xCE5D73FF402D98E3ULL, 0xFB0A3D212DC8128FULL,
+	0x80FA687F881C7F8EULL, 0x7CE66634BC9D0B99ULL, 0xA139029F6A239F72ULL, 0x1C1FFFC1EBC44E80ULL,
+	0xC987434744AC874EULL, 0xA327FFB266B56220ULL, 0xFBE9141915D7A922ULL, 0x4BF1FF9F0062BAA8ULL,
+	0x9D71AC8FADA6C9B5ULL, 0x6F773FC3603DB4A9ULL, 0xC4CE17B399107C22ULL, 0xCB550FB4384D21D3ULL,
+	0xF6019DA07F549B2BULL, 0x7E2A53A146606A48ULL, 0x99C102844F94E0FBULL, 0x2EDA7444CBFC426DULL,
+	0xC0314325637A1939ULL, 0xFA911155FEFB5308ULL, 0xF03D93EEBC589F88ULL, 0x793555AB7EBA27CAULL,
+	0x96267C7535B763B5ULL, 0x4BC1558B2F3458DEULL, 0xBBB01B9283253CA2ULL, 0x9EB1AAEDFB016F16ULL,
+	0xEA9C227723EE8BCBULL, 0x465E15A979C1CADCULL, 0x92A1958A7675175FULL, 0x0BFACD89EC191EC9ULL,
+	0xB749FAED14125D36ULL, 0xCEF980EC671F667BULL, 0xE51C79A85916F484ULL, 0x82B7E12780E7401AULL,
+	0x8F31CC0937AE58D2ULL, 0xD1B2ECB8B0908810ULL, 0xB2FE3F0B8599EF07ULL, 0x861FA7E6DCB4AA15ULL,
+	0xDFBDCECE67006AC9ULL, 0x67A791E093E1D49AULL, 0x8BD6A141006042BDULL, 0xE0C8BB2C5C6D24E0ULL,
+	0xAECC49914078536DULL, 0x58FAE9F773886E18ULL, 0xDA7F5BF590966848ULL, 0xAF39A475506A899EULL,
+	0x888F99797A5E012DULL, 0x6D8406C952429603ULL, 0xAAB37FD7D8F58178ULL, 0xC8E5087BA6D33B83ULL,
+	0xD5605FCDCF32E1D6ULL, 0xFB1E4A9A90880A64ULL, 0x855C3BE0A17FCD26ULL, 0x5CF2EEA09A55067FULL,
+	0xA6B34AD8C9DFC06FULL, 0xF42FAA48C0EA481EULL, 0xD0601D8EFC57B08BULL, 0xF13B94DAF124DA26ULL,
+	0x823C12795DB6CE57ULL, 0x76C53D08D6B70858ULL, 0xA2CB1717B52481EDULL, 0x54768C4B0C64CA6EULL,
+	0xCB7DDCDDA26DA268ULL, 0xA9942F5DCF7DFD09ULL, 0xFE5D54150B090B02ULL, 0xD3F93B35435D7C4CULL,
+	0x9EFA548D26E5A6E1ULL, 0xC47BC5014A1A6DAFULL, 0xC6B8E9B0709F109AULL, 0x359AB6419CA1091BULL,
+	0xF867241C8CC6D4C0ULL, 0xC30163D203C94B62ULL, 0x9B407691D7FC44F8ULL, 0x79E0DE63425DCF1DULL,
+	0xC21094364DFB5636ULL, 0x985915FC12F542E4ULL, 0xF294B943E17A2BC4ULL, 0x3E6F5B7B17B2939DULL,
+	0x979CF3CA6CEC5B5AULL, 0xA705992CEECF9C42ULL, 0xBD8430BD08277231ULL, 0x50C6FF782A838353ULL,
+	0xECE53CEC4A314EBDULL, 0xA4F8BF5635246428ULL, 0x940F4613AE5ED136ULL, 0x871B7795E136BE99ULL,
+	0xB913179899F68584ULL, 0x28E2557B59846E3FULL, 0xE757DD7EC07426E5ULL, 0x331AEADA2FE589CFULL,
+	0x9096EA6F3848984FULL, 0x3FF0D2C85DEF7621ULL, 0xB4BCA50B065ABE63ULL, 0x0FED077A756B53A9ULL,
+	0xE1EBCE4DC7F16DFBULL, 0xD3E8495912C62894ULL, 0x8D3360F09CF6E4BDULL, 0x64712DD7ABBBD95CULL,
+	0xB080392CC4349DECULL, 0xBD8D794D96AACFB3ULL, 0xDCA04777F541C567ULL, 0xECF0D7A0FC5583A0ULL,
+	0x89E42CAAF9491B60ULL, 0xF41686C49DB57244ULL, 0xAC5D37D5B79B6239ULL, 0x311C2875C522CED5ULL,
+	0xD77485CB25823AC7ULL, 0x7D633293366B828BULL, 0x86A8D39EF77164BCULL, 0xAE5DFF9C02033197ULL,
+	0xA8530886B54DBDEBULL, 0xD9F57F830283FDFCULL, 0xD267CAA862A12D66ULL, 0xD072DF63C324FD7BULL,
+	0x8380DEA93DA4BC60ULL, 0x4247CB9E59F71E6DULL, 0xA46116538D0DEB78ULL, 0x52D9BE85F074E608ULL,
+	0xCD795BE870516656ULL, 0x67902E276C921F8BULL, 0x806BD9714632DFF6ULL, 0x00BA1CD8A3DB53B6ULL,
+	0xA086CFCD97BF97F3ULL, 0x80E8A40ECCD228A4ULL, 0xC8A883C0FDAF7DF0ULL, 0x6122CD128006B2CDULL,
+	0xFAD2A4B13D1B5D6CULL, 0x796B805720085F81ULL, 0x9CC3A6EEC6311A63ULL, 0xCBE3303674053BB0ULL,
+	0xC3F490AA77BD60FCULL, 0xBEDBFC4411068A9CULL, 0xF4F1B4D515ACB93BULL, 0xEE92FB5515482D44ULL,
+	0x991711052D8BF3C5ULL, 0x751BDD152D4D1C4AULL, 0xBF5CD54678EEF0B6ULL, 0xD262D45A78A0635DULL,
+	0xEF340A98172AACE4ULL, 0x86FB897116C87C34ULL, 0x9580869F0E7AAC0EULL, 0xD45D35E6AE3D4DA0ULL,
+	0xBAE0A846D2195712ULL, 0x8974836059CCA109ULL, 0xE998D258869FACD7ULL, 0x2BD1A438703FC94BULL,
+	0x91FF83775423CC06ULL, 0x7B6306A34627DDCFULL, 0xB67F6455292CBF08ULL, 0x1A3BC84C17B1D542ULL,
+	0xE41F3D6A7377EECAULL, 0x20CABA5F1D9E4A93ULL, 0x8E938662882AF53EULL, 0x547EB47B7282EE9CULL,
+	0xB23867FB2A35B28DULL, 0xE99E619A4F23AA43ULL, 0xDEC681F9F4C31F31ULL, 0x6405FA00E2EC94D4ULL,
+	0x8B3C113C38F9F37EULL, 0xDE83BC408DD3DD04ULL, 0xAE0B158B4738705EULL, 0x9624AB50B148D445ULL,
+	0xD98DDAEE19068C76ULL, 0x3BADD624DD9B0957ULL, 0x87F8A8D4CFA417C9ULL, 0xE54CA5D70A80E5D6ULL,
+	0xA9F6D30A038D1DBCULL, 0x5E9FCF4CCD211F4CULL, 0xD47487CC8470652BULL, 0x7647C3200069671FULL,
+	0x84C8D4DFD2C63F3BULL, 0x29ECD9F40041E073ULL, 0xA5FB0A17C777CF09ULL, 0xF468107100525890ULL,
+	0xCF79CC9DB955C2CCULL, 0x7182148D4066EEB4ULL, 0x81AC1FE293D599BFULL, 0xC6F14CD848405530ULL,
+	0xA21727DB38CB002FULL, 0xB8ADA00E5A506A7CULL, 0xCA9CF1D206FDC03BULL, 0xA6D90811F0E4851CULL,
+	0xFD442E4688BD304AULL, 0x908F4A166D1DA663ULL, 0x9E4A9CEC15763E2EULL, 0x9A598E4E043287FEULL,
+	0xC5DD44271AD3CDBAULL, 0x40EFF1E1853F29FDULL, 0xF7549530E188C128ULL, 0xD12BEE59E68EF47CULL,
+	0x9A94DD3E8CF578B9ULL, 0x82BB74F8301958CEULL, 0xC13A148E3032D6E7ULL, 0xE36A52363C1FAF01ULL,
+	0xF18899B1BC3F8CA1ULL, 0xDC44E6C3CB279AC1ULL, 0x96F5600F15A7B7E5ULL, 0x29AB103A5EF8C0B9ULL,
+	0xBCB2B812DB11A5DEULL, 0x7415D448F6B6F0E7ULL, 0xEBDF661791D60F56ULL, 0x111B495B3464AD21ULL,
+	0x936B9FCEBB25C995ULL, 0xCAB10DD900BEEC34ULL, 0xB84687C269EF3BFBULL, 0x3D5D514F40EEA742ULL,
+	0xE65829B3046B0AFAULL, 0x0CB4A5A3112A5112ULL, 0x8FF71A0FE2C2E6DCULL, 0x47F0E785EABA72ABULL,
+	0xB3F4E093DB73A093ULL, 0x59ED216765690F56ULL, 0xE0F218B8D25088B8ULL, 0x306869C13EC3532CULL,
+	0x8C974F7383725573ULL, 0x1E414218C73A13FBULL, 0xAFBD2350644EEACFULL, 0xE5D1929EF90898FAULL,
+	0xDBAC6C247D62A583ULL, 0xDF45F746B74ABF39ULL, 0x894BC396CE5DA772ULL, 0x6B8BBA8C328EB783ULL,
+	0xAB9EB47C81F5114FULL, 0x066EA92F3F326564ULL, 0xD686619BA27255A2ULL, 0xC80A537B0EFEFEBDULL,
+	0x8613FD0145877585ULL, 0xBD06742CE95F5F36ULL, 0xA798FC4196E952E7ULL, 0x2C48113823B73704ULL,
+	0xD17F3B51FCA3A7A0ULL, 0xF75A15862CA504C5ULL, 0x82EF85133DE648C4ULL, 0x9A984D73DBE722FBULL,
+	0xA3AB66580D5FDAF5ULL, 0xC13E60D0D2E0EBBAULL, 0xCC963FEE10B7D1B3ULL, 0x318DF905079926A8ULL,
+	0xFFBBCFE994E5C61FULL, 0xFDF17746497F7052ULL, 0x9FD561F1FD0F9BD3ULL, 0xFEB6EA8BEDEFA633ULL,
+	0xC7CABA6E7C5382C8ULL, 0xFE64A52EE96B8FC0ULL, 0xF9BD690A1B68637BULL, 0x3DFDCE7AA3C673B0ULL,
+	0x9C1661A651213E2DULL, 0x06BEA10CA65C084EULL, 0xC31BFA0FE5698DB8ULL, 0x486E494FCFF30A62ULL,
+	0xF3E2F893DEC3F126ULL, 0x5A89DBA3C3EFCCFAULL, 0x986DDB5C6B3A76B7ULL, 0xF89629465A75E01CULL,
+	0xBE89523386091465ULL, 0xF6BBB397F1135823ULL, 0xEE2BA6C0678B597FULL, 0x746AA07DED582E2CULL,
+	0x94DB483840B717EFULL, 0xA8C2A44EB4571CDCULL, 0xBA121A4650E4DDEBULL, 0x92F34D62616CE413ULL,
+	0xE896A0D7E51E1566ULL, 0x77B020BAF9C81D17ULL, 0x915E2486EF32CD60ULL, 0x0ACE1474DC1D122EULL,
+	0xB5B5ADA8AAFF80B8ULL, 0x0D819992132456BAULL, 0xE3231912D5BF60E6ULL, 0x10E1FFF697ED6C69ULL,
+	0x8DF5EFABC5979C8FULL, 0xCA8D3FFA1EF463C1ULL, 0xB1736B96B6FD83B3ULL, 0xBD308FF8A6B17CB2ULL,
+	0xDDD0467C64BCE4A0ULL, 0xAC7CB3F6D05DDBDEULL, 0x8AA22C0DBEF60EE4ULL, 0x6BCDF07A423AA96BULL,
+	0xAD4AB7112EB3929DULL, 0x86C16C98D2C953C6ULL, 0xD89D64D57A607744ULL, 0xE871C7BF077BA8B7ULL,
+	0x87625F056C7C4A8BULL, 0x11471CD764AD4972ULL, 0xA93AF6C6C79B5D2DULL, 0xD598E40D3DD89BCFULL,
+	0xD389B47879823479ULL, 0x4AFF1D108D4EC2C3ULL, 0x843610CB4BF160CBULL, 0xCEDF722A585139BAULL,
+	0xA54394FE1EEDB8FEULL, 0xC2974EB4EE658828ULL, 0xCE947A3DA6A9273EULL, 0x733D226229FEEA32ULL,
+	0x811CCC668829B887ULL, 0x0806357D5A3F525FULL, 0xA163FF802A3426A8ULL, 0xCA07C2DCB0CF26F7ULL,
+	0xC9BCFF6034C13052ULL, 0xFC89B393DD02F0B5ULL, 0xFC2C3F3841F17C67ULL, 0xBBAC2078D443ACE2ULL,
+	0x9D9BA7832936EDC0ULL, 0xD54B944B84AA4C0DULL, 0xC5029163F384A931ULL, 0x0A9E795E65D4DF11ULL,
+	0xF64335BCF065D37DULL, 0x4D4617B5FF4A16D5ULL, 0x99EA0196163FA42EULL, 0x504BCED1BF8E4E45ULL,
+	0xC06481FB9BCF8D39ULL, 0xE45EC2862F71E1D6ULL, 0xF07DA27A82C37088ULL, 0x5D767327BB4E5A4CULL,
+	0x964E858C91BA2655ULL, 0x3A6A07F8D510F86FULL, 0xBBE226EFB628AFEAULL, 0x890489F70A55368BULL,
+	0xEADAB0ABA3B2DBE5ULL, 0x2B45AC74CCEA842EULL, 0x92C8AE6B464FC96FULL, 0x3B0B8BC90012929DULL,
+	0xB77ADA0617E3BBCBULL, 0x09CE6EBB40173744ULL, 0xE55990879DDCAABDULL, 0xCC420A6A101D0515ULL,
+	0x8F57FA54C2A9EAB6ULL, 0x9FA946824A12232DULL, 0xB32DF8E9F3546564ULL, 0x47939822DC96ABF9ULL,
+	0xDFF9772470297EBDULL, 0x59787E2B93BC56F7ULL, 0x8BFBEA76C619EF36ULL, 0x57EB4EDB3C55B65AULL,
+	0xAEFAE51477A06B03ULL, 0xEDE622920B6B23F1ULL, 0xDAB99E59958885C4ULL, 0xE95FAB368E45ECEDULL,
+	0x88B402F7FD75539BULL, 0x11DBCB0218EBB414ULL, 0xAAE103B5FCD2A881ULL, 0xD652BDC29F26A119ULL,
+	0xD59944A37C0752A2ULL, 0x4BE76D3346F0495FULL, 0x857FCAE62D8493A5ULL, 0x6F70A4400C562DDBULL,
+	0xA6DFBD9FB8E5B88EULL, 0xCB4CCD500F6BB952ULL, 0xD097AD07A71F26B2ULL, 0x7E2000A41346A7A7ULL,
+	0x825ECC24C873782FULL, 0x8ED400668C0C28C8ULL, 0xA2F67F2DFA90563BULL, 0x728900802F0F32FAULL,
+	0xCBB41EF979346BCAULL, 0x4F2B40A03AD2FFB9ULL, 0xFEA126B7D78186BCULL, 0xE2F610C84987BFA8ULL,
+	0x9F24B832E6B0F436ULL, 0x0DD9CA7D2DF4D7C9ULL, 0xC6EDE63FA05D3143ULL, 0x91503D1C79720DBBULL,
+	0xF8A95FCF88747D94ULL, 0x75A44C6397CE912AULL, 0x9B69DBE1B548CE7CULL, 0xC986AFBE3EE11ABAULL,
+	0xC24452DA229B021BULL, 0xFBE85BADCE996168ULL, 0xF2D56790AB41C2A2ULL, 0xFAE27299423FB9C3ULL,
+	0x97C560BA6B0919A5ULL, 0xDCCD879FC967D41AULL, 0xBDB6B8E905CB600FULL, 0x5400E987BBC1C920ULL,
+	0xED246723473E3813ULL, 0x290123E9AAB23B68ULL, 0x9436C0760C86E30BULL, 0xF9A0B6720AAF6521ULL,
+	0xB94470938FA89BCEULL, 0xF808E40E8D5B3E69ULL, 0xE7958CB87392C2C2ULL, 0xB60B1D1230B20E04ULL,
+	0x90BD77F3483BB9B9ULL, 0xB1C6F22B5E6F48C2ULL, 0xB4ECD5F01A4AA828ULL, 0x1E38AEB6360B1AF3ULL,
+	0xE2280B6C20DD5232ULL, 0x25C6DA63C38DE1B0ULL, 0x8D590723948A535FULL, 0x579C487E5A38AD0EULL,
+	0xB0AF48EC79ACE837ULL, 0x2D835A9DF0C6D851ULL, 0xDCDB1B2798182244ULL, 0xF8E431456CF88E65ULL,
+	0x8A08F0F8BF0F156BULL, 0x1B8E9ECB641B58FFULL, 0xAC8B2D36EED2DAC5ULL, 0xE272467E3D222F3FULL,
+	0xD7ADF884AA879177ULL, 0x5B0ED81DCC6ABB0FULL, 0x86CCBB52EA94BAEAULL, 0x98E947129FC2B4E9ULL,
+	0xA87FEA27A539E9A5ULL, 0x3F2398D747B36224ULL, 0xD29FE4B18E88640EULL, 0x8EEC7F0D19A03AADULL,
+	0x83A3EEEEF9153E89ULL, 0x1953CF68300424ACULL, 0xA48CEAAAB75A8E2BULL, 0x5FA8C3423C052DD7ULL,
+	0xCDB02555653131B6ULL, 0x3792F412CB06794DULL, 0x808E17555F3EBF11ULL, 0xE2BBD88BBEE40BD0ULL,
+	0xA0B19D2AB70E6ED6ULL, 0x5B6ACEAEAE9D0EC4ULL, 0xC8DE047564D20A8BULL, 0xF245825A5A445275ULL,
+	0xFB158592BE068D2EULL, 0xEED6E2F0F0D56712ULL, 0x9CED737BB6C4183DULL, 0x55464DD69685606BULL,
+	0xC428D05AA4751E4CULL, 0xAA97E14C3C26B886ULL, 0xF53304714D9265DFULL, 0xD53DD99F4B3066A8ULL,
+	0x993FE2C6D07B7FABULL, 0xE546A8038EFE4029ULL, 0xBF8FDB78849A5F96ULL, 0xDE98520472BDD033ULL,
+	0xEF73D256A5C0F77CULL, 0x963E66858F6D4440ULL, 0x95A8637627989AADULL, 0xDDE7001379A44AA8ULL,
+	0xBB127C53B17EC159ULL, 0x5560C018580D5D52ULL, 0xE9D71B689DDE71AFULL, 0xAAB8F01E6E10B4A6ULL,
+	0x9226712162AB070DULL, 0xCAB3961304CA70E8ULL, 0xB6B00D69BB55C8D1ULL, 0x3D607B97C5FD0D22ULL,
+	0xE45C10C42A2B3B05ULL, 0x8CB89A7DB77C506AULL, 0x8EB98A7A9A5B04E3ULL, 0x77F3608E92ADB242ULL,
+	0xB267ED1940F1C61CULL, 0x55F038B237591ED3ULL, 0xDF01E85F912E37A3ULL, 0x6B6C46DEC52F6688ULL,
+	0x8B61313BBABCE2C6ULL, 0x2323AC4B3B3DA015ULL, 0xAE397D8AA96C1B77ULL, 0xABEC975E0A0D081AULL,
+	0xD9C7DCED53C72255ULL, 0x96E7BD358C904A21ULL, 0x881CEA14545C7575ULL, 0x7E50D64177DA2E54ULL,
+	0xAA242499697392D2ULL, 0xDDE50BD1D5D0B9E9ULL, 0xD4AD2DBFC3D07787ULL, 0x955E4EC64B44E864ULL,
+	0x84EC3C97DA624AB4ULL, 0xBD5AF13BEF0B113EULL, 0xA6274BBDD0FADD61ULL, 0xECB1AD8AEACDD58EULL,
+	0xCFB11EAD453994BAULL, 0x67DE18EDA5814AF2ULL, 0x81CEB32C4B43FCF4ULL, 0x80EACF948770CED7ULL,
+	0xA2425FF75E14FC31ULL, 0xA1258379A94D028DULL, 0xCAD2F7F5359A3B3EULL, 0x096EE45813A04330ULL,
+	0xFD87B5F28300CA0DULL, 0x8BCA9D6E188853FCULL, 0x9E74D1B791E07E48ULL, 0x775EA264CF55347EULL,
+	0xC612062576589DDAULL, 0x95364AFE032A819EULL, 0xF79687AED3EEC551ULL, 0x3A83DDBD83F52205ULL,
+	0x9ABE14CD44753B52ULL, 0xC4926A9672793543ULL, 0xC16D9A0095928A27ULL, 0x75B7053C0F178294ULL,
+	0xF1C90080BAF72CB1ULL, 0x5324C68B12DD6339ULL, 0x971DA05074DA7BEEULL, 0xD3F6FC16EBCA5E04ULL,
+	0xBCE5086492111AEAULL, 0x88F4BB1CA6BCF585ULL, 0xEC1E4A7DB69561A5ULL, 0x2B31E9E3D06C32E6ULL,
+	0x9392EE8E921D5D07ULL, 0x3AFF322E62439FD0ULL, 0xB877AA3236A4B449ULL, 0x09BEFEB9FAD487C3ULL,
+	0xE69594BEC44DE15BULL, 0x4C2EBE687989A9B4ULL, 0x901D7CF73AB0ACD9ULL, 0x0F9D37014BF60A11ULL,
+	0xB424DC35095CD80FULL, 0x538484C19EF38C95ULL, 0xE12E13424BB40E13ULL, 0x2865A5F206B06FBAULL,
+	0x8CBCCC096F5088CBULL, 0xF93F87B7442E45D4ULL, 0xAFEBFF0BCB24AAFEULL, 0xF78F69A51539D749ULL,
+	0xDBE6FECEBDEDD5BEULL, 0xB573440E5A884D1CULL, 0x89705F4136B4A597ULL, 0x31680A88F8953031ULL,
+	0xABCC77118461CEFCULL, 0xFDC20D2B36BA7C3EULL, 0xD6BF94D5E57A42BCULL, 0x3D32907604691B4DULL,
+	0x8637BD05AF6C69B5ULL, 0xA63F9A49C2C1B110ULL, 0xA7C5AC471B478423ULL, 0x0FCF80DC33721D54ULL,
+	0xD1B71758E219652BULL, 0xD3C36113404EA4A9ULL, 0x83126E978D4FDF3BULL, 0x645A1CAC083126EAULL,
+	0xA3D70A3D70A3D70AULL, 0x3D70A3D70A3D70A4ULL, 0xCCCCCCCCCCCCCCCCULL, 0xCCCCCCCCCCCCCCCDULL,
+	0x8000000000000000ULL, 0x0000000000000000ULL, 0xA000000000000000ULL, 0x0000000000000000ULL,
+	0xC800000000000000ULL, 0x0000000000000000ULL, 0xFA00000000000000ULL, 0x0000000000000000ULL,
+	0x9C40000000000000ULL, 0x0000000000000000ULL, 0xC350000000000000ULL, 0x0000000000000000ULL,
+	0xF424000000000000ULL, 0x0000000000000000ULL, 0x9896800000000000ULL, 0x0000000000000000ULL,
+	0xBEBC200000000000ULL, 0x0000000000000000ULL, 0xEE6B280000000000ULL, 0x0000000000000000ULL,
+	0x9502F90000000000ULL, 0x0000000000000000ULL, 0xBA43B74000000000ULL, 0x0000000000000000ULL,
+	0xE8D4A51000000000ULL, 0x0000000000000000ULL, 0x9184E72A00000000ULL, 0x0000000000000000ULL,
+	0xB5E620F480000000ULL, 0x0000000000000000ULL, 0xE35FA931A0000000ULL, 0x0000000000000000ULL,
+	0x8E1BC9BF04000000ULL, 0x0000000000000000ULL, 0xB1A2BC2EC5000000ULL, 0x0000000000000000ULL,
+	0xDE0B6B3A76400000ULL, 0x0000000000000000ULL, 0x8AC7230489E80000ULL, 0x0000000000000000ULL,
+	0xAD78EBC5AC620000ULL, 0x0000000000000000ULL, 0xD8D726B7177A8000ULL, 0x0000000000000000ULL,
+	0x878678326EAC9000ULL, 0x0000000000000000ULL, 0xA968163F0A57B400ULL, 0x0000000000000000ULL,
+	0xD3C21BCECCEDA100ULL, 0x0000000000000000ULL, 0x84595161401484A0ULL, 0x0000000000000000ULL,
+	0xA56FA5B99019A5C8ULL, 0x0000000000000000ULL, 0xCECB8F27F4200F3AULL, 0x0000000000000000ULL,
+	0x813F3978F8940984ULL, 0x4000000000000000ULL, 0xA18F07D736B90BE5ULL, 0x5000000000000000ULL,
+	0xC9F2C9CD04674EDEULL, 0xA400000000000000ULL, 0xFC6F7C4045812296ULL, 0x4D00000000000000ULL,
+	0x9DC5ADA82B70B59DULL, 0xF020000000000000ULL, 0xC5371912364CE305ULL, 0x6C28000000000000ULL,
+	0xF684DF56C3E01BC6ULL, 0xC732000000000000ULL, 0x9A130B963A6C115CULL, 0x3C7F400000000000ULL,
+	0xC097CE7BC90715B3ULL, 0x4B9F100000000000ULL, 0xF0BDC21ABB48DB20ULL, 0x1E86D40000000000ULL,
+	0x96769950B50D88F4ULL, 0x1314448000000000ULL, 0xBC143FA4E250EB31ULL, 0x17D955A000000000ULL,
+	0xEB194F8E1AE525FDULL, 0x5DCFAB0800000000ULL, 0x92EFD1B8D0CF37BEULL, 0x5AA1CAE500000000ULL,
+	0xB7ABC627050305ADULL, 0xF14A3D9E40000000ULL, 0xE596B7B0C643C719ULL, 0x6D9CCD05D0000000ULL,
+	0x8F7E32CE7BEA5C6FULL, 0xE4820023A2000000ULL, 0xB35DBF821AE4F38BULL, 0xDDA2802C8A800000ULL,
+	0xE0352F62A19E306EULL, 0xD50B2037AD200000ULL, 0x8C213D9DA502DE45ULL, 0x4526F422CC340000ULL,
+	0xAF298D050E4395D6ULL, 0x9670B12B7F410000ULL, 0xDAF3F04651D47B4CULL, 0x3C0CDD765F114000ULL,
+	0x88D8762BF324CD0FULL, 0xA5880A69FB6AC800ULL, 0xAB0E93B6EFEE0053ULL, 0x8EEA0D047A457A00ULL,
+	0xD5D238A4ABE98068ULL, 0x72A4904598D6D880ULL, 0x85A36366EB71F041ULL, 0x47A6DA2B7F864750ULL,
+	0xA70C3C40A64E6C51ULL, 0x999090B65F67D924ULL, 0xD0CF4B50CFE20765ULL, 0xFFF4B4E3F741CF6DULL,
+	0x82818F1281ED449FULL, 0xBFF8F10E7A8921A4ULL, 0xA321F2D7226895C7ULL, 0xAFF72D52192B6A0DULL,
+	0xCBEA6F8CEB02BB39ULL, 0x9BF4F8A69F764490ULL, 0xFEE50B7025C36A08ULL, 0x02F236D04753D5B4ULL,
+	0x9F4F2726179A2245ULL, 0x01D762422C946590ULL, 0xC722F0EF9D80AAD6ULL, 0x424D3AD2B7B97EF5ULL,
+	0xF8EBAD2B84E0D58BULL, 0xD2E0898765A7DEB2ULL, 0x9B934C3B330C8577ULL, 0x63CC55F49F88EB2FULL,
+	0xC2781F49FFCFA6D5ULL, 0x3CBF6B71C76B25FBULL, 0xF316271C7FC3908AULL, 0x8BEF464E3945EF7AULL,
+	0x97EDD871CFDA3A56ULL, 0x97758BF0E3CBB5ACULL, 0xBDE94E8E43D0C8ECULL, 0x3D52EEED1CBEA317ULL,
+	0xED63A231D4C4FB27ULL, 0x4CA7AAA863EE4BDDULL, 0x945E455F24FB1CF8ULL, 0x8FE8CAA93E74EF6AULL,
+	0xB975D6B6EE39E436ULL, 0xB3E2FD538E122B44ULL, 0xE7D34C64A9C85D44ULL, 0x60DBBCA87196B616ULL,
+	0x90E40FBEEA1D3A4AULL, 0xBC8955E946FE31CDULL, 0xB51D13AEA4A488DDULL, 0x6BABAB6398BDBE41ULL,
+	0xE264589A4DCDAB14ULL, 0xC696963C7EED2DD1ULL, 0x8D7EB76070A08AECULL, 0xFC1E1DE5CF543CA2ULL,
+	0xB0DE65388CC8ADA8ULL, 0x3B25A55F43294BCBULL, 0xDD15FE86AFFAD912ULL, 0x49EF0EB713F39EBEULL,
+	0x8A2DBF142DFCC7ABULL, 0x6E3569326C784337ULL, 0xACB92ED9397BF996ULL, 0x49C2C37F07965404ULL,
+	0xD7E77A8F87DAF7FBULL, 0xDC33745EC97BE906ULL, 0x86F0AC99B4E8DAFDULL, 0x69A028BB3DED71A3ULL,
+	0xA8ACD7C0222311BCULL, 0xC40832EA0D68CE0CULL, 0xD2D80DB02AABD62BULL, 0xF50A3FA490C30190ULL,
+	0x83C7088E1AAB65DBULL, 0x792667C6DA79E0FAULL, 0xA4B8CAB1A1563F52ULL, 0x577001B891185938ULL,
+	0xCDE6FD5E09ABCF26ULL, 0xED4C0226B55E6F86ULL, 0x80B05E5AC60B6178ULL, 0x544F8158315B05B4ULL,
+	0xA0DC75F1778E39D6ULL, 0x696361AE3DB1C721ULL, 0xC913936DD571C84CULL, 0x03BC3A19CD1E38E9ULL,
+	0xFB5878494ACE3A5FULL, 0x04AB48A04065C723ULL, 0x9D174B2DCEC0E47BULL, 0x62EB0D64283F9C76ULL,
+	0xC45D1DF942711D9AULL, 0x3BA5D0BD324F8394ULL, 0xF5746577930D6500ULL, 0xCA8F44EC7EE36479ULL,
+	0x9968BF6ABBE85F20ULL, 0x7E998B13CF4E1ECBULL, 0xBFC2EF456AE276E8ULL, 0x9E3FEDD8C321A67EULL,
+	0xEFB3AB16C59B14A2ULL, 0xC5CFE94EF3EA101EULL, 0x95D04AEE3B80ECE5ULL, 0xBBA1F1D158724A12ULL,
+	0xBB445DA9CA61281FULL, 0x2A8A6E45AE8EDC97ULL, 0xEA1575143CF97226ULL, 0xF52D09D71A3293BDULL,
+	0x924D692CA61BE758ULL, 0x593C2626705F9C56ULL, 0xB6E0C377CFA2E12EULL, 0x6F8B2FB00C77836CULL,
+	0xE498F455C38B997AULL, 0x0B6DFB9C0F956447ULL, 0x8EDF98B59A373FECULL, 0x4724BD4189BD5EACULL,
+	0xB2977EE300C50FE7ULL, 0x58EDEC91EC2CB657ULL, 0xDF3D5E9BC0F653E1ULL, 0x2F2967B66737E3EDULL,
+	0x8B865B215899F46CULL, 0xBD79E0D20082EE74ULL, 0xAE67F1E9AEC07187ULL, 0xECD8590680A3AA11ULL,
+	0xDA01EE641A708DE9ULL, 0xE80E6F4820CC9495ULL, 0x884134FE908658B2ULL, 0x3109058D147FDCDDULL,
+	0xAA51823E34A7EEDEULL, 0xBD4B46F0599FD415ULL, 0xD4E5E2CDC1D1EA96ULL, 0x6C9E18AC7007C91AULL,
+	0x850FADC09923329EULL, 0x03E2CF6BC604DDB0ULL, 0xA6539930BF6BFF45ULL, 0x84DB8346B786151CULL,
+	0xCFE87F7CEF46FF16ULL, 0xE612641865679A63ULL, 0x81F14FAE158C5F6EULL, 0x4FCB7E8F3F60C07EULL,
+	0xA26DA3999AEF7749ULL, 0xE3BE5E330F38F09DULL, 0xCB090C8001AB551CULL, 0x5CADF5BFD3072CC5ULL,
+	0xFDCB4FA002162A63ULL, 0x73D9732FC7C8F7F6ULL, 0x9E9F11C4014DDA7EULL, 0x2867E7FDDCDD9AFAULL,
+	0xC646D63501A1511DULL, 0xB281E1FD541501B8ULL, 0xF7D88BC24209A565ULL, 0x1F225A7CA91A4226ULL,
+	0x9AE757596946075FULL, 0x3375788DE9B06958ULL, 0xC1A12D2FC3978937ULL, 0x0052D6B1641C83AEULL,
+	0xF209787BB47D6B84ULL, 0xC0678C5DBD23A49AULL, 0x9745EB4D50CE6332ULL, 0xF840B7BA963646E0ULL,
+	0xBD176620A501FBFFULL, 0xB650E5A93BC3D898ULL, 0xEC5D3FA8CE427AFFULL, 0xA3E51F138AB4CEBEULL,
+	0x93BA47C980E98CDFULL, 0xC66F336C36B10137ULL, 0xB8A8D9BBE123F017ULL, 0xB80B0047445D4184ULL,
+	0xE6D3102AD96CEC1DULL, 0xA60DC059157491E5ULL, 0x9043EA1AC7E41392ULL, 0x87C89837AD68DB2FULL,
+	0xB454E4A179DD1877ULL, 0x29BABE4598C311FBULL, 0xE16A1DC9D8545E94ULL, 0xF4296DD6FEF3D67AULL,
+	0x8CE2529E2734BB1DULL, 0x1899E4A65F58660CULL, 0xB01AE745B101E9E4ULL, 0x5EC05DCFF72E7F8FULL,
+	0xDC21A1171D42645DULL, 0x76707543F4FA1F73ULL, 0x899504AE72497EBAULL, 0x6A06494A791C53A8ULL,
+	0xABFA45DA0EDBDE69ULL, 0x0487DB9D17636892ULL, 0xD6F8D7509292D603ULL, 0x45A9D2845D3C42B6ULL,
+	0x865B86925B9BC5C2ULL, 0x0B8A2392BA45A9B2ULL, 0xA7F26836F282B732ULL, 0x8E6CAC7768D7141EULL,
+	0xD1EF0244AF2364FFULL, 0x3207D795430CD926ULL, 0x8335616AED761F1FULL, 0x7F44E6BD49E807B8ULL,
+	0xA402B9C5A8D3A6E7ULL, 0x5F16206C9C6209A6ULL, 0xCD036837130890A1ULL, 0x36DBA887C37A8C0FULL,
+	0x802221226BE55A64ULL, 0xC2494954DA2C9789ULL, 0xA02AA96B06DEB0FDULL, 0xF2DB9BAA10B7BD6CULL,
+	0xC83553C5C8965D3DULL, 0x6F92829494E5ACC7ULL, 0xFA42A8B73ABBF48CULL, 0xCB772339BA1F17F9ULL,
+	0x9C69A97284B578D7ULL, 0xFF2A760414536EFBULL, 0xC38413CF25E2D70DULL, 0xFEF5138519684ABAULL,
+	0xF46518C2EF5B8CD1ULL, 0x7EB258665FC25D69ULL, 0x98BF2F79D5993802ULL, 0xEF2F773FFBD97A61ULL,
+	0xBEEEFB584AFF8603ULL, 0xAAFB550FFACFD8FAULL, 0xEEAABA2E5DBF6784ULL, 0x95BA2A53F983CF38ULL,
+	0x952AB45CFA97A0B2ULL, 0xDD945A747BF26183ULL, 0xBA756174393D88DFULL, 0x94F971119AEEF9E4ULL,
+	0xE912B9D1478CEB17ULL, 0x7A37CD5601AAB85DULL, 0x91ABB422CCB812EEULL, 0xAC62E055C10AB33AULL,
+	0xB616A12B7FE617AAULL, 0x577B986B314D6009ULL, 0xE39C49765FDF9D94ULL, 0xED5A7E85FDA0B80BULL,
+	0x8E41ADE9FBEBC27DULL, 0x14588F13BE847307ULL, 0xB1D219647AE6B31CULL, 0x596EB2D8AE258FC8ULL,
+	0xDE469FBD99A05FE3ULL, 0x6FCA5F8ED9AEF3BBULL, 0x8AEC23D680043BEEULL, 0x25DE7BB9480D5854ULL,
+	0xADA72CCC20054AE9ULL, 0xAF561AA79A10AE6AULL, 0xD910F7FF28069DA4ULL, 0x1B2BA1518094DA04ULL,
+	0x87AA9AFF79042286ULL, 0x90FB44D2F05D0842ULL, 0xA99541BF57452B28ULL, 0x353A1607AC744A53ULL,
+	0xD3FA922F2D1675F2ULL, 0x42889B8997915CE8ULL, 0x847C9B5D7C2E09B7ULL, 0x69956135FEBADA11ULL,
+	0xA59BC234DB398C25ULL, 0x43FAB9837E699095ULL, 0xCF02B2C21207EF2EULL, 0x94F967E45E03F4BBULL,
+	0x8161AFB94B44F57DULL, 0x1D1BE0EEBAC278F5ULL, 0xA1BA1BA79E1632DCULL, 0x6462D92A69731732ULL,
+	0xCA28A291859BBF93ULL, 0x7D7B8F7503CFDCFEULL, 0xFCB2CB35E702AF78ULL, 0x5CDA735244C3D43EULL,
+	0x9DEFBF01B061ADABULL, 0x3A0888136AFA64A7ULL, 0xC56BAEC21C7A1916ULL, 0x088AAA1845B8FDD0ULL,
+	0xF6C69A72A3989F5BULL, 0x8AAD549E57273D45ULL, 0x9A3C2087A63F6399ULL, 0x36AC54E2F678864BULL,
+	0xC0CB28A98FCF3C7FULL, 0x84576A1BB416A7DDULL, 0xF0FDF2D3F3C30B9FULL, 0x656D44A2A11C51D5ULL,
+	0x969EB7C47859E743ULL, 0x9F644AE5A4B1B325ULL, 0xBC4665B596706114ULL, 0x873D5D9F0DDE1FEEULL,
+	0xEB57FF22FC0C7959ULL, 0xA90CB506D155A7EAULL, 0x9316FF75DD87CBD8ULL, 0x09A7F12442D588F2ULL,
+	0xB7DCBF5354E9BECEULL, 0x0C11ED6D538AEB2FULL, 0xE5D3EF282A242E81ULL, 0x8F1668C8A86DA5FAULL,
+	0x8FA475791A569D10ULL, 0xF96E017D694487BCULL, 0xB38D92D760EC4455ULL, 0x37C981DCC395A9ACULL,
+	0xE070F78D3927556AULL, 0x85BBE253F47B1417ULL, 0x8C469AB843B89562ULL, 0x93956D7478CCEC8EULL,
+	0xAF58416654A6BABBULL, 0x387AC8D1970027B2ULL, 0xDB2E51BFE9D0696AULL, 0x06997B05FCC0319EULL,
+	0x88FCF317F22241E2ULL, 0x441FECE3BDF81F03ULL, 0xAB3C2FDDEEAAD25AULL, 0xD527E81CAD7626C3ULL,
+	0xD60B3BD56A5586F1ULL, 0x8A71E223D8D3B074ULL, 0x85C7056562757456ULL, 0xF6872D5667844E49ULL,
+	0xA738C6BEBB12D16CULL, 0xB428F8AC016561DBULL, 0xD106F86E69D785C7ULL, 0xE13336D701BEBA52ULL,
+	0x82A45B450226B39CULL, 0xECC0024661173473ULL, 0xA34D721642B06084ULL, 0x27F002D7F95D0190ULL,
+	0xCC20CE9BD35C78A5ULL, 0x31EC038DF7B441F4ULL, 0xFF290242C83396CEULL, 0x7E67047175A15271ULL,
+	0x9F79A169BD203E41ULL, 0x0F0062C6E984D386ULL, 0xC75809C42C684DD1ULL, 0x52C07B78A3E60868ULL,
+	0xF92E0C3537826145ULL, 0xA7709A56CCDF8A82ULL, 0x9BBCC7A142B17CCBULL, 0x88A66076400BB691ULL,
+	0xC2ABF989935DDBFEULL, 0x6ACFF893D00EA435ULL, 0xF356F7EBF83552FEULL, 0x0583F6B8C4124D43ULL,
+	0x98165AF37B2153DEULL, 0xC3727A337A8B704AULL, 0xBE1BF1B059E9A8D6ULL, 0x744F18C0592E4C5CULL,
+	0xEDA2EE1C7064130CULL, 0x1162DEF06F79DF73ULL, 0x9485D4D1C63E8BE7ULL, 0x8ADDCB5645AC2BA8ULL,
+	0xB9A74A0637CE2EE1ULL, 0x6D953E2BD7173692ULL, 0xE8111C87C5C1BA99ULL, 0xC8FA8DB6CCDD0437ULL,
+	0x910AB1D4DB9914A0ULL, 0x1D9C9892400A22A2ULL, 0xB54D5E4A127F59C8ULL, 0x2503BEB6D00CAB4BULL,
+	0xE2A0B5DC971F303AULL, 0x2E44AE64840FD61DULL, 0x8DA471A9DE737E24ULL, 0x5CEAECFED289E5D2ULL,
+	0xB10D8E1456105DADULL, 0x7425A83E872C5F47ULL, 0xDD50F1996B947518ULL, 0xD12F124E28F77719ULL,
+	0x8A5296FFE33CC92FULL, 0x82BD6B70D99AAA6FULL, 0xACE73CBFDC0BFB7BULL, 0x636CC64D1001550BULL,
+	0xD8210BEFD30EFA5AULL, 0x3C47F7E05401AA4EULL, 0x8714A775E3E95C78ULL, 0x65ACFAEC34810A71ULL,
+	0xA8D9D1535CE3B396ULL, 0x7F1839A741A14D0DULL, 0xD31045A8341CA07CULL, 0x1EDE48111209A050ULL,
+	0x83EA2B892091E44DULL, 0x934AED0AAB460432ULL, 0xA4E4B66B68B65D60ULL, 0xF81DA84D5617853FULL,
+	0xCE1DE40642E3F4B9ULL, 0x36251260AB9D668EULL, 0x80D2AE83E9CE78F3ULL, 0xC1D72B7C6B426019ULL,
+	0xA1075A24E4421730ULL, 0xB24CF65B8612F81FULL, 0xC94930AE1D529CFCULL, 0xDEE033F26797B627ULL,
+	0xFB9B7CD9A4A7443CULL, 0x169840EF017DA3B1ULL, 0x9D412E0806E88AA5ULL, 0x8E1F289560EE864EULL,
+	0xC491798A08A2AD4EULL, 0xF1A6F2BAB92A27E2ULL, 0xF5B5D7EC8ACB58A2ULL, 0xAE10AF696774B1DBULL,
+	0x9991A6F3D6BF1765ULL, 0xACCA6DA1E0A8EF29ULL, 0xBFF610B0CC6EDD3FULL, 0x17FD090A58D32AF3ULL,
+	0xEFF394DCFF8A948EULL, 0xDDFC4B4CEF07F5B0ULL, 0x95F83D0A1FB69CD9ULL, 0x4ABDAF101564F98EULL,
+	0xBB764C4CA7A4440FULL, 0x9D6D1AD41ABE37F1ULL, 0xEA53DF5FD18D5513ULL, 0x84C86189216DC5EDULL,
+	0x92746B9BE2F8552CULL, 0x32FD3CF5B4E49BB4ULL, 0xB7118682DBB66A77ULL, 0x3FBC8C33221DC2A1ULL,
+	0xE4D5E82392A40515ULL, 0x0FABAF3FEAA5334AULL, 0x8F05B1163BA6832DULL, 0x29CB4D87F2A7400EULL,
+	0xB2C71D5BCA9023F8ULL, 0x743E20E9EF511012ULL, 0xDF78E4B2BD342CF6ULL, 0x914DA9246B255416ULL,
+	0x8BAB8EEFB6409C1AULL, 0x1AD089B6C2F7548EULL, 0xAE9672ABA3D0C320ULL, 0xA184AC2473B529B1ULL,
+	0xDA3C0F568CC4F3E8ULL, 0xC9E5D72D90A2741EULL, 0x8865899617FB1871ULL, 0x7E2FA67C7A658892ULL,
+	0xAA7EEBFB9DF9DE8DULL, 0xDDBB901B98FEEAB7ULL, 0xD51EA6FA85785631ULL, 0x552A74227F3EA565ULL,
+	0x8533285C936B35DEULL, 0xD53A88958F87275FULL, 0xA67FF273B8460356ULL, 0x8A892ABAF368F137ULL,
+	0xD01FEF10A657842CULL, 0x2D2B7569B0432D85ULL, 0x8213F56A67F6B29BULL, 0x9C3B29620E29FC73ULL,
+	0xA298F2C501F45F42ULL, 0x8349F3BA91B47B8FULL, 0xCB3F2F7642717713ULL, 0x241C70A936219A73ULL,
+	0xFE0EFB53D30DD4D7ULL, 0xED238CD383AA0110ULL, 0x9EC95D1463E8A506ULL, 0xF4363804324A40AAULL,
+	0xC67BB4597CE2CE48ULL, 0xB143C6053EDCD0D5ULL, 0xF81AA16FDC1B81DAULL, 0xDD94B7868E94050AULL,
+	0x9B10A4E5E9913128ULL, 0xCA7CF2B4191C8326ULL, 0xC1D4CE1F63F57D72ULL, 0xFD1C2F611F63A3F0ULL,
+	0xF24A01A73CF2DCCFULL, 0xBC633B39673C8CECULL, 0x976E41088617CA01ULL, 0xD5BE0503E085D813ULL,
+	0xBD49D14AA79DBC82ULL, 0x4B2D8644D8A74E18ULL, 0xEC9C459D51852BA2ULL, 0xDDF8E7D60ED1219EULL,
+	0x93E1AB8252F33B45ULL, 0xCABB90E5C942B503ULL, 0xB8DA1662E7B00A17ULL, 0x3D6A751F3B936243ULL,
+	0xE7109BFBA19C0C9DULL, 0x0CC512670A783AD4ULL, 0x906A617D450187E2ULL, 0x27FB2B80668B24C5ULL,
+	0xB484F9DC9641E9DAULL, 0xB1F9F660802DEDF6ULL, 0xE1A63853BBD26451ULL, 0x5E7873F8A0396973ULL,
+	0x8D07E33455637EB2ULL, 0xDB0B487B6423E1E8ULL, 0xB049DC016ABC5E5FULL, 0x91CE1A9A3D2CDA62ULL,
+	0xDC5C5301C56B75F7ULL, 0x7641A140CC7810FBULL, 0x89B9B3E11B6329BAULL, 0xA9E904C87FCB0A9DULL,
+	0xAC2820D9623BF429ULL, 0x546345FA9FBDCD44ULL, 0xD732290FBACAF133ULL, 0xA97C177947AD4095ULL,
+	0x867F59A9D4BED6C0ULL, 0x49ED8EABCCCC485DULL, 0xA81F301449EE8C70ULL, 0x5C68F256BFFF5A74ULL,
+	0xD226FC195C6A2F8CULL, 0x73832EEC6FFF3111ULL, 0x83585D8FD9C25DB7ULL, 0xC831FD53C5FF7EABULL,
+	0xA42E74F3D032F525ULL, 0xBA3E7CA8B77F5E55ULL, 0xCD3A1230C43FB26FULL, 0x28CE1BD2E55F35EBULL,
+	0x80444B5E7AA7CF85ULL, 0x7980D163CF5B81B3ULL, 0xA0555E361951C366ULL, 0xD7E105BCC332621FULL,
+	0xC86AB5C39FA63440ULL, 0x8DD9472BF3FEFAA7ULL, 0xFA856334878FC150ULL, 0xB14F98F6F0FEB951ULL,
+	0x9C935E00D4B9D8D2ULL, 0x6ED1BF9A569F33D3ULL, 0xC3B8358109E84F07ULL, 0x0A862F80EC4700C8ULL,
+	0xF4A642E14C6262C8ULL, 0xCD27BB612758C0FAULL, 0x98E7E9CCCFBD7DBDULL, 0x8038D51CB897789CULL,
+	0xBF21E44003ACDD2CULL, 0xE0470A63E6BD56C3ULL, 0xEEEA5D5004981478ULL, 0x1858CCFCE06CAC74ULL,
+	0x95527A5202DF0CCBULL, 0x0F37801E0C43EBC8ULL, 0xBAA718E68396CFFDULL, 0xD30560258F54E6BAULL,
+	0xE950DF20247C83FDULL, 0x47C6B82EF32A2069ULL, 0x91D28B7416CDD27EULL, 0x4CDC331D57FA5441ULL,
+	0xB6472E511C81471DULL, 0xE0133FE4ADF8E952ULL, 0xE3D8F9E563A198E5ULL, 0x58180FDDD97723A6ULL,
+	0x8E679C2F5E44FF8FULL, 0x570F09EAA7EA7648ULL
+};
+
+/// <returns>True if all eight bytes of chunk are '0' to '9'</returns>
+static inline bool ParseIsEightDigits(U64 chunk)
+{
+	return (((chunk & 0xF0F0F0F0F0F0F0F0ULL) | (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL);
+}
+
+/// <summary>
+/// Converts eight ASCII digits loaded little endian into their value with three multiplies
+/// </summary>
+static inline U32 ParseEightDigits(U64 chunk)
+{
+	chunk = (chunk & 0x0F0F0F0F0F0F0F0FULL) * 2561 >> 8;
+	chunk = (chunk & 0x00FF00FF00FF00FFULL) * 6553601 >> 16;
+	return (U32)((chunk & 0x0000FFFF0000FFFFULL) * 42949672960001ULL >> 32);
+}
+
+/// <summary>
+/// Eisel-Lemire, rounds mantissa * 10^exponent to the nearest double using one or two 64x128 bit multiplies
+/// </summary>
+/// <returns>False if the truncated product can't decide the rounding, the caller has to fall back to exact arithmetic</returns>
+static inline bool ParseEiselLemire(U64 mantissa, I64 exponent, F64& result)
+{
+	if (mantissa == 0 || exponent < PARSE_SMALLEST_POWER) { result = 0.0; return true; }
+	if (exponent > PARSE_LARGEST_POWER) { result = std::numeric_limits<F64>::infinity(); return true; }
+
+	I32 leadingZeros = std::countl_zero(mantissa);
+	mantissa <<= leadingZeros;
+
+	const U64* power = PARSE_POWERS_OF_FIVE + 2 * (exponent - PARSE_SMALLEST_POWER);
+
+	U64 high;
+	U64 low = _umul128(mantissa, power[0], &high);
+
+	//Only the top 55 bits matter, the low half of 5^q is needed when the bits below them could still carry into them
+	if ((high & 0x1FF) == 0x1FF)
+	{
+		U64 carryHigh;
+		_umul128(mantissa, power[1], &carryHigh);
+		low += carryHigh;
+		if (carryHigh > low) { ++high; }
+	}
+
+	//Outside this exponent range an all ones low word may hide a carry the truncated table lost
+	if (low == U64_MAX && (exponent < -27 || exponent > 55)) { return false; }
+
+	U64 upperBit = high >> 63;
+	U64 bits = high >> (upperBit + 9);
+	I64 power2 = (((152170 + 65536) * exponent) >> 16) + 63 + (I64)upperBit - leadingZeros + 1023;
+
+	if (power2 <= 0)
+	{
+		if (-power2 + 1 >= 64) { result = 0.0; return true; }
+
+		bits >>= -power2 + 1;
+		bits += bits & 1;
+		bits >>= 1;
+		power2 = bits < (1ULL << 52) ? 0 : 1;
+
+		bits |= (U64)power2 << 52;
+		memcpy(&result, &bits, sizeof(F64));
+		return true;
+	}
+
+	//A product exactly halfway between two doubles can only come from small exponents, there ties round to even
+	if (low <= 1 && exponent >= -4 && exponent <= 23 && (bits & 3) == 1 && (bits << (upperBit + 9)) == high) { bits &= ~1ULL; }
+
+	bits += bits & 1;
+	bits >>= 1;
+
+	if (bits >= (2ULL << 52))
+	{
+		bits = 1ULL << 52;
+		++power2;
+	}
+
+	if (power2 >= 0x7FF) { result = std::numeric_limits<F64>::infinity(); return true; }
+
+	bits = (bits & ~(1ULL << 52)) | ((U64)power2 << 52);
+	memcpy(&result, &bits, sizeof(F64));
+	return true;
+}
+
+/// <summary>
+/// Accumulates decimal digits from it into value, eight at a time for single byte characters
+/// </summary>
+/// <returns>False if value overflowed</returns>
+template<Character C>
+inline bool ParseDigits(const C*& it, const C* end, U64& value)
+{
+	if constexpr (sizeof(C) == 1)
+	{
+		//Up to this bound another eight digits can't overflow, so twenty digit values still take two chunks
+		while (end - it >= 8 && value <= (U64_MAX - 99999999ULL) / 100000000ULL)
+		{
+			U64 chunk;
+			memcpy(&chunk, it, 8);
+			if (!ParseIsEightDigits(chunk)) { break; }
+
+			value = value * 100000000ULL + ParseEightDigits(chunk);
+			it += 8;
+		}
+	}
+
+	for (; it != end && *it >= '0' && *it <= '9'; ++it)
+	{
+		U64 digit = (U64)(*it - '0');
+		if (value > (U64_MAX - digit) / 10) { return false; }
+		value = value * 10 + digit;
+	}
+
+	return true;
+}
+
+/// <returns>The value of a hexadecimal digit, 16 if c isn't one</returns>
+template<Character C>
+inline U64 ParseHexDigit(C c)
+{
+	if (c >= '0' && c <= '9') { return c - '0'; }
+	if (c >= 'a' && c <= 'f') { return c - 'a' + 10; }
+	if (c >= 'A' && c <= 'F') { return c - 'A' + 10; }
+	return 16;
+}
+
+//Transcoding
+static inline constexpr U32 UTF_INVALID = U32_MAX;	//Returned by UtfDecode for malformed input
+
+/// <returns>True if the 16 byte block at it only holds ASCII characters</returns>
+template<Character C>
+inline bool UtfAsciiBlock(const C* it)
+{
+	__m128i block = _mm_loadu_si128((const __m128i*)it);
+
+	if constexpr (sizeof(C) == 1) { return _mm_movemask_epi8(block) == 0; }
+	else if constexpr (sizeof(C) == 2) { return _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(block, _mm_set1_epi16((short)0xFF80)), _mm_setzero_si128())) == 0xFFFF; }
+	else { return _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(block, _mm_set1_epi32((int)0xFFFFFF80)), _mm_setzero_si128())) == 0xFFFF; }
+}
+
+/// <summary>
+/// Widens or narrows one 16 byte block of ASCII characters from in to out
+/// </summary>
+template<Character To, Character From>
+inline void UtfAsciiCopy(To* out, const From* in)
+{
+	__m128i block = _mm_loadu_si128((const __m128i*)in);
+	__m128i zero = _mm_setzero_si128();
+
+	if constexpr (sizeof(From) == sizeof(To)) { _mm_storeu_si128((__m128i*)out, block); }
+	else if constexpr (sizeof(From) == 1 && sizeof(To) == 2)
+	{
+		_mm_storeu_si128((__m128i*)out, _mm_unpacklo_epi8(block, zero));
+		_mm_storeu_si128((__m128i*)out + 1, _mm_unpackhi_epi8(block, zero));
+	}
+	else if constexpr (sizeof(From) == 1 && sizeof(To) == 4)
+	{
+		__m128i low = _mm_unpacklo_epi8(block, zero);
+		__m128i high = _mm_unpackhi_epi8(block, zero);
+		_mm_storeu_si128((__m128i*)out, _mm_unpacklo_epi16(low, zero));
+		_mm_storeu_si128((__m128i*)out + 1, _mm_unpackhi_epi16(low, zero));
+		_mm_storeu_si128((__m128i*)out + 2, _mm_unpacklo_epi16(high, zero));
+		_mm_storeu_si128((__m128i*)out + 3, _mm_unpackhi_epi16(high, zero));
+	}
+	else if constexpr (sizeof(From) == 2 && sizeof(To) == 1) { _mm_storel_epi64((__m128i*)out, _mm_packus_epi16(block, block)); }
+	else if constexpr (sizeof(From) == 2 && sizeof(To) == 4)
+	{
+		_mm_storeu_si128((__m128i*)out, _mm_unpacklo_epi16(block, zero));
+		_mm_storeu_si128((__m128i*)out + 1, _mm_unpackhi_epi16(block, zero));
+	}
+	else if constexpr (sizeof(From) == 4 && sizeof(To) == 1)
+	{
+		__m128i narrow = _mm_packs_epi32(block, block);
+		I32 packed = _mm_cvtsi128_si32(_mm_packus_epi16(narrow, narrow));
+		memcpy(out, &packed, 4);
+	}
+	else { _mm_storel_epi64((__m128i*)out, _mm_packs_epi32(block, block)); }
+}
+
+/// <summary>
+/// Decodes one code point from it and advances past it, UTF-8, UTF-16 or UTF-32 depending on the width of C
+/// Overlong forms, surrogate code points, unpaired surrogates and values above U+10FFFF are rejected
+/// </summary>
+/// <returns>The code point, UTF_INVALID if the input is malformed</returns>
+template<Character C>
+inline U32 UtfDecode(const C*& it, const C* end)
+{
+	if constexpr (sizeof(C) == 1)
+	{
+		U32 c = (U8)*it;
+		if (c < 0x80) { ++it; return c; }
+
+		U64 count = c < 0xC2 ? 0 : c < 0xE0 ? 2 : c < 0xF0 ? 3 : c < 0xF5 ? 4 : 0;
+		if (count == 0 || (U64)(end - it) < count) { return UTF_INVALID; }
+
+		U32 codepoint = c & (0x7F >> count);
+		for (U64 i = 1; i < count; ++i)
+		{
+			U32 next = (U8)it[i];
+			if ((next & 0xC0) != 0x80) { return UTF_INVALID; }
+			codepoint = (codepoint << 6) | (next & 0x3F);
+		}
+
+		if (count == 3 && (codepoint < 0x800 || (codepoint >= 0xD800 && codepoint <= 0xDFFF))) { return UTF_INVALID; }
+		if (count == 4 && (codepoint < 0x10000 || codepoint > 0x10FFFF)) { return UTF_INVALID; }
+
+		it += count;
+		return codepoint;
+	}
+	else if constexpr (sizeof(C) == 2)
+	{
+		U32 c = (U16)*it++;
+		if (c < 0xD800 || c > 0xDFFF) { return c; }
+		if (c > 0xDBFF || it == end) { return UTF_INVALID; }
+
+		U32 low = (U16)*it;
+		if (low < 0xDC00 || low > 0xDFFF) { return UTF_INVALID; }
+
+		++it;
+		return 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+	}
+	else
+	{
+		U32 c = (U32)*it++;
+		if (c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) { return UTF_INVALID; }
+		return c;
+	}
+}
+
+/// <returns>The amount of C needed to encode codepoint</returns>
+template<Character C>
+inline U64 UtfUnits(U32 codepoint)
+{
+	if constexpr (sizeof(C) == 1) { return codepoint < 0x80 ? 1 : codepoint < 0x800 ? 2 : codepoint < 0x10000 ? 3 : 4; }
+	else if constexpr (sizeof(C) == 2) { return codepoint < 0x10000 ? 1 : 2; }
+	else { return 1; }
+}
+
+/// <returns>One past the last character written</returns>
+template<Character C>
+inline C* UtfEncode(C* it, U32 codepoint)
+{
+	if constexpr (sizeof(C) == 1)
+	{
+		if (codepoint < 0x80) { *it++ = (C)codepoint; }
+		else if (codepoint < 0x800)
+		{
+			*it++ = (C)(0xC0 | (codepoint >> 6));
+			*it++ = (C)(0x80 | (codepoint & 0x3F));
+		}
+		else if (codepoint < 0x10000)
+		{
+			*it++ = (C)(0xE0 | (codepoint >> 12));
+			*it++ = (C)(0x80 | ((codepoint >> 6) & 0x3F));
+			*it++ = (C)(0x80 | (codepoint & 0x3F));
+		}
+		else
+		{
+			*it++ = (C)(0xF0 | (codepoint >> 18));
+			*it++ = (C)(0x80 | ((codepoint >> 12) & 0x3F));
+			*it++ = (C)(0x80 | ((codepoint >> 6) & 0x3F));
+			*it++ = (C)(0x80 | (codepoint & 0x3F));
+		}
+	}
+	else if constexpr (sizeof(C) == 2)
+	{
+		if (codepoint < 0x10000) { *it++ = (C)codepoint; }
+		else
+		{
+			codepoint -= 0x10000;
+			*it++ = (C)(0xD800 + (codepoint >> 10));
+			*it++ = (C)(0xDC00 + (codepoint & 0x3FF));
+		}
+	}
+	else { *it++ = (C)codepoint; }
+
+	return it;
+}
+
+/// <summary>
+/// Validates from and counts the characters it takes as To, ASCII runs are checked a block at a time
+/// </summary>
+/// <returns>The exact length of the transcoded string, U64_MAX if from is malformed</returns>
+template<Character To, Character From>
+inline U64 TranscodeLength(const From* it, const From* end)
+{
+	constexpr U64 BLOCK = 16 / sizeof(From);
+
+	U64 length = 0;
+
+	while (it != end)
+	{
+		if ((U64)(end - it) >= BLOCK && UtfAsciiBlock(it))
+		{
+			it += BLOCK;
+			length += BLOCK;
+			continue;
+		}
+
+		U32 codepoint = UtfDecode(it, end);
+		if (codepoint == UTF_INVALID) { return U64_MAX; }
+		length += UtfUnits<To>(codepoint);
+	}
+
+	return length;
+}
+
+/// <summary>
+/// Transcodes validated input from into out, which has room for TranscodeLength characters
+/// </summary>
+template<Character To, Character From>
+inline void TranscodeWrite(To* out, const From* it, const From* end)
+{
+	constexpr U64 BLOCK = 16 / sizeof(From);
+
+	while (it != end)
+	{
+		if ((U64)(end - it) >= BLOCK && UtfAsciiBlock(it))
+		{
+			UtfAsciiCopy(out, it);
+			it += BLOCK;
+			out += BLOCK;
+			continue;
+		}
+
+		out = UtfEncode(out, UtfDecode(it, end));
+	}
+}
+
+//Encoding
+static inline constexpr char ENCODE_BASE64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static inline constexpr char ENCODE_HEX[] = "0123456789abcdef";
+static inline constexpr U8 DECODE_INVALID = 0xFF;	//Marks characters outside the alphabet in the decode tables
+
+struct DecodeTable { U8 values[256]; };
+
+static inline constexpr DecodeTable DECODE_BASE64 = []()
+{
+	DecodeTable table{};
+	for (U8& value : table.values) { value = DECODE_INVALID; }
+	for (U8 i = 0; i < 64; ++i) { table.values[(U8)ENCODE_BASE64[i]] = i; }
+	return table;
+}();
+
+static inline constexpr DecodeTable DECODE_HEX = []()
+{
+	DecodeTable table{};
+	for (U8& value : table.values) { value = DECODE_INVALID; }
+	for (U8 i = 0; i < 10; ++i) { table.values['0' + i] = i; }
+	for (U8 i = 0; i < 6; ++i) { table.values['a' + i] = 10 + i; table.values['A' + i] = 10 + i; }
+	return table;
+}();
+
+/// <returns>The value of c in table, DECODE_INVALID if c isn't in it</returns>
+template<Character C>
+inline U8 DecodeUnit(const DecodeTable& table, C c)
+{
+	using Unit = std::make_unsigned_t<C>;
+
+	return (Unit)c < 256 ? table.values[(Unit)c] : DECODE_INVALID;
+}
+
+#if defined(__AVX2__)
+/// <summary>
+/// Encodes the 24 bytes at in, reading 28, into 32 Base64 characters
+/// Bytes are spread into 6 bit fields with shuffles and multiplies, then each field is offset to its character by a range lookup
+/// </summary>
+inline __m256i EncodeBase64Block(const U8* in)
+{
+	__m256i block = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)in)), _mm_loadu_si128((const __m128i*)(in + 12)), 1);
+	block = _mm256_shuffle_epi8(block, _mm256_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1, 10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+
+	__m256i high = _mm256_mulhi_epu16(_mm256_and_si256(block, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+	__m256i low = _mm256_mullo_epi16(_mm256_and_si256(block, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+	__m256i indices = _mm256_or_si256(high, low);
+
+	//0-25 use slot 13, 26-51 slot 0, 52-61 slots 1-10, 62 slot 11 and 63 slot 12
+	__m256i slots = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+	slots = _mm256_or_si256(slots, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+
+	__m256i offsets = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+		'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+	return _mm256_add_epi8(indices, _mm256_shuffle_epi8(offsets, slots));
+}
+
+/// <summary>
+/// Decodes 32 Base64 characters at in into 24 bytes at out
+/// Characters are validated by looking up a bit per high nibble in a mask chosen by the low nibble
+/// </summary>
+/// <returns>False if any character isn't in the alphabet, out is left unspecified</returns>
+inline bool DecodeBase64Block(U8* out, const char* in)
+{
+	__m256i block = _mm256_loadu_si256((const __m256i*)in);
+	__m256i high = _mm256_and_si256(_mm256_srli_epi32(block, 4), _mm256_set1_epi8(0x0F));
+	__m256i low = _mm256_and_si256(block, _mm256_set1_epi8(0x0F));
+
+	__m256i masks = _mm256_setr_epi8((char)0xA8, (char)0xF8, (char)0xF8, (char)0xF8, (char)0xF8, (char)0xF8, (char)0xF8, (char)0xF8, (char)0xF8, (char)0xF8, (char)0xF0, 0x54, 0x50, 0x50, 0x50, 0x54,
+		(char)0xA8, (char)0xF8, (char)0xF8, (char)0xF8, (char)0xF8, (char)0xF8, (char)0xF8, (char)0xF8, (char)0xF8, (char)0xF8, (char)0xF0, 0x54, 0x50, 0x50, 0x50, 0x54);
+	__m256i bits = _mm256_setr_epi8(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, (char)0x80, 0, 0, 0, 0, 0, 0, 0, 0,
+		0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, (char)0x80, 0, 0, 0, 0, 0, 0, 0, 0);
+
+	__m256i valid = _mm256_and_si256(_mm256_shuffle_epi8(masks, low), _mm256_shuffle_epi8(bits, high));
+	if (_mm256_movemask_epi8(_mm256_cmpeq_epi8(valid, _mm256_setzero_si256()))) { return false; }
+
+	__m256i offsets = _mm256_setr_epi8(0, 0, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+	__m256i offset = _mm256_blendv_epi8(_mm256_shuffle_epi8(offsets, high), _mm256_set1_epi8(16), _mm256_cmpeq_epi8(block, _mm256_set1_epi8('/')));
+	__m256i values = _mm256_add_epi8(block, offset);
+
+	//Four 6 bit values become one 24 bit value per lane, then the three bytes are gathered in big endian order
+	__m256i merged = _mm256_madd_epi16(_mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140)), _mm256_set1_epi32(0x00011000));
+	merged = _mm256_shuffle_epi8(merged, _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, 2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+
+	__m128i upper = _mm256_extracti128_si256(merged, 1);
+	_mm_storeu_si128((__m128i*)out, _mm256_castsi256_si128(merged));
+	memcpy(out + 12, &upper, 12);
+
+	return true;
+}
+
+/// <summary>
+/// Encodes the 32 bytes at in into 64 hex characters
+/// </summary>
+inline void EncodeHexBlock(char* out, const U8* in)
+{
+	__m256i block = _mm256_loadu_si256((const __m256i*)in);
+	__m256i digits = _mm256_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f',
+		'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f');
+
+	__m256i high = _mm256_shuffle_epi8(digits, _mm256_and_si256(_mm256_srli_epi16(block, 4), _mm256_set1_epi8(0x0F)));
+	__m256i low = _mm256_shuffle_epi8(digits, _mm256_and_si256(block, _mm256_set1_epi8(0x0F)));
+
+	__m256i first = _mm256_unpacklo_epi8(high, low);
+	__m256i second = _mm256_unpackhi_epi8(high, low);
+
+	_mm256_storeu_si256((__m256i*)out, _mm256_permute2x128_si256(first, second, 0x20));
+	_mm256_storeu_si256((__m256i*)(out + 32), _mm256_permute2x128_si256(first, second, 0x31));
+}
+
+/// <summary>
+/// Decodes 32 hex characters of either case at in into 16 bytes at out
+/// </summary>
+/// <returns>False if any character isn't a hex digit, out is left unspecified</returns>
+inline bool DecodeHexBlock(U8* out, const char* in)
+{
+	__m256i block = _mm256_loadu_si256((const __m256i*)in);
+
+	__m256i digit = _mm256_sub_epi8(block, _mm256_set1_epi8('0'));
+	__m256i letter = _mm256_sub_epi8(_mm256_or_si256(block, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+	__m256i isDigit = _mm256_and_si256(_mm256_cmpgt_epi8(digit, _mm256_set1_epi8(-1)), _mm256_cmpgt_epi8(_mm256_set1_epi8(10), digit));
+	__m256i isLetter = _mm256_and_si256(_mm256_cmpgt_epi8(letter, _mm256_set1_epi8(-1)), _mm256_cmpgt_epi8(_mm256_set1_epi8(6), letter));
+
+	if (_mm256_movemask_epi8(_mm256_or_si256(isDigit, isLetter)) != -1) { return false; }
+
+	__m256i values = _mm256_blendv_epi8(_mm256_add_epi8(letter, _mm256_set1_epi8(10)), digit, isDigit);
+	__m256i bytes = _mm256_maddubs_epi16(values, _mm256_set1_epi16(0x0110));
+	bytes = _mm256_permute4x64_epi64(_mm256_packus_epi16(bytes, bytes), 0x08);
+
+	_mm_storeu_si128((__m128i*)out, _mm256_castsi256_si128(bytes));
+
+	return true;
+}
+#endif
+
+/// <summary>
+/// Writes the Base64 encoding of size bytes at in to out, which has room for (size + 2) / 3 * 4 characters, the last group is padded with '='
+/// </summary>
+template<Character C>
+inline void EncodeBase64Write(C* out, const U8* in, U64 size)
+{
+	const U8* end = in + size;
+
+#if defined(__AVX2__)
+	if constexpr (sizeof(C) == 1)
+	{
+		for (; end - in >= 28; in += 24, out += 32) { _mm256_storeu_si256((__m256i*)out, EncodeBase64Block(in)); }
+	}
+#endif
+
+	for (; end - in >= 3; in += 3, out += 4)
+	{
+		U32 group = ((U32)in[0] << 16) | ((U32)in[1] << 8) | in[2];
+		out[0] = ENCODE_BASE64[group >> 18];
+		out[1] = ENCODE_BASE64[(group >> 12) & 63];
+		out[2] = ENCODE_BASE64[(group >> 6) & 63];
+		out[3] = ENCODE_BASE64[group & 63];
+	}
+
+	if (end - in == 2)
+	{
+		U32 group = ((U32)in[0] << 16) | ((U32)in[1] << 8);
+		out[0] = ENCODE_BASE64[group >> 18];
+		out[1] = ENCODE_BASE64[(group >> 12) & 63];
+		out[2] = ENCODE_BASE64[(group >> 6) & 63];
+		out[3] = '=';
+	}
+	else if (end - in == 1)
+	{
+		out[0] = ENCODE_BASE64[in[0] >> 2];
+		out[1] = ENCODE_BASE64[(in[0] & 3) << 4];
+		out[2] = '=';
+		out[3] = '=';
+	}
+}
+
+/// <returns>The amount of bytes size Base64 characters at in decode to, U64_MAX if the length or padding is malformed</returns>
+template<Character C>
+inline U64 DecodeBase64Length(const C* in, U64 size)
+{
+	if (size % 4) { return U64_MAX; }
+	if (size == 0) { return 0; }
+
+	U64 padding = in[size - 1] == '=' ? (in[size - 2] == '=' ? 2 : 1) : 0;
+
+	return size / 4 * 3 - padding;
+}
+
+/// <summary>
+/// Decodes size Base64 characters at in to out, which has room for DecodeBase64Length bytes
+/// Only canonical input is accepted, the padding must be present and the bits it leaves unused must be zero
+/// </summary>
+/// <returns>False if any character is invalid, out is left unspecified</returns>
+template<Character C>
+inline bool DecodeBase64Write(U8* out, const C* in, U64 size)
+{
+	if (size == 0) { return true; }
+
+	//The last group holds the padding and is decoded on its own
+	const C* end = in + size - 4;
+
+#if defined(__AVX2__)
+	if constexpr (sizeof(C) == 1)
+	{
+		for (; end - in >= 32; in += 32, out += 24) { if (!DecodeBase64Block(out, (const char*)in)) { return false; } }
+	}
+#endif
+
+	for (; in != end; in += 4, out += 3)
+	{
+		U8 a = DecodeUnit(DECODE_BASE64, in[0]), b = DecodeUnit(DECODE_BASE64, in[1]), c = DecodeUnit(DECODE_BASE64, in[2]), d = DecodeUnit(DECODE_BASE64, in[3]);
+		if ((a | b | c | d) & 0x80) { return false; }
+
+		U32 group = ((U32)a << 18) | ((U32)b << 12) | ((U32)c << 6) | d;
+		out[0] = (U8)(group >> 16);
+		out[1] = (U8)(group >> 8);
+		out[2] = (U8)group;
+	}
+
+	U8 a = DecodeUnit(DECODE_BASE64, in[0]), b = DecodeUnit(DECODE_BASE64, in[1]);
+	if ((a | b) & 0x80) { return false; }
+
+	out[0] = (U8)((a << 2) | (b >> 4));
+
+	if (in[2] == '=')
+	{
+		return in[3] == '=' && (b & 15) == 0;
+	}
+
+	U8 c = DecodeUnit(DECODE_BASE64, in[2]);
+	if (c & 0x80) { return false; }
+
+	out[1] = (U8)((b << 4) | (c >> 2));
+
+	if (in[3] == '=')
+	{
+		return (c & 3) == 0;
+	}
+
+	U8 d = DecodeUnit(DECODE_BASE64, in[3]);
+	if (d & 0x80) { return false; }
+
+	out[2] = (U8)((c << 6) | d);
+
+	return true;
+}
+
+/// <summary>
+/// Writes the lowercase hex encoding of size bytes at in to out, which has room for size * 2 characters
+/// </summary>
+template<Character C>
+inline void EncodeHexWrite(C* out, const U8* in, U64 size)
+{
+	const U8* end = in + size;
+
+#if defined(__AVX2__)
+	if constexpr (sizeof(C) == 1)
+	{
+		for (; end - in >= 32; in += 32, out += 64) { EncodeHexBlock((char*)out, in); }
+	}
+#endif
+
+	for (; in != end; ++in, out += 2)
+	{
+		out[0] = ENCODE_HEX[*in >> 4];
+		out[1] = ENCODE_HEX[*in & 15];
+	}
+}
+
+/// <summary>
+/// Decodes size hex characters of either case at in to out, which has room for size / 2 bytes
+/// </summary>
+/// <returns>False if size is odd or any character isn't a hex digit, out is left unspecified</returns>
+template<Character C>
+inline bool DecodeHexWrite(U8* out, const C* in, U64 size)
+{
+	if (size % 2) { return false; }
+
+	const C* end = in + size;
+
+#if defined(__AVX2__)
+	if constexpr (sizeof(C) == 1)
+	{
+		for (; end - in >= 32; in += 32, out += 16) { if (!DecodeHexBlock(out, (const char*)in)) { return false; } }
+	}
+#endif
+
+	for (; in != end; in += 2, ++out)
+	{
+		U8 high = DecodeUnit(DECODE_HEX, in[0]), low = DecodeUnit(DECODE_HEX, in[1]);
+		if ((high | low) & 0x80) { return false; }
+
+		*out = (U8)((high << 4) | low);
+	}
+
+	return true;
+}
+
+template<Character C>
+struct StringBase
+{
+	constexpr StringBase();
+	constexpr StringBase(NullPointer);
+	constexpr StringBase(U64 length);
+	constexpr StringBase(const C* other);
+	constexpr StringBase(const C* other, U64 length);
+	constexpr StringBase(const StringBase& other);
+	constexpr StringBase(const StringViewBase<C>& other);
+	constexpr StringBase(StringBase&& other) noexcept;
+
+	constexpr StringBase& operator=(NullPointer);
+	constexpr StringBase& operator=(const C* other);
+	constexpr StringBase& operator=(const StringBase& other);
+	constexpr StringBase& operator=(const StringViewBase<C>& other);
+	constexpr StringBase& operator=(StringBase&& other) noexcept;
+
+	constexpr ~StringBase();
+	constexpr void Destroy();
+	constexpr void Clear();
+	constexpr void Resize();
+	constexpr void Reserve(U64 capacity);
+
+	constexpr StringViewBase<C> SubString(U64 start, U64 length = U64_MAX) const;
+	constexpr StringBase Appended(const StringViewBase<C>& append) const;
+	constexpr StringBase Prepended(const StringViewBase<C>& prepend) const;
+	constexpr StringBase Surrounded(const StringViewBase<C>& prepend, const StringViewBase<C>& append) const;
+
+	constexpr StringBase& Shave(U64 start, U64 length = U64_MAX);
+	constexpr StringBase& Append(const StringViewBase<C>& append);
+	constexpr StringBase& Prepend(const StringViewBase<C>& prepend);
+	constexpr StringBase& Surround(const StringViewBase<C>& prepend, const StringViewBase<C>& append);
+	constexpr StringBase& Insert(U64 index, const StringViewBase<C>& insert);
+	constexpr StringBase& Erase(U64 start, U64 length = U64_MAX);
+
+	/// <summary>
+	/// Replaces each "{}" in format with the next argument, use "{{" and "}}" for literal braces
+	/// Supports integers, floats (shortest round-trip), bools, characters, pointers (hex) and strings of the same character type
+	/// </summary>
+	template<class... Args> static StringBase Format(const StringViewBase<C>& format, const Args&... args);
+
+	/// <summary>
+	/// Formats onto the end of this string, see Format, reserves once and writes directly into the buffer
+	/// </summary>
+	template<class... Args> StringBase& AppendFormat(const StringViewBase<C>& format, const Args&... args);
+
+	/// <summary>
+	/// Encodes size bytes at data as padded Base64, see AppendBase64
+	/// </summary>
+	static StringBase EncodeBase64(const void* data, U64 size);
+
+	/// <summary>
+	/// Encodes size bytes at data as lowercase hex, see AppendHex
+	/// </summary>
+	static StringBase EncodeHex(const void* data, U64 size);
+
+	/// <summary>
+	/// Appends the padded Base64 encoding of size bytes at data, reserves once and writes directly into the buffer
+	/// </summary>
+	StringBase& AppendBase64(const void* data, U64 size);
+
+	/// <summary>
+	/// Appends the lowercase hex encoding of size bytes at data, reserves once and writes directly into the buffer
+	/// </summary>
+	StringBase& AppendHex(const void* data, U64 size);
+
+	constexpr bool Blank() const;
+	constexpr I64 IndexOf(C c, U64 start = 0) const;
+	constexpr I64 LastIndexOf(C c, U64 start = 0) const;
+	constexpr I64 IndexOf(const StringViewBase<C>& find, U64 start = 0) const;
+	constexpr bool Contains(const StringViewBase<C>& find) const;
+	constexpr U64 CountOccurrences(const StringViewBase<C>& find) const;
+	constexpr StringBase& ReplaceAll(const StringViewBase<C>& find, const StringViewBase<C>& replace);
+
+	constexpr StringViewBase<C> Trimmed() const;
+	constexpr StringBase& Trim();
+
+	SplitRange<C> Split(C delimiter) const;
+	SplitRange<C> Split(const StringViewBase<C>& delimiters) const;
+	SplitRange<C> SplitLines() const;
+	SplitRange<C> Tokenize(const StringViewBase<C>& delimiters) const;
+	template<class Container> U64 SplitInto(Container& fields, C delimiter) const;
+	template<class Container> U64 SplitInto(Container& fields, const StringViewBase<C>& delimiters) const;
+
+	U64 ParseI64(I64& value) const;
+	U64 ParseU64(U64& value) const;
+	U64 ParseF64(F64& value) const;
+	U64 ParseHexI64(I64& value) const;
+	U64 ParseHexU64(U64& value) const;
+
+	template<Character To> StringBase<To> Transcode() const;
+	StringBase<char8_t> ToUtf8() const;
+	StringBase<char16_t> ToUtf16() const;
+	StringBase<char32_t> ToUtf32() const;
+	bool ValidUtf() const;
+	template<class Container> bool DecodeBase64(Container& bytes) const;
+	template<class Container> bool DecodeHex(Container& bytes) const;
+	constexpr StringBase& ToUpper();
+	constexpr StringBase& ToLower();
+	constexpr StringBase& ToCapital();
+
+	constexpr I32 Compare(const StringViewBase<C>& other) const;
+	constexpr bool EqualsIgnoreCase(const StringViewBase<C>& other) const;
+	constexpr I64 IndexOfIgnoreCase(const StringViewBase<C>& find, U64 start = 0) const;
+
+	friend constexpr bool operator==(const StringBase& a, const StringBase& b) { return EqualStrings(a.string, a.size, b.string, b.size); }
+	friend constexpr bool operator==(const StringBase& a, const StringViewBase<C>& b) { return EqualStrings(a.string, a.size, b.Data(), b.Size()); }
+	friend constexpr bool operator==(const StringBase& a, const C* b) { return a == StringViewBase<C>(b); }
+	friend constexpr std::strong_ordering operator<=>(const StringBase& a, const StringBase& b) { return CompareStrings(a.string, a.size, b.string, b.size) <=> 0; }
+	friend constexpr std::strong_ordering operator<=>(const StringBase& a, const StringViewBase<C>& b) { return CompareStrings(a.string, a.size, b.Data(), b.Size()) <=> 0; }
+	friend constexpr std::strong_ordering operator<=>(const StringBase& a, const C* b) { return a <=> StringViewBase<C>(b); }
+
+	constexpr const U64& Size() const;
+	constexpr const U64& Capacity() const;
+
+	constexpr C* Data();
+	constexpr const C* Data() const;
+	constexpr operator C* ();
+	constexpr operator const C* () const;
+
+	constexpr C* begin();
+	constexpr C* end();
+	constexpr const C* begin() const;
+	constexpr const C* end() const;
+
+	constexpr C* rbegin();
+	constexpr C* rend();
+	constexpr const C* rbegin() const;
+	constexpr const C* rend() const;
+
+private:
+	constexpr void Allocate(U64 length);
+	constexpr void Reallocate(U64 length);
+	static constexpr C* AllocateConstant(U64 capacity);
+	constexpr U64 Length(const C* str) const;
+	constexpr bool Aliases(const StringViewBase<C>& other) const;
+	template<class Arg> bool AliasesArgument(const Arg& arg) const;
+	static constexpr bool Blank(C c);
+	static constexpr bool NotBlank(C c);
+
+	U64 size{ 0 };
+	U64 capacity{ 0 };
+	C* string{ nullptr };
+
+	friend struct StringViewBase<C>;
+	friend struct SharedStringBase<C>;
+};
+
+template<Character C>
+constexpr inline StringBase<C>::StringBase() {}
+
+template<Character C>
+constexpr inline StringBase<C>::StringBase(NullPointer) {}
+
+template<Character C>
+constexpr inline StringBase<C>::StringBase(U64 length) : size{ length }
+{
+	Allocate(size);
+}
+
+template<Character C>
+constexpr inline StringBase<C>::StringBase(const C* other) : size{ Length(other) }
+{
+	Allocate(size);
+	Copy(string, other, size);
+	string[size] = '\0';
+}
+
+template<Character C>
+constexpr inline StringBase<C>::StringBase(const C* other, U64 length) : size{ length }
+{
+	Allocate(size);
+	Copy(string, other, size);
+	string[size] = '\0';
+}
+
+template<Character C>
+constexpr inline StringBase<C>::StringBase(const StringBase& other) : size{ other.size }
+{
+	Allocate(size);
+	Copy(string, other.string, size + 1);
+}
+
+template<Character C>
+constexpr inline StringBase<C>::StringBase(const StringViewBase<C>& other) : size{ other.Size() }
+{
+	Allocate(size);
+	Copy(string, other.Data(), size);
+	string[size] = '\0';
+}
+
+template<Character C>
+constexpr inline StringBase<C>::StringBase(StringBase&& other) noexcept : size{ other.size }, capacity{ other.capacity }, string{ other.string }
+{
+	other.size = 0;
+	other.capacity = 0;
+	other.string = nullptr;
+}
+
+template<Character C>
+constexpr inline StringBase<C>& StringBase<C>::operator=(NullPointer)
+{
+	Destroy();
+
+	return *this;
+}
+
+template<Character C>
+constexpr inline StringBase<C>& StringBase<C>::operator=(const C* other)
+{
+	size = Length(other);
+
+	Reallocate(size);
+	Copy(string, other, size);
+	string[size] = '\0';
+
+	return *this;
+}
+
+template<Character C>
+constexpr inline StringBase<C>& StringBase<C>::operator=(const StringBase& other)
+{
+	if (&other == this) { return *this; }
+
+	size = other.size;
+
+	Reallocate(size);
+	Copy(string, other.string, size + 1);
+
+	return *this;
+}
+
+template<Character C>
+constexpr inline StringBase<C>& StringBase<C>::operator=(const StringViewBase<C>& other)
+{
+	if (Aliases(other)) { return *this = StringBase<C>(other); }
+
+	size = other.Size();
+
+	Reallocate(size + 1);
+	Copy(string, other.Data(), size);
+	string[size] = '\0';
+
+	return *this;
+}
+
+template<Character C>
+constexpr inline StringBase<C>& StringBase<C>::operator=(StringBase&& other) noexcept
+{
+	if (&other == this) { return *this; }
+
+	Destroy();
+
+	size = other.size;
+	capacity = other.capacity;
+	string = other.string;
+
+	other.size = 0;
+	other.capacity = 0;
+	other.string = nullptr;
+
+	return *this;
+}
+
+template<Character C>
+constexpr inline StringBase<C>::~StringBase()
+{
+	Destroy();
+}
+
+template<Character C>
+constexpr inline void StringBase<C>::Destroy()
+{
+	if (string)
+	{
+		if (std::is_constant_evaluated()) { std::allocator<C>{}.deallocate(string, capacity); }
+		else { free(string); }
+
+		size = 0;
+		capacity = 0;
+		string = nullptr;
+	}
+}
+
+template<Character C>
+constexpr inline void StringBase<C>::Clear()
+{
+	string[0] = '\0';
+	size = 0;
+}
+
+template<Character C>
+constexpr inline void StringBase<C>::Resize()
+{
+	size = Length(string);
+}
+
+template<Character C>
+constexpr inline void StringBase<C>::Reserve(U64 capacity)
+{
+	Reallocate(capacity);
+}
+
+template<Character C>
+constexpr inline StringViewBase<C> StringBase<C>::SubString(U64 start, U64 length) const
+{
+	return StringViewBase<C>(*this).SubString(start, length);
+}
+
+template<Character C>
+constexpr inline StringBase<C> StringBase<C>::Appended(const StringViewBase<C>& append) const
+{
+	StringBase<C> str(size + append.Size());
+	Copy(str.Data(), string, size);
+	Copy(str.Data() + size, append.Data(), append.Size());
+	str.Data()[str.Size()] = '\0';
+
+	return std::move(str);
+}
+
+template<Character C>
+constexpr inline StringBase<C> StringBase<C>::Prepended(const StringViewBase<C>& prepend) const
+{
+	StringBase<C> str(size + prepend.Size());
+	Copy(str.Data(), prepend.Data(), prepend.Size());
+	Copy(str.Data() + prepend.Size(), string, size);
+	str.Data()[str.Size()] = '\0';
+
+	return std::move(str);
+}
+
+template<Character C>
+constexpr inline StringBase<C> StringBase<C>::Surrounded(const StringViewBase<C>& prepend, const StringViewBase<C>& append) const
+{
+	StringBase<C> str(size + prepend.Size() + append.Size());
+	Copy(str.Data(), prepend.Data(), prepend.Size());
+	Copy(str.Data() + prepend.Size(), string, size);
+	Copy(str.Data() + prepend.Size() + size, append.Data(), append.Size());
+	str.Data()[str.Size()] = '\0';
+
+	return std::move(str);
+}
+
+template<Character C>
+constexpr inline StringBase<C>& StringBase<C>::Shave(U64 start, U64 length)
+{
+	if (length != U64_MAX)
+	{
+		Copy(string, string + start, length);
+		size = length;
+		string[length] = '\0';
+		return *this;
+	}
+	else
+	{
+		Copy(string, string + start, size - start + 1);
+		size -= start + 1;
+		return *this;
+	}
+}
+
+template<Character C>
+constexpr inline StringBase<C>& StringBase<C>::Append(const StringViewBase<C>& append)
+{
+	if (Aliases(append)) { return Append(StringBase<C>(append)); }
+
+	if (size + append.Size() >= capacity) { Reallocate(size + append.Size() + 1); }
+
+	Copy(string + size, append.Data(), append.Size());
+	size += append.Size();
+	string[size] = '\0';
+
+	return *this;
+}
+
+template<Character C>
+constexpr inline StringBase<C>& StringBase<C>::Prepend(const StringViewBase<C>& prepend)
+{
+	if (Aliases(prepend)) { return Prepend(StringBase<C>(prepend)); }
+
+	if (size + prepend.Size() >= capacity) { Reallocate(size + prepend.Size() + 1); }
+
+	Copy(string + prepend.Size(), string, size);
+	Copy(string, prepend.Data(), prepend.Size());
+	size += prepend.Size();
+	string[size] = '\0';
+
+	return *this;
+}
+
+template<Character C>
+constexpr inline StringBase<C>& StringBase<C>::Surround(const StringViewBase<C>& prepend, const StringViewBase<C>& append)
+{
+	if (Aliases(prepend) || Aliases(append)) { return Surround(StringBase<C>(prepend), StringBase<C>(append)); }
+
+	if (size + prepend.Size() + append.Size() >= capacity) { Reallocate(size + prepend.Size() + append.Size() + 1); }
+
+	Copy(string + prepend.Size(), string, size);
+	Copy(string, prepend.Data(), prepend.Size());
+	Copy(string + prepend.Size() + size, append.Data(), append.Size());
+	size += prepend.Size() + append.Size();
+	string[size] = '\0';
+
+	return *this;
+}
+
+template<Character C>
+constexpr inline StringBase<C>& StringBase<C>::Insert(U64 index, const StringViewBase<C>& insert)
+{
+	if (Aliases(insert)) { return Insert(index, StringBase<C>(insert)); }
+
+	if (index > size) { index = size; }
+	if (size + insert.Size() >= capacity) { Reallocate(size + insert.Size() + 1); }
+
+	Copy(string + index + insert.Size(), string + index, size - index);
+	Copy(string + index, insert.Data(), insert.Size());
+	size += insert.Size();
+	string[size] = '\0';
+
+	return *this;
+}
+
+template<Character C>
+constexpr inline StringBase<C>& StringBase<C>::Erase(U64 start, U64 length)
+{
+	if (start >= size) { return *this; }
+	if (length > size - start) { length = size - start; }
+
+	Copy(string + start, string + start + length, size - start - length);
+	size -= length;
+	string[size] = '\0';
+
+	return *this;
+}
+
+template<Character C>
+template<class... Args>
+inline StringBase<C> StringBase<C>::Format(const StringViewBase<C>& format, const Args&... args)
+{
+	StringBase<C> str;
+	str.AppendFormat(format, args...);
+
+	return std::move(str);
+}
+
+template<Character C>
+template<class... Args>
+inline StringBase<C>& StringBase<C>::AppendFormat(const StringViewBase<C>& format, const Args&... args)
+{
+	if (Aliases(format) || (AliasesArgument(args) || ...)) { return Append(Format(format, args...)); }
+
+	U64 bound = format.Size() + (FormatBound<C>(args) + ... + 0);
+	if (size + bound >= capacity) { Reallocate(size + bound + 1); }
+
+	C* it = string + size;
+	const C* f = format.Data();
+	const C* end = f + format.Size();
+
+	([&] { if (FormatLiteral(it, f, end)) { it = FormatValue(it, args); } }(), ...);
+
+	//Placeholders without an argument are kept as is
+	while (FormatLiteral(it, f, end)) { *it++ = '{'; *it++ = '}'; }
+
+	size = it - string;
+	string[size] = '\0';
+
+	return *this;
+}
+
+template<Character C>
+inline StringBase<C> StringBase<C>::EncodeBase64(const void* data, U64 size)
+{
+	StringBase<C> str;
+	str.AppendBase64(data, size);
+
+	return std::move(str);
+}
+
+template<Character C>
+inline StringBase<C> StringBase<C>::EncodeHex(const void* data, U64 size)
+{
+	StringBase<C> str;
+	str.AppendHex(data, size);
+
+	return std::move(str);
+}
+
+template<Character C>
+inline StringBase<C>& StringBase<C>::AppendBase64(const void* data, U64 size)
+{
+	if (string && data >= string && data < string + capacity) { return Append(EncodeBase64(data, size)); }
+
+	U64 length = (size + 2) / 3 * 4;
+	if (this->size + length >= capacity) { Reallocate(this->size + length + 1); }
+
+	EncodeBase64Write(string + this->size, (const U8*)data, size);
+	this->size += length;
+	string[this->size] = '\0';
+
+	return *this;
+}
+
+template<Character C>
+inline StringBase<C>& StringBase<C>::AppendHex(const void* data, U64 size)
+{
+	if (string && data >= string && data < string + capacity) { return Append(EncodeHex(data, size)); }
+
+	U64 length = size * 2;
+	if (this->size + length >= capacity) { Reallocate(this->size + length + 1); }
+
+	EncodeHexWrite(string + this->size, (const U8*)data, size);
+	this->size += length;
+	string[this->size] = '\0';
+
+	return *this;
+}
+
+template<Character C>
+constexpr inline bool StringBase<C>::Blank() const
+{
+	return StringViewBase<C>(*this).Blank();
+}
+
+template<Character C>
+constexpr inline I64 StringBase<C>::IndexOf(C ch, U64 start) const
+{
+	return StringViewBase<C>(*this).IndexOf(ch, start);
+}
+
+template<Character C>
+constexpr inline I64 StringBase<C>::LastIndexOf(C ch, U64 start) const
+{
+	return StringViewBase<C>(*this).LastIndexOf(ch, start);
+}
+
+template<Character C>
+constexpr inline I64 StringBase<C>::IndexOf(const StringViewBase<C>& find, U64 start) const
+{
+	return StringViewBase<C>(*this).IndexOf(find, start);
+}
+
+template<Character C>
+constexpr inline bool StringBase<C>::Contains(const StringViewBase<C>& find) const
+{
+	return StringViewBase<C>(*this).Contains(find);
+}
+
+template<Character C>
+constexpr inline U64 StringBase<C>::CountOccurrences(const StringViewBase<C>& find) const
+{
+	return StringViewBase<C>(*this).CountOccurrences(find);
+}
+
+template<Character C>
+constexpr inline StringBase<C>& StringBase<C>::ReplaceAll(const StringViewBase<C>& find, const StringViewBase<C>& replace)
+{
+	if (Aliases(find) || Aliases(replace)) { return ReplaceAll(StringBase<C>(find), StringBase<C>(replace)); }
+
+	U64 count = CountOccurrences(find);
+
+	if (count == 0) { return *this; }
+
+	const C* it = string;
+	const C* end = string + size;
+	U64 newSize = size - count * find.Size() + count * replace.Size();
+	I64 index;
+
+	if (replace.Size() <= find.Size())
+	{
+		C* write = string;
+
+		while ((index = Search(it, end - it, find.Data(), find.Size())) != -1)
+		{
+			Copy(write, it, index);
+			write += index;
+			Copy(write, replace.Data(), replace.Size());
+			write += replace.Size();
+			it += index + find.Size();
+		}
+
+		Copy(write, it, end - it);
+		size = newSize;
+		string[size] = '\0';
+	}
+	else
+	{
+		StringBase<C> str;
+		str.Reserve(newSize + 1);
+		C* write = str.string;
+
+		while ((index = Search(it, end - it, find.Data(), find.Size())) != -1)
+		{
+			Copy(write, it, index);
+			write += index;
+			Copy(write, replace.Data(), replace.Size());
+			write += replace.Size();
+			it += index + find.Size();
+		}
+
+		Copy(write, it, end - it);
+		str.size = newSize;
+		str.string[newSize] = '\0';
+
+		*this = std::move(str);
+	}
+
+	return *this;
+}
+
+template<Character C>
+constexpr inline StringViewBase<C> StringBase<C>::Trimmed() const
+{
+	return StringViewBase<C>(*this).Trim();
+}
+
+template<Character C>
+constexpr inline StringBase<C>& StringBase<C>::Trim()
+{
+	StringViewBase<C> trimmed = Trimmed();
+
+	size = trimmed.Size();
+
+	if (string)
+	{
+		Copy(string, trimmed.Data(), size);
+		string[size] = '\0';
+	}
+
+	return *this;
+}
+
+template<Character C>
+inline U64 StringBase<C>::ParseI64(I64& value) const
+{
+	return StringViewBase<C>(*this).ParseI64(value);
+}
+
+template<Character C>
+inline U64 StringBase<C>::ParseU64(U64& value) const
+{
+	return StringViewBase<C>(*this).ParseU64(value);
+}
+
+template<Character C>
+inline U64 StringBase<C>::ParseF64(F64& value) const
+{
+	return StringViewBase<C>(*this).ParseF64(value);
+}
+
+template<Character C>
+inline U64 StringBase<C>::ParseHexI64(I64& value) const
+{
+	return StringViewBase<C>(*this).ParseHexI64(value);
+}
+
+template<Character C>
+inline U64 StringBase<C>::ParseHexU64(U64& value) const
+{
+	return StringViewBase<C>(*this).ParseHexU64(value);
+}
+
+template<Character C>
+template<Character To>
+inline StringBase<To> StringBase<C>::Transcode() const
+{
+	return StringViewBase<C>(*this).template Transcode<To>();
+}
+
+template<Character C>
+inline StringBase<char8_t> StringBase<C>::ToUtf8() const
+{
+	return StringViewBase<C>(*this).ToUtf8();
+}
+
+template<Character C>
+inline StringBase<char16_t> StringBase<C>::ToUtf16() const
+{
+	return StringViewBase<C>(*this).ToUtf16();
+}
+
+template<Character C>
+inline StringBase<char32_t> StringBase<C>::ToUtf32() const
+{
+	return StringViewBase<C>(*this).ToUtf32();
+}
+
+template<Character C>
+inline bool StringBase<C>::ValidUtf() const
+{
+	return StringViewBase<C>(*this).ValidUtf();
+}
+
+template<Character C>
+template<class Container>
+inline bool StringBase<C>::DecodeBase64(Container& bytes) const
+{
+	return StringViewBase<C>(*this).DecodeBase64(bytes);
+}
+
+template<Character C>
+template<class Container>
+inline bool StringBase<C>::DecodeHex(Container& bytes) const
+{
+	return StringViewBase<C>(*this).DecodeHex(bytes);
+}
+
+template<Character C>
+inline SplitRange<C> StringBase<C>::Split(C delimiter) const
+{
+	return StringViewBase<C>(*this).Split(delimiter);
+}
+
+template<Character C>
+inline SplitRange<C> StringBase<C>::Split(const StringViewBase<C>& delimiters) const
+{
+	return StringViewBase<C>(*this).Split(delimiters);
+}
+
+template<Character C>
+inline SplitRange<C> StringBase<C>::SplitLines() const
+{
+	return StringViewBase<C>(*this).SplitLines();
+}
+
+template<Character C>
+inline SplitRange<C> StringBase<C>::Tokenize(const StringViewBase<C>& delimiters) const
+{
+	return StringViewBase<C>(*this).Tokenize(delimiters);
+}
+
+template<Character C>
+template<class Container>
+inline U64 StringBase<C>::SplitInto(Container& fields, C delimiter) const
+{
+	return StringViewBase<C>(*this).SplitInto(fields, delimiter);
+}
+
+template<Character C>
+template<class Container>
+inline U64 StringBase<C>::SplitInto(Container& fields, const StringViewBase<C>& delimiters) const
+{
+	return StringViewBase<C>(*this).SplitInto(fields, delimiters);
+}
+
+template<Character C>
+constexpr inline StringBase<C>& StringBase<C>::ToUpper()
+{
+	CaseConvert(string, string + size, (C)'a');
+
+	return *this;
+}
+
+template<Character C>
+constexpr inline StringBase<C>& StringBase<C>::ToLower()
+{
+	CaseConvert(string, string + size, (C)'A');
+
+	return *this;
+}
+
+template<Character C>
+constexpr inline StringBase<C>& StringBase<C>::ToCapital()
+{
+	CaseConvert(string, string + size, (C)'A');
+	if (size) { string[0] = CaseUpper(string[0]); }
+
+	return *this;
+}
+
+template<Character C>
+constexpr inline I32 StringBase<C>::Compare(const StringViewBase<C>& other) const
+{
+	return StringViewBase<C>(*this).Compare(other);
+}
+
+template<Character C>
+constexpr inline bool StringBase<C>::EqualsIgnoreCase(const StringViewBase<C>& other) const
+{
+	return StringViewBase<C>(*this).EqualsIgnoreCase(other);
+}
+
+template<Character C>
+constexpr inline I64 StringBase<C>::IndexOfIgnoreCase(const StringViewBase<C>& find, U64 start) const
+{
+	return StringViewBase<C>(*this).IndexOfIgnoreCase(find, start);
+}
+
+template<Character C>
+constexpr inline const U64& StringBase<C>::Size() const
+{
+	return size;
+}
+
+template<Character C>
+constexpr inline const U64& StringBase<C>::Capacity() const
+{
+	return capacity;
+}
+
+template<Character C>
+constexpr inline C* StringBase<C>::Data()
+{
+	return string;
+}
+
+template<Character C>
+constexpr inline const C* StringBase<C>::Data() const
+{
+	return string;
+}
+
+template<Character C>
+constexpr inline StringBase<C>::operator C* ()
+{
+	return string;
+}
+
+template<Character C>
+constexpr inline StringBase<C>::operator const C* () const
+{
+	return string;
+}
+
+template<Character C>
+constexpr inline C* StringBase<C>::begin()
+{
+	return string;
+}
+
+template<Character C>
+constexpr inline C* StringBase<C>::end()
+{
+	return string + size;
+}
+
+template<Character C>
+constexpr inline const C* StringBase<C>::begin() const
+{
+	return string;
+}
+
+template<Character C>
+constexpr inline const C* StringBase<C>::end() const
+{
+	return string + size;
+}
+
+template<Character C>
+constexpr inline C* StringBase<C>::rbegin()
+{
+	return string + size - 1;
+}
+
+template<Character C>
+constexpr inline C* StringBase<C>::rend()
+{
+	return string - 1;
+}
+
+template<Character C>
+constexpr inline const C* StringBase<C>::rbegin() const
+{
+	return string + size - 1;
+}
+
+template<Character C>
+constexpr inline const C* StringBase<C>::rend() const
+{
+	return string - 1;
+}
+
+
+
+//Helpers
+template<Character C>
+constexpr inline void StringBase<C>::Allocate(U64 length)
+{
+	constexpr U64 size = sizeof(C);
+
+	capacity = length < 1024 ? 1024 : std::bit_ceil(length + 1);
+
+	if (std::is_constant_evaluated()) { string = AllocateConstant(capacity); }
+	else { string = (C*)malloc(capacity * size); }
+}
+
+template<Character C>
+constexpr inline void StringBase<C>::Reallocate(U64 length)
+{
+	constexpr U64 size = sizeof(C);
+
+	if (length <= capacity) { return; }
+
+	U64 previous = capacity;
+	capacity = length < 1024 ? 1024 : std::bit_ceil(length);
+
+	if (std::is_constant_evaluated())
+	{
+		C* block = AllocateConstant(capacity);
+
+		if (string)
+		{
+			Copy(block, string, previous);
+			std::allocator<C>{}.deallocate(string, previous);
+		}
+
+		string = block;
+	}
+	else if (string) { string = (C*)realloc(string, capacity * size); }
+	else { string = (C*)malloc(capacity * size); }
+}
+
+template<Character C>
+constexpr inline C* StringBase<C>::AllocateConstant(U64 capacity)
+{
+	C* block = std::allocator<C>{}.allocate(capacity);
+	for (U64 i = 0; i < capacity; ++i) { std::construct_at(block + i); }
+
+	return block;
+}
+
+template<Character C>
+constexpr inline U64 StringBase<C>::Length(const C* str) const
+{
+	const C* it = str;
+	while (*it) { ++it; }
+
+	return it - str;
+}
+
+template<Character C>
+constexpr inline bool StringBase<C>::Aliases(const StringViewBase<C>& other) const
+{
+	if (std::is_constant_evaluated())
+	{
+		//Pointers into different allocations can't be ordered during constant evaluation, a view of this string can only start within it
+		for (U64 i = 0; string && i <= size; ++i) { if (other.Data() == string + i) { return true; } }
+		return false;
+	}
+
+	return string && other.Data() >= string && other.Data() < string + capacity;
+}
+
+template<Character C>
+template<class Arg>
+inline bool StringBase<C>::AliasesArgument(const Arg& arg) const
+{
+	using Type = std::decay_t<Arg>;
+
+	if constexpr (std::is_same_v<Type, const C*> || std::is_same_v<Type, C*>) { return string && arg >= string && arg < string + capacity; }
+	else if constexpr (std::is_same_v<Type, StringBase<C>> || std::is_same_v<Type, StringViewBase<C>>) { return Aliases(arg); }
+	else { return false; }
+}
+
+template<Character C>
+constexpr inline bool StringBase<C>::Blank(C c)
+{
+	if constexpr (std::is_same_v<C, char>)
+	{
+		return c == '\n' || c == '\r' || c == '\t' || c == '\v' || c == '\f' || c == ' ';
+	}
+	else if constexpr (std::is_same_v<C, char8_t>)
+	{
+		return c == u8'\n' || c == u8'\r' || c == u8'\t' || c == u8'\v' || c == u8'\f' || c == u8' ';
+	}
+	else if constexpr (std::is_same_v<C, char16_t>)
+	{
+		return c == u'\n' || c == u'\r' || c == u'\t' || c == u'\v' || c == u'\f' || c == u' ';
+	}
+	else if constexpr (std::is_same_v<C, char32_t>)
+	{
+		return c == U'\n' || c == U'\r' || c == U'\t' || c == U'\v' || c == U'\f' || c == U' ';
+	}
+	else if constexpr (std::is_same_v<C, wchar_t>)
+	{
+		return c == L'\n' || c == L'\r' || c == L'\t' || c == L'\v' || c == L'\f' || c == L' ';
+	}
+}
+
+template<Character C>
+constexpr inline bool StringBase<C>::NotBlank(C c)
+{
+	if constexpr (std::is_same_v<C, char>)
+	{
+		return c != '\n' && c != '\r' && c != '\t' && c != '\v' && c != '\f' && c != ' ';
+	}
+	else if constexpr (std::is_same_v<C, char8_t>)
+	{
+		return c != u8'\n' && c != u8'\r' && c != u8'\t' && c != u8'\v' && c != u8'\f' && c != u8' ';
+	}
+	else if constexpr (std::is_same_v<C, char16_t>)
+	{
+		return c != u'\n' && c != u'\r' && c != u'\t' && c != u'\v' && c != u'\f' && c != u' ';
+	}
+	else if constexpr (std::is_same_v<C, char32_t>)
+	{
+		return c != U'\n' && c != U'\r' && c != U'\t' && c != U'\v' && c != U'\f' && c != U' ';
+	}
+	else if constexpr (std::is_same_v<C, wchar_t>)
+	{
+		return c != L'\n' && c != L'\r' && c != L'\t' && c != L'\v' && c != L'\f' && c != L' ';
+	}
+}
+
+
+
+template<Character C>
+struct StringViewBase
+{
+	constexpr StringViewBase() {}
+	constexpr StringViewBase(NullPointer) {}
+	constexpr StringViewBase(const C* other) : size{ Length(other) }, string{ other } {}
+	constexpr StringViewBase(const C* other, U64 length) : size{ length }, string{ other } {}
+	constexpr StringViewBase(const StringBase<C>& other);
+
+	constexpr StringViewBase SubString(U64 start, U64 length = U64_MAX) const;
+
+	constexpr bool Blank() const;
+	constexpr I64 IndexOf(C c, U64 start = 0) const;
+	constexpr I64 LastIndexOf(C c, U64 start = 0) const;
+	constexpr I64 IndexOf(const StringViewBase& find, U64 start = 0) const;
+	constexpr bool Contains(const StringViewBase& find) const;
+	constexpr U64 CountOccurrences(const StringViewBase& find) const;
+
+	constexpr StringViewBase Trimmed() const;
+	constexpr StringViewBase& Trim();
+
+	/// <summary>
+	/// Lazily splits on delimiter, fields are views into this view and empty fields between adjacent delimiters are kept
+	/// </summary>
+	SplitRange<C> Split(C delimiter) const;
+
+	/// <summary>
+	/// Lazily splits on any character in delimiters, fields are views into this view and empty fields are kept
+	/// </summary>
+	SplitRange<C> Split(const StringViewBase& delimiters) const;
+
+	/// <summary>
+	/// Lazily splits on '\n', a trailing '\r' is dropped from each line and a final newline doesn't produce an empty line
+	/// </summary>
+	SplitRange<C> SplitLines() const;
+
+	/// <summary>
+	/// Lazily splits on runs of the characters in delimiters, empty tokens are skipped
+	/// </summary>
+	SplitRange<C> Tokenize(const StringViewBase& delimiters) const;
+
+	/// <summary>
+	/// Pushes every field of Split(delimiter) onto fields, a Vector of StringViewBase or any container with Push
+	/// </summary>
+	/// <returns>The amount of fields pushed</returns>
+	template<class Container> U64 SplitInto(Container& fields, C delimiter) const;
+	template<class Container> U64 SplitInto(Container& fields, const StringViewBase& delimiters) const;
+
+	/// <summary>
+	/// Orders by characters as unsigned code units, a prefix comes before the longer string
+	/// </summary>
+	/// <returns>Negative if this view comes first, 0 if equal, positive if other comes first</returns>
+	constexpr I32 Compare(const StringViewBase& other) const;
+
+	/// <returns>True if this view and other are equal when ASCII letters are compared without case</returns>
+	constexpr bool EqualsIgnoreCase(const StringViewBase& other) const;
+
+	/// <summary>
+	/// Finds the first occurrence of find at or after start, ASCII letters match without case and nothing is copied
+	/// </summary>
+	/// <returns>The index of the occurrence, -1 if there is none</returns>
+	constexpr I64 IndexOfIgnoreCase(const StringViewBase& find, U64 start = 0) const;
+
+	friend constexpr bool operator==(const StringViewBase& a, const StringViewBase& b) { return EqualStrings(a.string, a.size, b.string, b.size); }
+	friend constexpr bool operator==(const StringViewBase& a, const C* b) { return a == StringViewBase(b); }
+	friend constexpr std::strong_ordering operator<=>(const StringViewBase& a, const StringViewBase& b) { return CompareStrings(a.string, a.size, b.string, b.size) <=> 0; }
+	friend constexpr std::strong_ordering operator<=>(const StringViewBase& a, const C* b) { return a <=> StringViewBase(b); }
+
+	/// <summary>
+	/// Parses a decimal integer with an optional sign from the start of the view
+	/// </summary>
+	/// <returns>The amount of characters consumed, 0 if there is no number or it doesn't fit, value is left untouched then</returns>
+	U64 ParseI64(I64& value) const;
+
+	/// <summary>
+	/// Parses a decimal integer with an optional '+' from the start of the view
+	/// </summary>
+	/// <returns>The amount of characters consumed, 0 if there is no number or it doesn't fit, value is left untouched then</returns>
+	U64 ParseU64(U64& value) const;
+
+	/// <summary>
+	/// Parses a decimal floating point number, "inf", "infinity" or "nan" from the start of the view, correctly rounded
+	/// </summary>
+	/// <returns>The amount of characters consumed, 0 if there is no number, value is left untouched then</returns>
+	U64 ParseF64(F64& value) const;
+
+	/// <summary>
+	/// Parses a hexadecimal integer with an optional sign and "0x" prefix from the start of the view
+	/// </summary>
+	/// <returns>The amount of characters consumed, 0 if there is no number or it doesn't fit, value is left untouched then</returns>
+	U64 ParseHexI64(I64& value) const;
+
+	/// <summary>
+	/// Parses a hexadecimal integer with an optional "0x" prefix from the start of the view
+	/// </summary>
+	/// <returns>The amount of characters consumed, 0 if there is no number or it doesn't fit, value is left untouched then</returns>
+	U64 ParseHexU64(U64& value) const;
+
+	/// <summary>
+	/// Converts to the encoding of To, char and char8_t are UTF-8, char16_t is UTF-16, char32_t is UTF-32 and wchar_t follows its width
+	/// The output length is counted exactly first so the result is allocated once
+	/// </summary>
+	/// <returns>The transcoded string, empty if this view isn't well formed</returns>
+	template<Character To> StringBase<To> Transcode() const;
+	StringBase<char8_t> ToUtf8() const { return Transcode<char8_t>(); }
+	StringBase<char16_t> ToUtf16() const { return Transcode<char16_t>(); }
+	StringBase<char32_t> ToUtf32() const { return Transcode<char32_t>(); }
+
+	/// <returns>True if this view is well formed UTF-8, UTF-16 or UTF-32, depending on the width of C</returns>
+	bool ValidUtf() const;
+
+	/// <summary>
+	/// Decodes canonical padded Base64 into bytes, a container of bytes with Resize and Data, resized once to the decoded size
+	/// </summary>
+	/// <returns>True if this view is valid Base64, on failure bytes is emptied</returns>
+	template<class Container> bool DecodeBase64(Container& bytes) const;
+
+	/// <summary>
+	/// Decodes hex digits of either case into bytes, a container of bytes with Resize and Data, resized once to the decoded size
+	/// </summary>
+	/// <returns>True if this view is valid hex, on failure bytes is emptied</returns>
+	template<class Container> bool DecodeHex(Container& bytes) const;
+
+	constexpr const U64& Size() const { return size; }
+	constexpr const C* Data() const { return string; }
+	constexpr const C& operator[](U64 i) const { return string[i]; }
+
+	constexpr const C* begin() const { return string; }
+	constexpr const C* end() const { return string + size; }
+	constexpr const C* rbegin() const { return string + size - 1; }
+	constexpr const C* rend() const { return string - 1; }
+
+private:
+	static constexpr U64 Length(const C* str);
+
+	U64 size{ 0 };
+	const C* string{ nullptr };
+};
+
+template<Character C>
+constexpr inline StringViewBase<C>::StringViewBase(const StringBase<C>& other) : size{ other.size }, string{ other.string } {}
+
+template<Character C>
+constexpr inline StringViewBase<C> StringViewBase<C>::SubString(U64 start, U64 length) const
+{
+	if (start > size) { start = size; }
+	if (length > size - start) { length = size - start; }
+
+	return { string + start, length };
+}
+
+template<Character C>
+constexpr inline bool StringViewBase<C>::Blank() const
+{
+	for (const C* it = string, *end = string + size; it != end; ++it)
+	{
+		if (StringBase<C>::NotBlank(*it)) { return false; }
+	}
+
+	return true;
 }
 
 template<Character C>
-inline StringBase<C>& StringBase<C>::operator=(const C* other)
+constexpr inline I64 StringViewBase<C>::IndexOf(C ch, U64 start) const
 {
-	size = Length(other);
+	if (start >= size) { return -1; }
 
-	Reallocate(size);
-	Copy(string, other, size);
-	string[size] = '\0';
+	const C* it = SearchChar<C>(string + start, string + size, ch);
 
-	return *this;
+	if (it) { return it - string; }
+
+	return -1;
 }
 
 template<Character C>
-inline StringBase<C>& StringBase<C>::operator=(const StringBase& other)
+constexpr inline I64 StringViewBase<C>::LastIndexOf(C ch, U64 start) const
 {
-	if (&other == this) { return *this; }
-
-	size = other.size;
+	if (start >= size) { return -1; }
 
-	Reallocate(size);
-	Copy(string, other.string, size + 1);
+	for (U64 i = size - start; i--;)
+	{
+		if (string[i] == ch) { return i; }
+	}
 
-	return *this;
+	return -1;
 }
 
 template<Character C>
-inline StringBase<C>& StringBase<C>::operator=(StringBase&& other) noexcept
+constexpr inline I64 StringViewBase<C>::IndexOf(const StringViewBase<C>& find, U64 start) const
 {
-	if (&other == this) { return *this; }
-
-	Destroy();
+	if (start > size) { return -1; }
 
-	size = other.size;
-	capacity = other.capacity;
-	string = other.string;
+	I64 index = Search(string + start, size - start, find.string, find.size);
 
-	other.size = 0;
-	other.capacity = 0;
-	other.string = nullptr;
+	if (index != -1) { return index + start; }
 
-	return *this;
+	return -1;
 }
 
 template<Character C>
-inline StringBase<C>::~StringBase()
+constexpr inline bool StringViewBase<C>::Contains(const StringViewBase<C>& find) const
 {
-	Destroy();
+	return Search(string, size, find.string, find.size) != -1;
 }
 
 template<Character C>
-inline void StringBase<C>::Destroy()
+constexpr inline U64 StringViewBase<C>::CountOccurrences(const StringViewBase<C>& find) const
 {
-	if (string)
+	if (find.size == 0) { return 0; }
+
+	U64 count = 0;
+	const C* it = string;
+	const C* end = string + size;
+	I64 index;
+
+	while ((index = Search(it, end - it, find.string, find.size)) != -1)
 	{
-		size = 0;
-		capacity = 0;
-		free(string);
-		string = nullptr;
+		++count;
+		it += index + find.size;
 	}
-}
 
-template<Character C>
-inline void StringBase<C>::Clear()
-{
-	string[0] = '\0';
-	size = 0;
+	return count;
 }
 
 template<Character C>
-inline void StringBase<C>::Resize()
+inline U64 StringViewBase<C>::ParseI64(I64& value) const
 {
-	size = Length(string);
+	const C* it = string;
+	const C* end = string + size;
+
+	bool negative = it != end && *it == '-';
+	if (it != end && (*it == '-' || *it == '+')) { ++it; }
+
+	const C* digits = it;
+	U64 magnitude = 0;
+	if (!ParseDigits(it, end, magnitude) || it == digits) { return 0; }
+	if (magnitude > (U64)I64_MAX + negative) { return 0; }
+
+	value = negative ? (I64)(0ULL - magnitude) : (I64)magnitude;
+	return it - string;
 }
 
 template<Character C>
-inline void StringBase<C>::Reserve(U64 capacity)
+inline U64 StringViewBase<C>::ParseU64(U64& value) const
 {
-	Reallocate(capacity);
+	const C* it = string;
+	const C* end = string + size;
+
+	if (it != end && *it == '+') { ++it; }
+
+	const C* digits = it;
+	U64 result = 0;
+	if (!ParseDigits(it, end, result) || it == digits) { return 0; }
+
+	value = result;
+	return it - string;
 }
 
 template<Character C>
-inline StringBase<C> StringBase<C>::SubString(U64 start, U64 length) const
+inline U64 StringViewBase<C>::ParseF64(F64& value) const
 {
-	if (length != U64_MAX)
+	const C* it = string;
+	const C* end = string + size;
+
+	bool negative = it != end && *it == '-';
+	if (it != end && (*it == '-' || *it == '+')) { ++it; }
+
+	const C* number = it;
+
+	auto match = [&](const char* word) {
+		const C* c = it;
+		for (; *word; ++word, ++c) { if (c == end || (U32)(*c | 0x20) != (U8)*word) { return false; } }
+		it = c;
+		return true;
+	};
+
+	if (match("inf"))
 	{
-		StringBase<C> str(string + start, length);
-		str.string[length] = '\0';
-		return std::move(str);
+		match("inity");
+		value = negative ? -std::numeric_limits<F64>::infinity() : std::numeric_limits<F64>::infinity();
+		return it - string;
 	}
-	else
+
+	if (match("nan"))
 	{
-		StringBase<C> str(string + start, size - start);
-		return std::move(str);
+		value = negative ? -std::numeric_limits<F64>::quiet_NaN() : std::numeric_limits<F64>::quiet_NaN();
+		return it - string;
 	}
-}
 
-template<Character C>
-inline StringBase<C> StringBase<C>::Appended(const StringBase<C>& append) const
-{
-	StringBase<C> str(size + append.Size());
-	Copy(str.Data(), string, size);
-	Copy(str.Data() + size, append.Data(), append.Size());
-	str.Data()[str.Size()] = '\0';
+	//Up to nineteen significant digits are kept exactly, more send the number to the slow path
+	U64 mantissa = 0;
+	I64 exponent = 0;
+	U64 significant = 0;
+	bool anyDigits = false;
 
-	return std::move(str);
-}
+	for (; it != end && *it >= '0' && *it <= '9'; ++it)
+	{
+		anyDigits = true;
+		if (significant == 0 && *it == '0') { continue; }
+		if (significant < 19) { mantissa = mantissa * 10 + (*it - '0'); }
+		else { ++exponent; }
+		++significant;
+	}
 
-template<Character C>
-inline StringBase<C> StringBase<C>::Prepended(const StringBase<C>& prepend) const
-{
-	StringBase<C> str(size + prepend.Size());
-	Copy(str.Data(), prepend.Data(), prepend.Size());
-	Copy(str.Data() + prepend.Size(), string, size);
-	str.Data()[str.Size()] = '\0';
+	if (it != end && *it == '.')
+	{
+		const C* fraction = ++it;
 
-	return std::move(str);
-}
+		for (; it != end && *it >= '0' && *it <= '9'; ++it)
+		{
+			if (significant == 0 && *it == '0') { --exponent; continue; }
+			if (significant < 19) { mantissa = mantissa * 10 + (*it - '0'); --exponent; }
+			++significant;
+		}
 
-template<Character C>
-inline StringBase<C> StringBase<C>::Surrounded(const StringBase<C>& prepend, const StringBase<C>& append) const
-{
-	StringBase<C> str(size + prepend.Size() + append.Size());
-	Copy(str.Data(), prepend.Data(), prepend.Size());
-	Copy(str.Data() + prepend.Size(), string, size);
-	Copy(str.Data() + prepend.Size() + size, append.Data(), append.Size());
-	str.Data()[str.Size()] = '\0';
+		anyDigits |= it != fraction;
+	}
 
-	return std::move(str);
-}
+	if (!anyDigits) { return 0; }
 
-template<Character C>
-inline StringBase<C>& StringBase<C>::Shave(U64 start, U64 length)
-{
-	if (length != U64_MAX)
+	if (it != end && (*it | 0x20) == 'e')
 	{
-		Copy(string, string + start, length);
-		size = length;
-		string[length] = '\0';
-		return *this;
+		const C* e = it + 1;
+		bool negativeExponent = e != end && *e == '-';
+		if (e != end && (*e == '-' || *e == '+')) { ++e; }
+
+		if (e != end && *e >= '0' && *e <= '9')
+		{
+			I64 explicitExponent = 0;
+			for (; e != end && *e >= '0' && *e <= '9'; ++e)
+			{
+				if (explicitExponent < 100000) { explicitExponent = explicitExponent * 10 + (*e - '0'); }
+			}
+
+			exponent += negativeExponent ? -explicitExponent : explicitExponent;
+			it = e;
+		}
 	}
-	else
+
+	//Clinger's fast path, the mantissa and the power of ten are both exact doubles so a single rounding is correct
+	if (significant <= 19 && mantissa <= (1ULL << 53))
 	{
-		Copy(string, string + start, size - start + 1);
-		size -= start + 1;
-		return *this;
+		F64 result = -1.0;
+
+		if (mantissa == 0) { result = 0.0; }
+		else if (exponent >= 0 && exponent <= 22) { result = (F64)mantissa * PARSE_POWERS[exponent]; }
+		else if (exponent < 0 && exponent >= -22) { result = (F64)mantissa / PARSE_POWERS[-exponent]; }
+		else if (exponent > 22 && exponent <= 22 + 15)
+		{
+			U64 scaled = mantissa;
+			for (I64 i = 22; i < exponent && scaled <= (1ULL << 53); ++i) { scaled *= 10; }
+			if (scaled <= (1ULL << 53)) { result = (F64)scaled * PARSE_POWERS[22]; }
+		}
+
+		if (result >= 0.0)
+		{
+			value = negative ? -result : result;
+			return it - string;
+		}
 	}
-}
 
-template<Character C>
-inline StringBase<C>& StringBase<C>::Append(const StringBase<C>& append)
-{
-	if (size + append.Size() >= capacity) { Reallocate(size + append.Size() + 1); }
+	//Eisel-Lemire, past nineteen digits the truncated mantissa and its successor bracket the value, agreeing means either is exact
+	F64 result = 0.0;
 
-	Copy(string + size, append.Data(), append.Size());
-	size += append.Size();
-	string[size] = '\0';
+	if (ParseEiselLemire(mantissa, exponent, result))
+	{
+		F64 upper = 0.0;
 
-	return *this;
-}
+		if (significant <= 19 || (ParseEiselLemire(mantissa + 1, exponent, upper) && upper == result))
+		{
+			value = negative ? -result : result;
+			return it - string;
+		}
+	}
 
-template<Character C>
-inline StringBase<C>& StringBase<C>::Prepend(const StringBase<C>& prepend)
-{
-	if (size + prepend.Size() >= capacity) { Reallocate(size + prepend.Size() + 1); }
+	//Correctly rounded fallback over the characters already validated above, only reached by ambiguous products
+	U64 length = it - number;
+	result = 0.0;
 
-	Copy(string + prepend.Size(), string, size);
-	Copy(string, prepend.Data(), prepend.Size());
-	size += prepend.Size();
-	string[size] = '\0';
+	std::errc error;
 
-	return *this;
-}
+	if constexpr (sizeof(C) == 1) { error = std::from_chars((const char*)number, (const char*)it, result).ec; }
+	else
+	{
+		//Zeroed so every byte from_chars may read is visibly written, this path only runs for ambiguous inputs
+		char stack[128]{};
+		char* buffer = length > sizeof(stack) ? (char*)malloc(length) : stack;
+		for (U64 i = 0; i < length; ++i) { buffer[i] = (char)number[i]; }
 
-template<Character C>
-inline StringBase<C>& StringBase<C>::Surround(const StringBase<C>& prepend, const StringBase<C>& append)
-{
-	if (size + prepend.Size() + append.Size() >= capacity) { Reallocate(size + prepend.Size() + append.Size() + 1); }
+		error = std::from_chars(buffer, buffer + length, result).ec;
 
-	Copy(string + prepend.Size(), string, size);
-	Copy(string, prepend.Data(), prepend.Size());
-	Copy(string + prepend.Size() + size, append.Data(), append.Size());
-	size += prepend.Size() + append.Size();
-	string[size] = '\0';
+		if (buffer != stack) { free(buffer); }
+	}
 
-	return *this;
+	//Out of range, the decimal point position tells overflow from underflow
+	if (error == std::errc::result_out_of_range) { result = exponent + (I64)significant > 0 ? std::numeric_limits<F64>::infinity() : 0.0; }
+
+	value = negative ? -result : result;
+	return it - string;
 }
 
 template<Character C>
-inline bool StringBase<C>::Blank() const
+inline U64 StringViewBase<C>::ParseHexI64(I64& value) const
 {
-	if (!string) { return true; }
+	const C* it = string;
 
-	C* it = string;
-	C c = '\0';
+	bool negative = size && *it == '-';
+	if (size && (*it == '-' || *it == '+')) { ++it; }
 
-	while ((c = *it++) != '\0') { if (NotBlank(c)) { return false; } }
+	U64 magnitude = 0;
+	U64 consumed = StringViewBase<C>(it, size - (it - string)).ParseHexU64(magnitude);
+	if (!consumed || magnitude > (U64)I64_MAX + negative) { return 0; }
 
-	return true;
+	value = negative ? (I64)(0ULL - magnitude) : (I64)magnitude;
+	return consumed + (it - string);
 }
 
 template<Character C>
-inline I64 StringBase<C>::IndexOf(C ch, U64 start) const
+inline U64 StringViewBase<C>::ParseHexU64(U64& value) const
 {
-	if (start >= size) { return -1; }
+	const C* it = string;
+	const C* end = string + size;
 
-	C* it = string + start;
-	C* end = string + size;
-	C c = '\0';
+	if (end - it > 2 && it[0] == '0' && (it[1] | 0x20) == 'x' && ParseHexDigit(it[2]) < 16) { it += 2; }
 
-	while ((c = *it) != ch && it != end) { ++it; }
+	const C* digits = it;
+	U64 result = 0;
 
-	if (c == ch) { return it - string; }
+	for (U64 digit; it != end && (digit = ParseHexDigit(*it)) < 16; ++it)
+	{
+		if (result >> 60) { return 0; }
+		result = (result << 4) | digit;
+	}
 
-	return -1;
+	if (it == digits) { return 0; }
+
+	value = result;
+	return it - string;
 }
 
 template<Character C>
-inline I64 StringBase<C>::LastIndexOf(C ch, U64 start) const
+template<Character To>
+inline StringBase<To> StringViewBase<C>::Transcode() const
 {
-	if (start >= size) { return -1; }
-
-	C* it = string + size - start - 2;
-	C c = '\0';
-
-	while ((c = *it) != ch && it != string) { --it; }
+	U64 length = TranscodeLength<To>(string, string + size);
+	if (length == U64_MAX || length == 0) { return {}; }
 
-	if (c == ch) { return it - string; }
+	StringBase<To> str(length);
+	TranscodeWrite(str.Data(), string, string + size);
+	str.Data()[length] = '\0';
 
-	return -1;
+	return std::move(str);
 }
 
 template<Character C>
-inline const U64& StringBase<C>::Size() const
+inline bool StringViewBase<C>::ValidUtf() const
 {
-	return size;
+	return TranscodeLength<C>(string, string + size) != U64_MAX;
 }
 
 template<Character C>
-inline const U64& StringBase<C>::Capacity() const
+template<class Container>
+inline bool StringViewBase<C>::DecodeBase64(Container& bytes) const
 {
-	return capacity;
+	U64 length = DecodeBase64Length(string, size);
+
+	if (length == U64_MAX) { bytes.Resize(0); return false; }
+
+	bytes.Resize(length);
+	if (!DecodeBase64Write((U8*)bytes.Data(), string, size)) { bytes.Resize(0); return false; }
+
+	return true;
 }
 
 template<Character C>
-inline C* StringBase<C>::Data()
+template<class Container>
+inline bool StringViewBase<C>::DecodeHex(Container& bytes) const
 {
-	return string;
+	if (size % 2) { bytes.Resize(0); return false; }
+
+	bytes.Resize(size / 2);
+	if (!DecodeHexWrite((U8*)bytes.Data(), string, size)) { bytes.Resize(0); return false; }
+
+	return true;
 }
 
 template<Character C>
-inline const C* StringBase<C>::Data() const
+inline SplitRange<C> StringViewBase<C>::Split(C delimiter) const
 {
-	return string;
+	return SplitRange<C>(*this, nullptr, delimiter, SplitRange<C>::Mode::Split);
 }
 
 template<Character C>
-inline StringBase<C>::operator C* ()
+inline SplitRange<C> StringViewBase<C>::Split(const StringViewBase& delimiters) const
 {
-	return string;
+	return SplitRange<C>(*this, delimiters, 0, SplitRange<C>::Mode::Split);
 }
 
 template<Character C>
-inline StringBase<C>::operator const C* () const
+inline SplitRange<C> StringViewBase<C>::SplitLines() const
 {
-	return string;
+	return SplitRange<C>(*this, nullptr, '\n', SplitRange<C>::Mode::Lines);
 }
 
 template<Character C>
-inline C* StringBase<C>::begin()
+inline SplitRange<C> StringViewBase<C>::Tokenize(const StringViewBase& delimiters) const
 {
-	return string;
+	return SplitRange<C>(*this, delimiters, 0, SplitRange<C>::Mode::Tokenize);
 }
 
 template<Character C>
-inline C* StringBase<C>::end()
+template<class Container>
+inline U64 StringViewBase<C>::SplitInto(Container& fields, C delimiter) const
 {
-	return string + size;
+	const C* it = string;
+	const C* end = string + size;
+	U64 count = 1;
+
+	for (const C* hit; (hit = SearchChar(it, end, delimiter)); it = hit + 1, ++count) { fields.Push(StringViewBase(it, hit - it)); }
+	fields.Push(StringViewBase(it, end - it));
+
+	return count;
 }
 
 template<Character C>
-inline const C* StringBase<C>::begin() const
+template<class Container>
+inline U64 StringViewBase<C>::SplitInto(Container& fields, const StringViewBase& delimiters) const
 {
-	return string;
+	const C* it = string;
+	const C* end = string + size;
+	U64 count = 1;
+
+	for (const C* hit; (hit = SearchAny(it, end, delimiters.Data(), delimiters.Size())); it = hit + 1, ++count) { fields.Push(StringViewBase(it, hit - it)); }
+	fields.Push(StringViewBase(it, end - it));
+
+	return count;
 }
 
 template<Character C>
-inline const C* StringBase<C>::end() const
+constexpr inline I32 StringViewBase<C>::Compare(const StringViewBase& other) const
 {
-	return string + size;
+	return CompareStrings(string, size, other.string, other.size);
 }
 
 template<Character C>
-inline C* StringBase<C>::rbegin()
+constexpr inline bool StringViewBase<C>::EqualsIgnoreCase(const StringViewBase& other) const
 {
-	return string + size - 1;
+	return size == other.size && CompareMismatch<true>(string, other.string, size) == size;
 }
 
 template<Character C>
-inline C* StringBase<C>::rend()
+constexpr inline I64 StringViewBase<C>::IndexOfIgnoreCase(const StringViewBase& find, U64 start) const
 {
-	return string - 1;
+	constexpr U64 lanes = SEARCH_BLOCK / sizeof(C);
+
+	if (start > size || find.size > size - start) { return -1; }
+	if (find.size == 0) { return start; }
+
+	const C first = CaseLower(find.string[0]);
+	const C* rest = find.string + 1;
+	const U64 restSize = find.size - 1;
+	const U64 last = size - find.size;
+	U64 i = start;
+
+	//Candidates come from a folded first character compare, only those are checked in full
+	if (!std::is_constant_evaluated())
+	{
+		for (; i + lanes <= last + 1; i += lanes)
+		{
+			U32 mask = SearchCompareIgnoreCase(string + i, first);
+
+			while (mask)
+			{
+				U64 index = i + std::countr_zero(mask) / sizeof(C);
+				if (CompareMismatch<true>(string + index + 1, rest, restSize) == restSize) { return index; }
+				mask &= mask - 1;
+			}
+		}
+	}
+
+	for (; i <= last; ++i)
+	{
+		if (CaseLower(string[i]) == first && CompareMismatch<true>(string + i + 1, rest, restSize) == restSize) { return i; }
+	}
+
+	return -1;
 }
 
 template<Character C>
-inline const C* StringBase<C>::rbegin() const
+constexpr inline StringViewBase<C> StringViewBase<C>::Trimmed() const
 {
-	return string + size - 1;
+	StringViewBase<C> view = *this;
+	return view.Trim();
 }
 
 template<Character C>
-inline const C* StringBase<C>::rend() const
+constexpr inline StringViewBase<C>& StringViewBase<C>::Trim()
 {
-	return string - 1;
-}
+	const C* start = string;
+	const C* end = string + size;
 
+	while (start != end && StringBase<C>::Blank(*start)) { ++start; }
+	while (end != start && StringBase<C>::Blank(end[-1])) { --end; }
 
+	string = start;
+	size = end - start;
+
+	return *this;
+}
 
-//Helpers
 template<Character C>
-inline void StringBase<C>::Allocate(U64 length)
+constexpr inline U64 StringViewBase<C>::Length(const C* str)
 {
-	constexpr U64 size = sizeof(C);
+	if (!str) { return 0; }
 
-	capacity = length < 1024 ? 1024 : std::bit_ceil(length);
+	const C* it = str;
+	while (*it) { ++it; }
 
-	string = (C*)malloc(capacity * size);
+	return it - str;
 }
 
+/// <summary>
+/// Lazy range over the fields of a StringViewBase made by Split, SplitLines and Tokenize, no field is copied or allocated
+/// </summary>
 template<Character C>
-inline void StringBase<C>::Reallocate(U64 length)
+struct SplitRange
 {
-	constexpr U64 size = sizeof(C);
+	enum class Mode : U8
+	{
+		Split,
+		Lines,
+		Tokenize
+	};
 
-	if (length <= capacity) { return; }
+	struct Iterator
+	{
+		const StringViewBase<C>& operator*() const { return field; }
+		const StringViewBase<C>* operator->() const { return &field; }
 
-	capacity = length < 1024 ? 1024 : std::bit_ceil(length);
+		Iterator& operator++() { Advance(); return *this; }
+		Iterator operator++(int) { Iterator copy = *this; Advance(); return copy; }
 
-	if (string) { string = (C*)realloc(string, capacity * size); }
-	else { string = (C*)malloc(capacity * size); }
+		bool operator==(const Iterator& other) const { return done == other.done && (done || rest == other.rest); }
+		bool operator!=(const Iterator& other) const { return !(*this == other); }
+
+	private:
+		void Advance();
+		bool Delimiter(C c) const;
+
+		StringViewBase<C> field;
+		const C* rest{ nullptr };
+		const C* end{ nullptr };
+		StringViewBase<C> delimiters;
+		C delimiter{ 0 };
+		Mode mode{ Mode::Split };
+		bool done{ true };
+
+		friend struct SplitRange;
+	};
+
+	SplitRange(const StringViewBase<C>& string, const StringViewBase<C>& delimiters, C delimiter, Mode mode);
+
+	Iterator begin() const;
+	Iterator end() const { return {}; }
+
+private:
+	static constexpr C EMPTY = 0;	//Gives a null view somewhere to point so it still yields its one empty field
+
+	Iterator first;
+};
+
+template<Character C>
+inline SplitRange<C>::SplitRange(const StringViewBase<C>& string, const StringViewBase<C>& delimiters, C delimiter, Mode mode)
+{
+	first.rest = string.Data() ? string.Data() : &EMPTY;
+	first.end = first.rest + string.Size();
+	first.delimiters = delimiters;
+	first.delimiter = delimiter;
+	first.mode = mode;
 }
 
 template<Character C>
-constexpr inline U64 StringBase<C>::Length(const C* str) const
+inline typename SplitRange<C>::Iterator SplitRange<C>::begin() const
 {
-	const C* it = str;
-	while (*it) { ++it; }
+	Iterator it = first;
+	it.Advance();
 
-	return it - str;
+	return it;
 }
 
 template<Character C>
-inline bool StringBase<C>::Blank(C c) const
+inline void SplitRange<C>::Iterator::Advance()
 {
-	if constexpr (std::is_same_v<C, char>)
-	{
-		return c == '\n' || c == '\r' || c == '\t' || c == '\v' || c == '\f' || c == ' ';
-	}
-	else if constexpr (std::is_same_v<C, char8_t>)
-	{
-		return c == u8'\n' || c == u8'\r' || c == u8'\t' || c == u8'\v' || c == u8'\f' || c == u8' ';
-	}
-	else if constexpr (std::is_same_v<C, char16_t>)
-	{
-		return c == u'\n' || c == u'\r' || c == u'\t' || c == u'\v' || c == u'\f' || c == u' ';
-	}
-	else if constexpr (std::is_same_v<C, char32_t>)
-	{
-		return c == U'\n' || c == U'\r' || c == U'\t' || c == U'\v' || c == U'\f' || c == U' ';
-	}
-	else if constexpr (std::is_same_v<C, wchar_t>)
-	{
-		return c == L'\n' || c == L'\r' || c == L'\t' || c == L'\v' || c == L'\f' || c == L' ';
-	}
+	if (!rest) { done = true; return; }
+
+	if (mode == Mode::Tokenize) { while (rest != end && Delimiter(*rest)) { ++rest; } }
+	if (mode != Mode::Split && rest == end) { rest = nullptr; done = true; return; }
+
+	const C* hit = delimiters.Size() ? SearchAny(rest, end, delimiters.Data(), delimiters.Size()) : SearchChar(rest, end, delimiter);
+	U64 size = (hit ? hit : end) - rest;
+
+	if (mode == Mode::Lines && size && rest[size - 1] == '\r') { --size; }
+
+	field = { rest, size };
+	rest = hit ? hit + 1 : nullptr;
+	done = false;
 }
 
 template<Character C>
-inline bool StringBase<C>::NotBlank(C c) const
+inline bool SplitRange<C>::Iterator::Delimiter(C c) const
 {
-	if constexpr (std::is_same_v<C, char>)
-	{
-		return c != '\n' && c != '\r' && c != '\t' && c != '\v' && c != '\f' && c != ' ';
-	}
-	else if constexpr (std::is_same_v<C, char8_t>)
-	{
-		return c != u8'\n' && c != u8'\r' && c != u8'\t' && c != u8'\v' && c != u8'\f' && c != u8' ';
-	}
-	else if constexpr (std::is_same_v<C, char16_t>)
-	{
-		return c != u'\n' && c != u'\r' && c != u'\t' && c != u'\v' && c != u'\f' && c != u' ';
-	}
-	else if constexpr (std::is_same_v<C, char32_t>)
-	{
-		return c != U'\n' && c != U'\r' && c != U'\t' && c != U'\v' && c != U'\f' && c != U' ';
-	}
-	else if constexpr (std::is_same_v<C, wchar_t>)
-	{
-		return c != L'\n' && c != L'\r' && c != L'\t' && c != L'\v' && c != L'\f' && c != L' ';
-	}
-}
\ No newline at end of file
+	if (!delimiters.Size()) { return c == delimiter; }
+
+	for (C d : delimiters) { if (c == d) { return true; } }
+
+	return false;
+}
@@ -0,0 +1,303 @@
+#pragma once
+
+#include "String.hpp"
+#include "Hash.hpp"
+
+#include <mutex>
+#include <shared_mutex>
+
+/// <summary>
+/// Handle to a string interned in a StringPoolBase, two atoms from the same pool are equal only if their strings are equal
+/// </summary>
+struct Atom
+{
+	U32 id{ U32_MAX };
+
+	bool Valid() const { return id != U32_MAX; }
+
+	friend bool operator== (Atom a, Atom b) { return a.id == b.id; }
+	friend bool operator!= (Atom a, Atom b) { return a.id != b.id; }
+	friend bool operator< (Atom a, Atom b) { return a.id < b.id; }
+};
+
+/// <summary>
+/// Interns strings into arena blocks and hands out 32-bit Atoms, each unique string is stored once with its hash
+/// ThreadSafe guards lookups with a shared lock and insertions with an exclusive lock
+/// </summary>
+template<Character C, bool ThreadSafe = false>
+struct StringPoolBase
+{
+	StringPoolBase();
+	StringPoolBase(const StringPoolBase&) = delete;
+	StringPoolBase(StringPoolBase&&) = delete;
+	StringPoolBase& operator=(const StringPoolBase&) = delete;
+	StringPoolBase& operator=(StringPoolBase&&) = delete;
+
+	~StringPoolBase();
+	void Destroy();
+
+	/// <summary>
+	/// Adds string to the pool if it isn't already in it
+	/// </summary>
+	/// <returns>The atom for string</returns>
+	Atom Intern(const StringViewBase<C>& string);
+
+	/// <summary>
+	/// Looks up string without adding it
+	/// </summary>
+	/// <returns>The atom for string, an invalid atom if string was never interned</returns>
+	Atom Find(const StringViewBase<C>& string) const;
+
+	/// <returns>The interned string, valid until the pool is destroyed, an empty view for an invalid atom</returns>
+	StringViewBase<C> View(Atom atom) const;
+
+	/// <returns>The NUL terminated interned string, valid until the pool is destroyed, nullptr for an invalid atom</returns>
+	const C* Data(Atom atom) const;
+
+	/// <returns>The hash computed when atom was interned, 0 for an invalid atom</returns>
+	U64 Hash(Atom atom) const;
+
+	/// <returns>The amount of unique strings in the pool</returns>
+	U32 Size() const;
+
+private:
+	struct Entry
+	{
+		const C* string;
+		U64 size;
+		U64 hash;
+	};
+
+	struct Block
+	{
+		Block* next;
+		U64 used;
+		U64 capacity;
+	};
+
+	struct NoLock
+	{
+		void lock() {}
+		void unlock() {}
+		void lock_shared() {}
+		void unlock_shared() {}
+	};
+
+	using Lock = std::conditional_t<ThreadSafe, std::shared_mutex, NoLock>;
+
+	static constexpr U64 BLOCK_SIZE = 16384;	//Characters per arena block
+
+	static U64 HashString(const C* string, U64 size);
+	U32 Lookup(const C* string, U64 size, U64 hash) const;
+	const C* Store(const C* string, U64 size);
+	void Rehash(U64 capacity);
+
+	Entry* entries{ nullptr };
+	U32 size{ 0 };
+	U32 entryCapacity{ 0 };
+
+	U32* table{ nullptr };
+	U64 tableCapacity{ 0 };
+
+	Block* blocks{ nullptr };
+
+	mutable Lock lock;
+};
+
+using StringPool = StringPoolBase<char>;
+using StringPool8 = StringPoolBase<char8_t>;
+using StringPool16 = StringPoolBase<char16_t>;
+using StringPool32 = StringPoolBase<char32_t>;
+using StringPoolW = StringPoolBase<wchar_t>;
+
+template<Character C, bool ThreadSafe>
+inline StringPoolBase<C, ThreadSafe>::StringPoolBase() {}
+
+template<Character C, bool ThreadSafe>
+inline StringPoolBase<C, ThreadSafe>::~StringPoolBase()
+{
+	Destroy();
+}
+
+template<Character C, bool ThreadSafe>
+inline void StringPoolBase<C, ThreadSafe>::Destroy()
+{
+	std::unique_lock<Lock> guard(lock);
+
+	while (blocks)
+	{
+		Block* next = blocks->next;
+		free(blocks);
+		blocks = next;
+	}
+
+	if (entries) { free(entries); entries = nullptr; }
+	if (table) { free(table); table = nullptr; }
+
+	size = 0;
+	entryCapacity = 0;
+	tableCapacity = 0;
+}
+
+template<Character C, bool ThreadSafe>
+inline Atom StringPoolBase<C, ThreadSafe>::Intern(const StringViewBase<C>& string)
+{
+	U64 hash = HashString(string.Data(), string.Size());
+
+	if constexpr (ThreadSafe)
+	{
+		std::shared_lock<Lock> guard(lock);
+		U32 id = Lookup(string.Data(), string.Size(), hash);
+		if (id != U32_MAX) { return { id }; }
+	}
+
+	std::unique_lock<Lock> guard(lock);
+
+	U32 id = Lookup(string.Data(), string.Size(), hash);
+	if (id != U32_MAX) { return { id }; }
+
+	if (size == entryCapacity)
+	{
+		entryCapacity = entryCapacity ? entryCapacity * 2 : 256;
+		entries = (Entry*)realloc(entries, entryCapacity * sizeof(Entry));
+	}
+
+	if ((size + 1) * 2 > tableCapacity) { Rehash(tableCapacity ? tableCapacity * 2 : 512); }
+
+	id = size++;
+	entries[id] = { Store(string.Data(), string.Size()), string.Size(), hash };
+
+	U64 mask = tableCapacity - 1;
+	U64 slot = hash & mask;
+	while (table[slot] != U32_MAX) { slot = (slot + 1) & mask; }
+	table[slot] = id;
+
+	return { id };
+}
+
+template<Character C, bool ThreadSafe>
+inline Atom StringPoolBase<C, ThreadSafe>::Find(const StringViewBase<C>& string) const
+{
+	U64 hash = HashString(string.Data(), string.Size());
+
+	std::shared_lock<Lock> guard(lock);
+
+	return { Lookup(string.Data(), string.Size(), hash) };
+}
+
+template<Character C, bool ThreadSafe>
+inline StringViewBase<C> StringPoolBase<C, ThreadSafe>::View(Atom atom) const
+{
+	std::shared_lock<Lock> guard(lock);
+
+	if (atom.id >= size) { return {}; }
+
+	const Entry& entry = entries[atom.id];
+	return { entry.string, entry.size };
+}
+
+template<Character C, bool ThreadSafe>
+inline const C* StringPoolBase<C, ThreadSafe>::Data(Atom atom) const
+{
+	std::shared_lock<Lock> guard(lock);
+
+	return atom.id < size ? entries[atom.id].string : nullptr;
+}
+
+template<Character C, bool ThreadSafe>
+inline U64 StringPoolBase<C, ThreadSafe>::Hash(Atom atom) const
+{
+	std::shared_lock<Lock> guard(lock);
+
+	return atom.id < size ? entries[atom.id].hash : 0;
+}
+
+template<Character C, bool ThreadSafe>
+inline U32 StringPoolBase<C, ThreadSafe>::Size() const
+{
+	std::shared_lock<Lock> guard(lock);
+
+	return size;
+}
+
+
+
+//Helpers
+template<Character C, bool ThreadSafe>
+inline U64 StringPoolBase<C, ThreadSafe>::HashString(const C* string, U64 size)
+{
+	return ::Hash(StringViewBase<C>(string, size));
+}
+
+template<Character C, bool ThreadSafe>
+inline U32 StringPoolBase<C, ThreadSafe>::Lookup(const C* string, U64 size, U64 hash) const
+{
+	if (!tableCapacity) { return U32_MAX; }
+
+	U64 mask = tableCapacity - 1;
+
+	for (U64 slot = hash & mask; table[slot] != U32_MAX; slot = (slot + 1) & mask)
+	{
+		const Entry& entry = entries[table[slot]];
+
+		if (entry.hash == hash && entry.size == size && memcmp(entry.string, string, size * sizeof(C)) == 0) { return table[slot]; }
+	}
+
+	return U32_MAX;
+}
+
+template<Character C, bool ThreadSafe>
+inline const C* StringPoolBase<C, ThreadSafe>::Store(const C* string, U64 size)
+{
+	if (size + 1 > BLOCK_SIZE)
+	{
+		//Oversized strings get a block of their own behind the current one, so its free space is still used
+		Block* block = (Block*)malloc(sizeof(Block) + (size + 1) * sizeof(C));
+		block->used = size + 1;
+		block->capacity = size + 1;
+
+		if (blocks) { block->next = blocks->next; blocks->next = block; }
+		else { block->next = nullptr; blocks = block; }
+
+		C* data = (C*)(block + 1);
+		Copy(data, string, size);
+		data[size] = '\0';
+
+		return data;
+	}
+
+	if (!blocks || blocks->capacity - blocks->used < size + 1)
+	{
+		Block* block = (Block*)malloc(sizeof(Block) + BLOCK_SIZE * sizeof(C));
+		block->next = blocks;
+		block->used = 0;
+		block->capacity = BLOCK_SIZE;
+		blocks = block;
+	}
+
+	C* data = (C*)(blocks + 1) + blocks->used;
+	Copy(data, string, size);
+	data[size] = '\0';
+	blocks->used += size + 1;
+
+	return data;
+}
+
+template<Character C, bool ThreadSafe>
+inline void StringPoolBase<C, ThreadSafe>::Rehash(U64 capacity)
+{
+	if (table) { free(table); }
+
+	tableCapacity = capacity;
+	table = (U32*)malloc(tableCapacity * sizeof(U32));
+	memset(table, 0xFF, tableCapacity * sizeof(U32));
+
+	U64 mask = tableCapacity - 1;
+
+	for (U32 id = 0; id < size; ++id)
+	{
+		U64 slot = entries[id].hash & mask;
+		while (table[slot] != U32_MAX) { slot = (slot + 1) & mask; }
+		table[slot] = id;
+	}
+}
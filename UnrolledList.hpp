@@ -0,0 +1,484 @@
+#pragma once
+
+#include "ContainerDefines.hpp"
+#include "NodePool.hpp"
+
+#include <new>
+#include <utility>
+#include <type_traits>
+#include <initializer_list>
+
+/// <summary>
+/// Doubly linked list of chunks holding up to N values each, traversal reads whole chunks instead of one node per value
+/// A full chunk splits in half on insert and a chunk that falls below three quarters together with its neighbour is merged into it on remove
+/// </summary>
+template<typename T, U64 N = 16>
+struct UnrolledList
+{
+	static_assert(N >= 2, "Chunks must hold at least two values");
+
+	struct Chunk
+	{
+		T* Values() { return (T*)storage; }
+		const T* Values() const { return (const T*)storage; }
+
+		Chunk* next;
+		Chunk* prev;
+		U64 count;
+		alignas(T) U8 storage[N * sizeof(T)];
+	};
+
+	struct Iterator
+	{
+	public:
+		Iterator(Chunk* chunk, U64 index) : chunk{ chunk }, index{ index } {}
+
+		T& operator* () const { return chunk->Values()[index]; }
+		T* operator-> () { return chunk->Values() + index; }
+
+		Iterator& operator++ ()
+		{
+			if (++index == chunk->count) { chunk = chunk->next; index = 0; }
+			return *this;
+		}
+
+		Iterator& operator-- ()
+		{
+			if (index == 0) { chunk = chunk->prev; index = chunk->count - 1; }
+			else { --index; }
+			return *this;
+		}
+
+		Iterator operator++ (int)
+		{
+			Iterator temp = *this;
+			++*this;
+			return temp;
+		}
+
+		Iterator operator-- (int)
+		{
+			Iterator temp = *this;
+			--*this;
+			return temp;
+		}
+
+		Iterator& operator+= (int i)
+		{
+			for (int j = 0; j < i; ++j) { ++*this; }
+			return *this;
+		}
+
+		Iterator& operator-= (int i)
+		{
+			for (int j = 0; j < i; ++j) { --*this; }
+			return *this;
+		}
+
+		Iterator operator+ (int i)
+		{
+			Iterator it = *this;
+			return it += i;
+		}
+
+		Iterator operator- (int i)
+		{
+			Iterator it = *this;
+			return it -= i;
+		}
+
+		friend bool operator== (const Iterator& a, const Iterator& b) { return a.chunk == b.chunk && a.index == b.index; }
+		friend bool operator!= (const Iterator& a, const Iterator& b) { return a.chunk != b.chunk || a.index != b.index; }
+
+		operator bool() { return chunk; }
+
+	private:
+		Chunk* chunk;
+		U64 index;
+
+		friend struct UnrolledList;
+	};
+
+public:
+	UnrolledList();
+	UnrolledList(std::initializer_list<T> list);
+	UnrolledList(const UnrolledList& other);
+	UnrolledList(UnrolledList&& other);
+	UnrolledList& operator=(const UnrolledList& other);
+	UnrolledList& operator=(UnrolledList&& other);
+
+	~UnrolledList();
+
+	/// <summary>
+	/// Destroys every value and releases all chunks at once
+	/// </summary>
+	void Destroy();
+
+	void PushBack(const T& value);
+	void PushBack(T&& value);
+	void PopBack();
+	void PushFront(const T& value);
+	void PushFront(T&& value);
+	void PopFront();
+	void Insert(U64 index, const T& value);
+	void Insert(U64 index, T&& value);
+
+	/// <summary>
+	/// Inserts value after position, position keeps referring to the same value even if its chunk was split
+	/// </summary>
+	void InsertBack(Iterator& position, const T& value);
+	void InsertBack(Iterator& position, T&& value);
+
+	/// <summary>
+	/// Inserts value before position, position keeps referring to the same value even if its chunk was split
+	/// </summary>
+	void InsertFront(Iterator& position, const T& value);
+	void InsertFront(Iterator& position, T&& value);
+	void Remove(U64 index);
+
+	/// <summary>
+	/// Removes the value at position, position is moved to the value after it
+	/// </summary>
+	void Remove(Iterator& position);
+	void RemoveAll(const T& value);
+	template<typename Predicate> U64 RemoveIf(Predicate predicate);
+
+	Iterator begin() { return { head, 0 }; }
+	Iterator end() { return { nullptr, 0 }; }
+	Iterator begin() const { return { head, 0 }; }
+	Iterator end() const { return { nullptr, 0 }; }
+
+	U64 Size() const { return size; }
+	T& Front() { return head->Values()[0]; }
+	const T& Front() const { return head->Values()[0]; }
+	T& Back() { return tail->Values()[tail->count - 1]; }
+	const T& Back() const { return tail->Values()[tail->count - 1]; }
+
+private:
+	U64 size;
+	Chunk* head;
+	Chunk* tail;
+	NodePool<Chunk> pool;
+
+	template<typename Value> inline Iterator InsertAt(Chunk* chunk, U64 index, Value&& value);
+	inline Iterator RemoveAt(Chunk* chunk, U64 index);
+	inline Chunk* CreateChunk(Chunk* prev);
+	inline void EraseChunk(Chunk* chunk);
+	static inline void Relocate(T* dst, T* src, U64 count);
+};
+
+template<typename T, U64 N> inline UnrolledList<T, N>::UnrolledList() : size{ 0 }, head{ nullptr }, tail{ nullptr } {}
+
+template<typename T, U64 N> inline UnrolledList<T, N>::UnrolledList(std::initializer_list<T> list) : size{ 0 }, head{ nullptr }, tail{ nullptr }
+{
+	for (const T& value : list) { PushBack(value); }
+}
+
+template<typename T, U64 N> inline UnrolledList<T, N>::UnrolledList(const UnrolledList<T, N>& other) : size{ 0 }, head{ nullptr }, tail{ nullptr }
+{
+	for (const T& value : other) { PushBack(value); }
+}
+
+template<typename T, U64 N> inline UnrolledList<T, N>::UnrolledList(UnrolledList<T, N>&& other) : size{ other.size }, head{ other.head }, tail{ other.tail }, pool{ std::move(other.pool) }
+{
+	other.head = nullptr;
+	other.tail = nullptr;
+	other.size = 0;
+}
+
+template<typename T, U64 N> inline UnrolledList<T, N>& UnrolledList<T, N>::operator=(const UnrolledList<T, N>& other)
+{
+	if (&other == this) { return *this; }
+
+	Destroy();
+
+	for (const T& value : other) { PushBack(value); }
+
+	return *this;
+}
+
+template<typename T, U64 N> inline UnrolledList<T, N>& UnrolledList<T, N>::operator=(UnrolledList<T, N>&& other)
+{
+	if (&other == this) { return *this; }
+
+	Destroy();
+
+	head = other.head;
+	tail = other.tail;
+	size = other.size;
+	pool = std::move(other.pool);
+
+	other.head = nullptr;
+	other.tail = nullptr;
+	other.size = 0;
+
+	return *this;
+}
+
+template<typename T, U64 N> inline UnrolledList<T, N>::~UnrolledList()
+{
+	Destroy();
+}
+
+template<typename T, U64 N> inline void UnrolledList<T, N>::Destroy()
+{
+	if constexpr (!std::is_trivially_destructible_v<T>)
+	{
+		for (Chunk* chunk = head; chunk; chunk = chunk->next)
+		{
+			for (T* it = chunk->Values(), *end = it + chunk->count; it != end; ++it) { it->~T(); }
+		}
+	}
+
+	pool.Destroy();
+
+	head = nullptr;
+	tail = nullptr;
+	size = 0;
+}
+
+template<typename T, U64 N> inline void UnrolledList<T, N>::PushBack(const T& value)
+{
+	if (!tail || tail->count == N) { CreateChunk(tail); }
+
+	new (tail->Values() + tail->count++) T(value);
+	++size;
+}
+
+template<typename T, U64 N> inline void UnrolledList<T, N>::PushBack(T&& value)
+{
+	if (!tail || tail->count == N) { CreateChunk(tail); }
+
+	new (tail->Values() + tail->count++) T(std::move(value));
+	++size;
+}
+
+template<typename T, U64 N> inline void UnrolledList<T, N>::PopBack()
+{
+	if (size) { RemoveAt(tail, tail->count - 1); }
+}
+
+template<typename T, U64 N> inline void UnrolledList<T, N>::PushFront(const T& value)
+{
+	if (!head || head->count == N) { CreateChunk(nullptr); }
+
+	InsertAt(head, 0, value);
+}
+
+template<typename T, U64 N> inline void UnrolledList<T, N>::PushFront(T&& value)
+{
+	if (!head || head->count == N) { CreateChunk(nullptr); }
+
+	InsertAt(head, 0, std::move(value));
+}
+
+template<typename T, U64 N> inline void UnrolledList<T, N>::PopFront()
+{
+	if (size) { RemoveAt(head, 0); }
+}
+
+template<typename T, U64 N> inline void UnrolledList<T, N>::Insert(U64 index, const T& value)
+{
+	if (index >= size) { PushBack(value); return; }
+
+	Chunk* chunk = head;
+	while (index >= chunk->count) { index -= chunk->count; chunk = chunk->next; }
+
+	InsertAt(chunk, index, value);
+}
+
+template<typename T, U64 N> inline void UnrolledList<T, N>::Insert(U64 index, T&& value)
+{
+	if (index >= size) { PushBack(std::move(value)); return; }
+
+	Chunk* chunk = head;
+	while (index >= chunk->count) { index -= chunk->count; chunk = chunk->next; }
+
+	InsertAt(chunk, index, std::move(value));
+}
+
+template<typename T, U64 N> inline void UnrolledList<T, N>::InsertBack(Iterator& position, const T& value)
+{
+	if (!position.chunk) { PushBack(value); return; }
+
+	position = InsertAt(position.chunk, position.index + 1, value);
+	--position;
+}
+
+template<typename T, U64 N> inline void UnrolledList<T, N>::InsertBack(Iterator& position, T&& value)
+{
+	if (!position.chunk) { PushBack(std::move(value)); return; }
+
+	position = InsertAt(position.chunk, position.index + 1, std::move(value));
+	--position;
+}
+
+template<typename T, U64 N> inline void UnrolledList<T, N>::InsertFront(Iterator& position, const T& value)
+{
+	if (!position.chunk) { PushBack(value); return; }
+
+	position = InsertAt(position.chunk, position.index, value);
+	++position;
+}
+
+template<typename T, U64 N> inline void UnrolledList<T, N>::InsertFront(Iterator& position, T&& value)
+{
+	if (!position.chunk) { PushBack(std::move(value)); return; }
+
+	position = InsertAt(position.chunk, position.index, std::move(value));
+	++position;
+}
+
+template<typename T, U64 N> inline void UnrolledList<T, N>::Remove(U64 index)
+{
+	if (index >= size) { return; }
+
+	Chunk* chunk = head;
+	while (index >= chunk->count) { index -= chunk->count; chunk = chunk->next; }
+
+	RemoveAt(chunk, index);
+}
+
+template<typename T, U64 N> inline void UnrolledList<T, N>::Remove(Iterator& position)
+{
+	if (!position.chunk) { return; }
+
+	position = RemoveAt(position.chunk, position.index);
+}
+
+template<typename T, U64 N> inline void UnrolledList<T, N>::RemoveAll(const T& value)
+{
+	for (Iterator it = begin(); it.chunk;)
+	{
+		if (*it == value) { it = RemoveAt(it.chunk, it.index); }
+		else { ++it; }
+	}
+}
+
+template<typename T, U64 N> template<typename Predicate> inline U64 UnrolledList<T, N>::RemoveIf(Predicate predicate)
+{
+	U64 removed = 0;
+
+	for (Iterator it = begin(); it.chunk;)
+	{
+		if (predicate(*it))
+		{
+			++removed;
+			it = RemoveAt(it.chunk, it.index);
+		}
+		else { ++it; }
+	}
+
+	return removed;
+}
+
+
+
+//Helpers
+template<typename T, U64 N> template<typename Value> inline typename UnrolledList<T, N>::Iterator UnrolledList<T, N>::InsertAt(Chunk* chunk, U64 index, Value&& value)
+{
+	if (chunk->count == N)
+	{
+		//Split the full chunk in half, the value goes into whichever half holds index
+		constexpr U64 half = N / 2;
+
+		Chunk* next = CreateChunk(chunk);
+		Relocate(next->Values(), chunk->Values() + half, N - half);
+		next->count = N - half;
+		chunk->count = half;
+
+		if (index > half)
+		{
+			chunk = next;
+			index -= half;
+		}
+	}
+
+	T* values = chunk->Values();
+	Relocate(values + index + 1, values + index, chunk->count - index);
+	new (values + index) T(std::forward<Value>(value));
+
+	++chunk->count;
+	++size;
+
+	return { chunk, index };
+}
+
+template<typename T, U64 N> inline typename UnrolledList<T, N>::Iterator UnrolledList<T, N>::RemoveAt(Chunk* chunk, U64 index)
+{
+	T* values = chunk->Values();
+	values[index].~T();
+	Relocate(values + index, values + index + 1, chunk->count - index - 1);
+
+	--chunk->count;
+	--size;
+
+	if (chunk->count == 0)
+	{
+		Chunk* next = chunk->next;
+		EraseChunk(chunk);
+		return { next, 0 };
+	}
+
+	//Sparse neighbours are merged so chunks stay at least partly full
+	Chunk* next = chunk->next;
+	if (next && chunk->count + next->count <= N - N / 4)
+	{
+		Relocate(values + chunk->count, next->Values(), next->count);
+		chunk->count += next->count;
+		next->count = 0;
+		EraseChunk(next);
+	}
+
+	if (index < chunk->count) { return { chunk, index }; }
+	return { chunk->next, 0 };
+}
+
+template<typename T, U64 N> inline typename UnrolledList<T, N>::Chunk* UnrolledList<T, N>::CreateChunk(Chunk* prev)
+{
+	Chunk* chunk = new (pool.Allocate()) Chunk;
+	chunk->count = 0;
+	chunk->prev = prev;
+
+	if (prev)
+	{
+		chunk->next = prev->next;
+		prev->next = chunk;
+	}
+	else
+	{
+		chunk->next = head;
+		head = chunk;
+	}
+
+	if (chunk->next) { chunk->next->prev = chunk; }
+	else { tail = chunk; }
+
+	return chunk;
+}
+
+template<typename T, U64 N> inline void UnrolledList<T, N>::EraseChunk(Chunk* chunk)
+{
+	if (chunk->next) { chunk->next->prev = chunk->prev; }
+	else { tail = chunk->prev; }
+
+	if (chunk->prev) { chunk->prev->next = chunk->next; }
+	else { head = chunk->next; }
+
+	pool.Free(chunk);
+}
+
+template<typename T, U64 N> inline void UnrolledList<T, N>::Relocate(T* dst, T* src, U64 count)
+{
+	if (count == 0 || dst == src) { return; }
+
+	if constexpr (std::is_trivially_copyable_v<T>) { memmove(dst, src, count * sizeof(T)); }
+	else if (dst < src)
+	{
+		for (U64 i = 0; i < count; ++i) { new (dst + i) T(std::move(src[i])); src[i].~T(); }
+	}
+	else
+	{
+		for (U64 i = count; i--;) { new (dst + i) T(std::move(src[i])); src[i].~T(); }
+	}
+}
@@ -1,12 +1,30 @@
 ﻿import Containers;
 
 #include "List.h"
+#include "UnrolledList.hpp"
+#include "IntrusiveList.hpp"
+#include "CompactList.hpp"
+#include "SkipList.hpp"
+#include "MPSCList.hpp"
 #include "String.hpp"
+#include "StringPool.hpp"
+#include "Rope.hpp"
+#include "GapString.hpp"
+#include "Hash.hpp"
+#include "Hashmap.h"
+#include "SharedString.hpp"
+#include "PatternSet.hpp"
+#include "Frozen.hpp"
 
 #include <Windows.h>
 #include <stdio.h>
 #include <vector>
+#include <unordered_map>
 #include <list>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
 
 static int constructCount = 0;
 static int destructCount = 0;
@@ -1977,41 +1995,5223 @@ void StringIndexOf()
 {
 	BEGIN_TEST;
 
+	String str0("Hello, World! Hello, World!");
+	String8 str1(u8"Hello, World! Hello, World!");
+	String16 str2(u"Hello, World! Hello, World!");
+	String32 str3(U"Hello, World! Hello, World!");
+	StringW str4(L"Hello, World! Hello, World!");
+
+	passed = str0.IndexOf('W') == 7 && str0.IndexOf('W', 8) == 21 && str0.IndexOf('w') == -1 &&
+		str1.IndexOf(u8'W') == 7 && str1.IndexOf(u8'W', 8) == 21 && str1.IndexOf(u8'w') == -1 &&
+		str2.IndexOf(u'W') == 7 && str2.IndexOf(u'W', 8) == 21 && str2.IndexOf(u'w') == -1 &&
+		str3.IndexOf(U'W') == 7 && str3.IndexOf(U'W', 8) == 21 && str3.IndexOf(U'w') == -1 &&
+		str4.IndexOf(L'W') == 7 && str4.IndexOf(L'W', 8) == 21 && str4.IndexOf(L'w') == -1;
+
+	END_TEST;
+}
+
+void StringLastIndexOf()
+{
+	BEGIN_TEST;
+
+	END_TEST;
+}
+
+void StringTrim()
+{
+	BEGIN_TEST;
+
+	String str0(" \t Hello, World!\n");
+	String8 str1(u8" \t Hello, World!\n");
+	String16 str2(u" \t Hello, World!\n");
+	String32 str3(U" \t Hello, World!\n");
+	StringW str4(L" \t Hello, World!\n");
+
+	str0.Trim();
+	str1.Trim();
+	str2.Trim();
+	str3.Trim();
+	str4.Trim();
+
+	passed = str0.Size() == 13 && str0.Capacity() == 1024 && Compare(str0.Data(), "Hello, World!", 14) &&
+		str1.Size() == 13 && str1.Capacity() == 1024 && Compare(str1.Data(), u8"Hello, World!", 14) &&
+		str2.Size() == 13 && str2.Capacity() == 1024 && Compare(str2.Data(), u"Hello, World!", 14) &&
+		str3.Size() == 13 && str3.Capacity() == 1024 && Compare(str3.Data(), U"Hello, World!", 14) &&
+		str4.Size() == 13 && str4.Capacity() == 1024 && Compare(str4.Data(), L"Hello, World!", 14);
+
+	END_TEST;
+}
+
+void StringToUpper()
+{
+	BEGIN_TEST;
+
+	String str0("hello, World! 123 zebra@[`{");
+	String8 str1(u8"hello, World! 123 zebra@[`{");
+	String16 str2(u"hello, World! 123 zebra@[`{");
+	String32 str3(U"hello, World! 123 zebra@[`{");
+	StringW str4(L"hello, World! 123 zebra@[`{");
+
+	str0.ToUpper();
+	str1.ToUpper();
+	str2.ToUpper();
+	str3.ToUpper();
+	str4.ToUpper();
+
+	passed = str0.Size() == 27 && Compare(str0.Data(), "HELLO, WORLD! 123 ZEBRA@[`{", 28) &&
+		str1.Size() == 27 && Compare(str1.Data(), u8"HELLO, WORLD! 123 ZEBRA@[`{", 28) &&
+		str2.Size() == 27 && Compare(str2.Data(), u"HELLO, WORLD! 123 ZEBRA@[`{", 28) &&
+		str3.Size() == 27 && Compare(str3.Data(), U"HELLO, WORLD! 123 ZEBRA@[`{", 28) &&
+		str4.Size() == 27 && Compare(str4.Data(), L"HELLO, WORLD! 123 ZEBRA@[`{", 28);
+
+	END_TEST;
+}
+
+void StringToLower()
+{
+	BEGIN_TEST;
+
+	String str0("hello, World! 123 zebra@[`{");
+	String8 str1(u8"hello, World! 123 zebra@[`{");
+	String16 str2(u"hello, World! 123 zebra@[`{");
+	String32 str3(U"hello, World! 123 zebra@[`{");
+	StringW str4(L"hello, World! 123 zebra@[`{");
+
+	str0.ToLower();
+	str1.ToLower();
+	str2.ToLower();
+	str3.ToLower();
+	str4.ToLower();
+
+	passed = str0.Size() == 27 && Compare(str0.Data(), "hello, world! 123 zebra@[`{", 28) &&
+		str1.Size() == 27 && Compare(str1.Data(), u8"hello, world! 123 zebra@[`{", 28) &&
+		str2.Size() == 27 && Compare(str2.Data(), u"hello, world! 123 zebra@[`{", 28) &&
+		str3.Size() == 27 && Compare(str3.Data(), U"hello, world! 123 zebra@[`{", 28) &&
+		str4.Size() == 27 && Compare(str4.Data(), L"hello, world! 123 zebra@[`{", 28);
+
+	END_TEST;
+}
+
+void StringToCapital()
+{
+	BEGIN_TEST;
+
+	String str0("hello, World! 123 zebra@[`{");
+	String8 str1(u8"hello, World! 123 zebra@[`{");
+	String16 str2(u"hello, World! 123 zebra@[`{");
+	String32 str3(U"hello, World! 123 zebra@[`{");
+	StringW str4(L"hello, World! 123 zebra@[`{");
+
+	str0.ToCapital();
+	str1.ToCapital();
+	str2.ToCapital();
+	str3.ToCapital();
+	str4.ToCapital();
+
+	passed = str0.Size() == 27 && Compare(str0.Data(), "Hello, world! 123 zebra@[`{", 28) &&
+		str1.Size() == 27 && Compare(str1.Data(), u8"Hello, world! 123 zebra@[`{", 28) &&
+		str2.Size() == 27 && Compare(str2.Data(), u"Hello, world! 123 zebra@[`{", 28) &&
+		str3.Size() == 27 && Compare(str3.Data(), U"Hello, world! 123 zebra@[`{", 28) &&
+		str4.Size() == 27 && Compare(str4.Data(), L"Hello, world! 123 zebra@[`{", 28);
+
+	END_TEST;
+}
+
+void StringIndexOfString()
+{
+	BEGIN_TEST;
+
+	String str0("Hello, World! Hello, World!");
+	String8 str1(u8"Hello, World! Hello, World!");
+	String16 str2(u"Hello, World! Hello, World!");
+	String32 str3(U"Hello, World! Hello, World!");
+	StringW str4(L"Hello, World! Hello, World!");
+
+	passed = str0.IndexOf(String("World")) == 7 && str0.IndexOf(String("World"), 8) == 21 && str0.IndexOf(String("world")) == -1 &&
+		str1.IndexOf(String8(u8"World")) == 7 && str1.IndexOf(String8(u8"World"), 8) == 21 && str1.IndexOf(String8(u8"world")) == -1 &&
+		str2.IndexOf(String16(u"World")) == 7 && str2.IndexOf(String16(u"World"), 8) == 21 && str2.IndexOf(String16(u"world")) == -1 &&
+		str3.IndexOf(String32(U"World")) == 7 && str3.IndexOf(String32(U"World"), 8) == 21 && str3.IndexOf(String32(U"world")) == -1 &&
+		str4.IndexOf(StringW(L"World")) == 7 && str4.IndexOf(StringW(L"World"), 8) == 21 && str4.IndexOf(StringW(L"world")) == -1;
+
+	END_TEST;
+}
+
+void StringIndexOfLongString()
+{
+	BEGIN_TEST;
+
+	String str0("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab");
+	String str1("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab");
+	String str2("aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaac");
+
+	passed = str0.IndexOf(str1) == 53 && str0.IndexOf(str2) == -1;
+
+	END_TEST;
+}
+
+void StringContains()
+{
+	BEGIN_TEST;
+
+	String str0("Hello, World!");
+	String8 str1(u8"Hello, World!");
+	String16 str2(u"Hello, World!");
+	String32 str3(U"Hello, World!");
+	StringW str4(L"Hello, World!");
+
+	passed = str0.Contains(String("lo, W")) && !str0.Contains(String("lo,W")) &&
+		str1.Contains(String8(u8"lo, W")) && !str1.Contains(String8(u8"lo,W")) &&
+		str2.Contains(String16(u"lo, W")) && !str2.Contains(String16(u"lo,W")) &&
+		str3.Contains(String32(U"lo, W")) && !str3.Contains(String32(U"lo,W")) &&
+		str4.Contains(StringW(L"lo, W")) && !str4.Contains(StringW(L"lo,W"));
+
+	END_TEST;
+}
+
+void StringCountOccurrences()
+{
+	BEGIN_TEST;
+
+	String str0("abababab, ab");
+	String8 str1(u8"abababab, ab");
+	String16 str2(u"abababab, ab");
+	String32 str3(U"abababab, ab");
+	StringW str4(L"abababab, ab");
+
+	passed = str0.CountOccurrences(String("ab")) == 5 && str0.CountOccurrences(String("aba")) == 2 &&
+		str1.CountOccurrences(String8(u8"ab")) == 5 && str1.CountOccurrences(String8(u8"aba")) == 2 &&
+		str2.CountOccurrences(String16(u"ab")) == 5 && str2.CountOccurrences(String16(u"aba")) == 2 &&
+		str3.CountOccurrences(String32(U"ab")) == 5 && str3.CountOccurrences(String32(U"aba")) == 2 &&
+		str4.CountOccurrences(StringW(L"ab")) == 5 && str4.CountOccurrences(StringW(L"aba")) == 2;
+
+	END_TEST;
+}
+
+void StringReplaceAll()
+{
+	BEGIN_TEST;
+
+	String str0("the cat sat on the mat");
+	String8 str1(u8"the cat sat on the mat");
+	String16 str2(u"the cat sat on the mat");
+	String32 str3(U"the cat sat on the mat");
+	StringW str4(L"the cat sat on the mat");
+
+	str0.ReplaceAll(String("the"), String("a"));
+	str1.ReplaceAll(String8(u8"at"), String8(u8"ool"));
+	str2.ReplaceAll(String16(u"the"), String16(u"a"));
+	str3.ReplaceAll(String32(U"at"), String32(U"ool"));
+	StringW str5 = str4;
+	str4.ReplaceAll(StringW(L"dog"), StringW(L"a"));
+
+	passed = str0.Size() == 18 && Compare(str0.Data(), "a cat sat on a mat", 19) &&
+		str1.Size() == 25 && Compare(str1.Data(), u8"the cool sool on the mool", 26) &&
+		str2.Size() == 18 && Compare(str2.Data(), u"a cat sat on a mat", 19) &&
+		str3.Size() == 25 && Compare(str3.Data(), U"the cool sool on the mool", 26) &&
+		str4.Size() == str5.Size() && Compare(str4.Data(), str5.Data(), str5.Size() + 1);
+
+	END_TEST;
+}
+
+void StringViewInit()
+{
+	BEGIN_TEST;
+
+	String str0("Hello, World!");
+	StringView view0;
+	StringView view1("Hello, World!");
+	StringView view2("Hello, World!", 5);
+	StringView view3(str0);
+	StringView16 view4(u"Hello, World!");
+	StringView32 view5(U"Hello, World!");
+
+	passed = view0.Size() == 0 && view0.Data() == nullptr &&
+		view1.Size() == 13 && Compare(view1.Data(), "Hello, World!", 13) &&
+		view2.Size() == 5 && Compare(view2.Data(), "Hello", 5) &&
+		view3.Size() == 13 && view3.Data() == str0.Data() &&
+		view4.Size() == 13 && Compare(view4.Data(), u"Hello, World!", 13) &&
+		view5.Size() == 13 && Compare(view5.Data(), U"Hello, World!", 13);
+
+	END_TEST;
+}
+
+void StringSubStringView()
+{
+	BEGIN_TEST;
+
+	String str0("Hello, World!");
+	String16 str1(u"Hello, World!");
+
+	StringView view0 = str0.SubString(3, 6);
+	StringView view1 = str0.SubString(7);
+	StringView view2 = view1.SubString(2, 100);
+	StringView16 view3 = str1.SubString(3, 6);
+
+	passed = view0.Size() == 6 && view0.Data() == str0.Data() + 3 && Compare(view0.Data(), "lo, Wo", 6) &&
+		view1.Size() == 6 && view1.Data() == str0.Data() + 7 && Compare(view1.Data(), "World!", 6) &&
+		view2.Size() == 4 && view2.Data() == str0.Data() + 9 && Compare(view2.Data(), "rld!", 4) &&
+		view3.Size() == 6 && view3.Data() == str1.Data() + 3 && Compare(view3.Data(), u"lo, Wo", 6);
+
+	END_TEST;
+}
+
+void StringViewTrim()
+{
+	BEGIN_TEST;
+
+	String str0(" \t Hello, World!\n");
+	StringView view0 = str0.Trimmed();
+	StringView view1("\n\r ");
+	view1.Trim();
+
+	passed = str0.Size() == 17 && view0.Size() == 13 && view0.Data() == str0.Data() + 3 && Compare(view0.Data(), "Hello, World!", 13) &&
+		view1.Size() == 0 && view1.Blank();
+
+	END_TEST;
+}
+
+void StringViewSearch()
+{
+	BEGIN_TEST;
+
+	String str0("key=value; other=thing");
+	StringView view0 = str0.SubString(11);
+
+	passed = view0.IndexOf('=') == 5 && view0.IndexOf("thing") == 6 && view0.Contains("other") && !view0.Contains("key") &&
+		view0.LastIndexOf('t') == 6 && str0.IndexOf(view0) == 11 && str0.CountOccurrences(view0.SubString(5, 1)) == 2;
+
+	END_TEST;
+}
+
+void StringAppendView()
+{
+	BEGIN_TEST;
+
+	String str0("Hello");
+	String str1("Hello, World!");
+
+	str0.Append(str0.SubString(1, 3));
+	str0.Prepend(StringView(", ", 1));
+	str1.Surround(str1.SubString(0, 5), str1.SubString(7, 5));
+
+	String str2 = str1.SubString(5, 8);
+
+	passed = str0.Size() == 9 && Compare(str0.Data(), ",Helloell", 10) &&
+		str1.Size() == 23 && Compare(str1.Data(), "HelloHello, World!World", 24) &&
+		str2.Size() == 8 && str2.Capacity() == 1024 && Compare(str2.Data(), "Hello, W", 9);
+
+	END_TEST;
+}
+
+static std::string LogText()
+{
+	static const char* levels[] = { "INFO", "DEBUG", "WARN", "INFO", "ERROR" };
+	static const char* paths[] = { "/api/v1/orders", "/api/v1/users/me", "/health", "/api/v2/search?q=shoes", "/static/app.js" };
+
+	std::string text;
+	text.reserve(8 * 1024 * 1024);
+
+	char line[256];
+	for (int i = 0; i < 60000; ++i)
+	{
+		snprintf(line, sizeof(line), "2024-03-05T12:%02d:%02d.%03dZ %s [worker-%d] request_id=%08x method=GET path=%s status=%d latency_ms=%d\n",
+			(i / 60) % 60, i % 60, i % 1000, levels[i % 5], i % 16, i * 2654435761u, paths[i % 5], i % 97 ? 200 : 404, (i * 7) % 250);
+		text += line;
+	}
+
+	text += "2024-03-05T13:00:00.000Z ERROR [worker-3] request_id=deadbeef upstream connection reset by peer while reading response header\n";
+
+	return text;
+}
+
+void StringSearchSpeed()
+{
+	std::string text = LogText();
+	String str(text.c_str(), text.size());
+	String shortFind("status=503");
+	String longFind("upstream connection reset by peer while reading response header");
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	I64 index0 = 0;
+	I64 index1 = 0;
+	for (int i = 0; i < 20; ++i)
+	{
+		index0 += str.IndexOf(shortFind);
+		index1 += str.IndexOf(longFind);
+	}
+
+	passed = index0 == -20 && index1 == (I64)text.find(longFind.Data()) * 20;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void STLStringSearchSpeed()
+{
+	std::string text = LogText();
+	std::string shortFind("status=503");
+	std::string longFind("upstream connection reset by peer while reading response header");
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 index0 = 0;
+	U64 index1 = 0;
+	for (int i = 0; i < 20; ++i)
+	{
+		index0 += text.find(shortFind) == std::string::npos;
+		index1 += text.find(longFind);
+	}
+
+	passed = index0 == 20 && index1 == text.find(longFind) * 20;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void StrstrSearchSpeed()
+{
+	std::string text = LogText();
+	const char* shortFind = "status=503";
+	const char* longFind = "upstream connection reset by peer while reading response header";
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 index0 = 0;
+	U64 index1 = 0;
+	for (int i = 0; i < 20; ++i)
+	{
+		index0 += strstr(text.c_str(), shortFind) == nullptr;
+		index1 += strstr(text.c_str(), longFind) - text.c_str();
+	}
+
+	passed = index0 == 20 && index1 == text.find(longFind) * 20;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void StringViewSubStringSpeed()
+{
+	std::string text = LogText();
+	String str(text.c_str(), text.size());
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 total = 0;
+	for (U64 i = 0; i + 64 < str.Size(); i += 8)
+	{
+		StringView field = str.SubString(i, 64);
+		total += field.Size();
+	}
+
+	passed = total == ((str.Size() - 65) / 8 + 1) * 64;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void StringCopySubStringSpeed()
+{
+	std::string text = LogText();
+	String str(text.c_str(), text.size());
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 total = 0;
+	for (U64 i = 0; i + 64 < str.Size(); i += 8)
+	{
+		String field = str.SubString(i, 64);
+		total += field.Size();
+	}
+
+	passed = total == ((str.Size() - 65) / 8 + 1) * 64;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+#pragma endregion
+
+#pragma region String Pool Tests
+
+void StringPoolIntern()
+{
+	BEGIN_TEST;
+
+	StringPool pool;
+	String str0("field_name");
+	String str1("other.field_name");
+
+	Atom atom0 = pool.Intern("field_name");
+	Atom atom1 = pool.Intern(str0);
+	Atom atom2 = pool.Intern(str1.SubString(6));
+	Atom atom3 = pool.Intern("metric_label");
+	Atom atom4 = pool.Intern("");
+
+	passed = atom0.Valid() && atom0 == atom1 && atom0 == atom2 && atom0 != atom3 && atom4.Valid() && atom4 != atom0 &&
+		pool.Size() == 3;
+
+	END_TEST;
+}
+
+void StringPoolFind()
+{
+	BEGIN_TEST;
+
+	StringPool16 pool;
+
+	Atom atom0 = pool.Intern(u"field_name");
+	Atom atom1 = pool.Find(u"field_name");
+	Atom atom2 = pool.Find(u"missing");
+
+	//Reading through an invalid atom gives nothing instead of reading past the entries
+	bool invalid = pool.View(atom2).Size() == 0 && pool.Data(atom2) == nullptr && pool.Hash(atom2) == 0;
+
+	passed = atom0 == atom1 && !atom2.Valid() && pool.Size() == 1 && invalid;
+
+	END_TEST;
+}
+
+void StringPoolView()
+{
+	BEGIN_TEST;
+
+	StringPool pool;
+	Atom atom0 = pool.Intern("field_name");
+
+	for (int i = 0; i < 10000; ++i)
+	{
+		char name[32];
+		snprintf(name, sizeof(name), "label_%d", i);
+		pool.Intern(name);
+	}
+
+	StringView view0 = pool.View(atom0);
+	Atom atom1 = pool.Find("label_9999");
+
+	passed = view0.Size() == 10 && Compare(view0.Data(), "field_name", 10) && Compare(pool.Data(atom0), "field_name", 11) &&
+		pool.Size() == 10001 && atom1.Valid() && Compare(pool.Data(atom1), "label_9999", 11) && pool.Hash(atom0) != pool.Hash(atom1);
+
+	END_TEST;
+}
+
+void StringPoolThreadSafe()
+{
+	BEGIN_TEST;
+
+	StringPoolBase<char, true> pool;
+	Atom atoms[4][1000];
+
+	std::thread threads[4];
+	for (int t = 0; t < 4; ++t)
+	{
+		threads[t] = std::thread([&pool, &atoms, t]()
+		{
+			for (int i = 0; i < 1000; ++i)
+			{
+				char name[32];
+				snprintf(name, sizeof(name), "label_%d", i);
+				atoms[t][i] = pool.Intern(name);
+			}
+		});
+	}
+
+	for (std::thread& thread : threads) { thread.join(); }
+
+	passed = pool.Size() == 1000;
+	for (int i = 0; i < 1000; ++i)
+	{
+		passed &= atoms[0][i] == atoms[1][i] && atoms[0][i] == atoms[2][i] && atoms[0][i] == atoms[3][i];
+	}
+
+	END_TEST;
+}
+
+void StringPoolCompareSpeed()
+{
+	StringPool pool;
+	Atom atoms[4096];
+	for (int i = 0; i < 4096; ++i)
+	{
+		char name[64];
+		snprintf(name, sizeof(name), "service.request.latency.bucket_%d", i);
+		atoms[i] = pool.Intern(name);
+	}
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 matches = 0;
+	for (int i = 0; i < 10000000; ++i)
+	{
+		matches += atoms[i & 4095] == atoms[(i * 7) & 4095];
+	}
+
+	passed = matches == 4883;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void StringCompareSpeed()
+{
+	String* strings = new String[4096];
+	for (int i = 0; i < 4096; ++i)
+	{
+		char name[64];
+		snprintf(name, sizeof(name), "service.request.latency.bucket_%d", i);
+		strings[i] = name;
+	}
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 matches = 0;
+	for (int i = 0; i < 10000000; ++i)
+	{
+		const String& a = strings[i & 4095];
+		const String& b = strings[(i * 7) & 4095];
+		matches += a.Size() == b.Size() && memcmp(a.Data(), b.Data(), a.Size()) == 0;
+	}
+
+	passed = matches == 4883;
+
+	/*** END TEST ***/
+
+	END_TEST;
+
+	delete[] strings;
+}
+
+#pragma endregion
+
+#pragma region Rope Tests
+
+void RopeInit()
+{
+	BEGIN_TEST;
+
+	Rope rope0;
+	Rope rope1("Hello, World!");
+	Rope16 rope2(StringView16(u"Hello, World!"));
+	Rope rope3(rope1);
+	Rope rope4(std::move(rope3));
+
+	String str1 = rope1.ToString();
+	String16 str2 = rope2.ToString();
+	String str4 = rope4.ToString();
+
+	passed = rope0.Size() == 0 && rope3.Size() == 0 &&
+		rope1.Size() == 13 && str1.Size() == 13 && Compare(str1.Data(), "Hello, World!", 14) &&
+		rope2.Size() == 13 && str2.Size() == 13 && Compare(str2.Data(), u"Hello, World!", 14) &&
+		rope4.Size() == 13 && str4.Size() == 13 && Compare(str4.Data(), "Hello, World!", 14);
+
+	END_TEST;
+}
+
+void RopeAppendPrepend()
+{
+	BEGIN_TEST;
+
+	Rope rope0("World");
+	Rope rope1(rope0);
+
+	rope0.Prepend("Hello, ");
+	rope0.Append("!");
+	rope1.Append(rope0);
+
+	String str0 = rope0.ToString();
+	String str1 = rope1.ToString();
+
+	passed = rope0.Size() == 13 && Compare(str0.Data(), "Hello, World!", 14) &&
+		rope1.Size() == 18 && Compare(str1.Data(), "WorldHello, World!", 19);
+
+	END_TEST;
+}
+
+void RopeInsertErase()
+{
+	BEGIN_TEST;
+
+	Rope rope0("Hello, World!");
+
+	rope0.Insert(5, " there");
+	String str0 = rope0.ToString();
+	rope0.Erase(5, 6);
+	String str1 = rope0.ToString();
+	rope0.Erase(5);
+	String str2 = rope0.ToString();
+
+	passed = Compare(str0.Data(), "Hello there, World!", 20) &&
+		Compare(str1.Data(), "Hello, World!", 14) &&
+		rope0.Size() == 5 && Compare(str2.Data(), "Hello", 6) && rope0[1] == 'e';
+
+	END_TEST;
+}
+
+void RopeSubString()
+{
+	BEGIN_TEST;
+
+	String text(5000);
+	for (U64 i = 0; i < 5000; ++i) { text.Data()[i] = 'a' + i % 26; }
+	text.Data()[5000] = '\0';
+
+	Rope rope0(text);
+	Rope rope1 = rope0.SubString(1000, 3000);
+	rope0.Erase(0, 4000);
+
+	String str1 = rope1.ToString();
+
+	passed = rope0.Size() == 1000 && rope1.Size() == 3000 && str1.Size() == 3000 && Compare(str1.Data(), text.Data() + 1000, 3000) &&
+		rope1[0] == text.Data()[1000] && rope1[2999] == text.Data()[3999];
+
+	END_TEST;
+}
+
+void RopeBalance()
+{
+	BEGIN_TEST;
+
+	Rope rope;
+	char fragment[2048];
+	for (int i = 0; i < 2048; ++i) { fragment[i] = 'a' + i % 26; }
+
+	for (int i = 0; i < 10000; ++i)
+	{
+		rope.Insert(rope.Size() / 2, StringView(fragment, 1 + (i * 37) % 2047));
+	}
+
+	passed = rope.Height() < 32;
+
+	END_TEST;
+}
+
+void RopePrependSpeed()
+{
+	const char* fragment = "<li class=\"entry\">payload</li>\n";
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	Rope rope;
+	for (int i = 0; i < 20000; ++i) { rope.Prepend(fragment); }
+
+	String str = rope.ToString();
+
+	passed = str.Size() == 20000 * 31;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void StringPrependSpeed()
+{
+	const char* fragment = "<li class=\"entry\">payload</li>\n";
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	String str;
+	for (int i = 0; i < 20000; ++i) { str.Prepend(fragment); }
+
+	passed = str.Size() == 20000 * 31;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void RopeInsertMiddleSpeed()
+{
+	const char* fragment = "<li class=\"entry\">payload</li>\n";
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	Rope rope;
+	for (int i = 0; i < 20000; ++i) { rope.Insert(rope.Size() / 2, fragment); }
+
+	String str = rope.ToString();
+
+	passed = str.Size() == 20000 * 31;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void STLStringInsertMiddleSpeed()
+{
+	const char* fragment = "<li class=\"entry\">payload</li>\n";
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	std::string str;
+	for (int i = 0; i < 20000; ++i) { str.insert(str.size() / 2, fragment); }
+
+	passed = str.size() == 20000 * 31;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+#pragma endregion
+
+#pragma region Gap String Tests
+
+void GapStringInit()
+{
+	BEGIN_TEST;
+
+	GapString gap0;
+	GapString gap1(StringView("Hello, World!"));
+	GapString16 gap2(StringView16(u"Hello, World!"));
+	GapString gap3(gap1);
+	GapString gap4(std::move(gap3));
+
+	String str1 = gap1.ToString();
+	String16 str2 = gap2.ToString();
+	String str4 = gap4.ToString();
+
+	passed = gap0.Size() == 0 && gap3.Size() == 0 &&
+		gap1.Size() == 13 && gap1.Cursor() == 13 && Compare(str1.Data(), "Hello, World!", 14) &&
+		gap2.Size() == 13 && Compare(str2.Data(), u"Hello, World!", 14) &&
+		gap4.Size() == 13 && Compare(str4.Data(), "Hello, World!", 14);
+
+	END_TEST;
+}
+
+void GapStringInsert()
+{
+	BEGIN_TEST;
+
+	GapString gap0(StringView("Hello World"));
+
+	gap0.MoveCursor(5).Insert(',');
+	gap0.MoveCursor(U64_MAX).Insert('!');
+	gap0.MoveCursor(0).Insert("Say: ");
+	String str0 = gap0.ToString();
+
+	//A full gap string grows on insert, the view of its own text has to survive that
+	GapString gap1(StringView("0123456789012345678901234567890123456789012345678901234567890123"));
+	gap1.MoveCursor(10);
+	gap1.Insert(gap1.Before());
+	String str1 = gap1.ToString();
+
+	passed = gap0.Cursor() == 5 && gap0.Size() == 18 && gap0[6] == 'e' && gap0[17] == '!' &&
+		Compare(str0.Data(), "Say: Hello, World!", 19) &&
+		gap1.Size() == 74 && gap1.Cursor() == 20 && Compare(str1.Data(), "01234567890123456789", 20) && str1[20] == '0' && str1[73] == '3';
+
+	END_TEST;
+}
+
+void GapStringDelete()
+{
+	BEGIN_TEST;
+
+	GapString gap0(StringView("Hello there, World!"));
+
+	gap0.MoveCursor(11).Backspace(6);
+	String str0 = gap0.ToString();
+	gap0.Delete(100);
+	String str1 = gap0.ToString();
+	gap0.Backspace(100);
+
+	passed = Compare(str0.Data(), "Hello, World!", 14) &&
+		Compare(str1.Data(), "Hello", 6) && gap0.Size() == 0 && gap0.Cursor() == 0;
+
+	END_TEST;
+}
+
+void GapStringHalves()
+{
+	BEGIN_TEST;
+
+	GapString gap0(StringView("Hello, World!"));
+
+	gap0.MoveCursor(7);
+	StringView before = gap0.Before();
+	StringView after = gap0.After();
+
+	passed = before.Size() == 7 && Compare(before.Data(), "Hello, ", 7) &&
+		after.Size() == 6 && Compare(after.Data(), "World!", 6) &&
+		after.Data() == before.Data() + gap0.Capacity() - 6;
+
+	END_TEST;
+}
+
+struct TypingOp
+{
+	U32 position;
+	char c;				//'\b' deletes the character before position
+};
+
+/// <summary>
+/// Replays an editing session on a document of documentSize characters: mostly typing with some backspacing,
+/// arrow key nudges and an occasional jump to somewhere else in the document
+/// </summary>
+static std::vector<TypingOp> TypingTrace(U64 documentSize, U64 count, U64& finalSize)
+{
+	std::vector<TypingOp> trace;
+	trace.reserve(count);
+
+	U32 seed = 12345;
+	auto next = [&]() { seed = seed * 1664525u + 1013904223u; return seed >> 8; };
+
+	U64 size = documentSize;
+	U64 cursor = documentSize / 2;
+
+	for (U64 i = 0; i < count; ++i)
+	{
+		U32 r = next();
+
+		if (r % 400 == 0) { cursor = next() % (size + 1); }
+		else if (r % 50 == 0)
+		{
+			U64 nudge = next() % 9;
+			cursor = cursor + nudge < 4 ? 0 : cursor + nudge - 4;
+			if (cursor > size) { cursor = size; }
+		}
+
+		if (r % 100 < 85 || cursor == 0) { trace.push_back({ (U32)cursor, (char)('a' + r % 26) }); ++cursor; ++size; }
+		else { trace.push_back({ (U32)cursor, '\b' }); --cursor; --size; }
+	}
+
+	finalSize = size;
+	return trace;
+}
+
+void GapStringTypingReplay()
+{
+	std::string text = LogText().substr(0, 4096);
+	U64 finalSize;
+	std::vector<TypingOp> trace = TypingTrace(text.size(), 20000, finalSize);
+
+	BEGIN_TEST;
+
+	GapString gap(StringView(text.c_str(), text.size()));
+	String str(text.c_str(), text.size());
+	Rope rope(StringView(text.c_str(), text.size()));
+
+	for (const TypingOp& op : trace)
+	{
+		gap.MoveCursor(op.position);
+
+		if (op.c == '\b')
+		{
+			gap.Backspace();
+			str.Erase(op.position - 1, 1);
+			rope.Erase(op.position - 1, 1);
+			text.erase(op.position - 1, 1);
+		}
+		else
+		{
+			gap.Insert(op.c);
+			str.Insert(op.position, StringView(&op.c, 1));
+			rope.Insert(op.position, StringView(&op.c, 1));
+			text.insert(op.position, 1, op.c);
+		}
+	}
+
+	String gapStr = gap.ToString();
+	String ropeStr = rope.ToString();
+
+	passed = text.size() == finalSize && gap.Size() == finalSize && str.Size() == finalSize && rope.Size() == finalSize &&
+		Compare(gapStr.Data(), text.c_str(), text.size() + 1) &&
+		Compare(str.Data(), text.c_str(), text.size() + 1) &&
+		Compare(ropeStr.Data(), text.c_str(), text.size() + 1);
+
+	END_TEST;
+}
+
+void GapStringTypingSpeed()
+{
+	std::string text = LogText().substr(0, 131072);
+	U64 finalSize;
+	std::vector<TypingOp> trace = TypingTrace(text.size(), 100000, finalSize);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	GapString gap(StringView(text.c_str(), text.size()));
+
+	for (const TypingOp& op : trace)
+	{
+		gap.MoveCursor(op.position);
+
+		if (op.c == '\b') { gap.Backspace(); }
+		else { gap.Insert(op.c); }
+	}
+
+	passed = gap.Size() == finalSize;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void StringTypingSpeed()
+{
+	std::string text = LogText().substr(0, 131072);
+	U64 finalSize;
+	std::vector<TypingOp> trace = TypingTrace(text.size(), 100000, finalSize);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	String str(text.c_str(), text.size());
+
+	for (const TypingOp& op : trace)
+	{
+		if (op.c == '\b') { str.Erase(op.position - 1, 1); }
+		else { str.Insert(op.position, StringView(&op.c, 1)); }
+	}
+
+	passed = str.Size() == finalSize;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void RopeTypingSpeed()
+{
+	std::string text = LogText().substr(0, 131072);
+	U64 finalSize;
+	std::vector<TypingOp> trace = TypingTrace(text.size(), 100000, finalSize);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	Rope rope(StringView(text.c_str(), text.size()));
+
+	for (const TypingOp& op : trace)
+	{
+		if (op.c == '\b') { rope.Erase(op.position - 1, 1); }
+		else { rope.Insert(op.position, StringView(&op.c, 1)); }
+	}
+
+	passed = rope.Size() == finalSize;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+#pragma endregion
+
+#pragma region String Format Tests
+
+void StringFormat()
+{
+	BEGIN_TEST;
+
+	int value = 42;
+	String who("world");
+
+	String str0 = String::Format("Hello, {}! {} {} {} {}", who, -1234567890123LL, 0U, 18446744073709551615ULL, true);
+	String str1 = String::Format("{{}} {} {} {}", 'x', StringView("view"), "literal");
+	String str2 = String::Format("{} {}", (void*)0x1234, &value);
+	String str3 = String::Format("{} and {}", 7);
+	String16 str4 = String16::Format(u"{}: {}", u"count", -9);
+	const char* missing = nullptr;
+	String str5 = String::Format("[{}]", missing);
+
+	passed = Compare(str0.Data(), "Hello, world! -1234567890123 0 18446744073709551615 true", 56) &&
+		Compare(str1.Data(), "{} x view literal", 18) &&
+		str2.Size() == 37 && Compare(str2.Data(), "0x0000000000001234 0x", 21) &&
+		Compare(str3.Data(), "7 and {}", 9) &&
+		Compare(str4.Data(), u"count: -9", 10) &&
+		Compare(str5.Data(), "[]", 3);
+
+	END_TEST;
+}
+
+void StringFormatFloat()
+{
+	BEGIN_TEST;
+
+	String str0 = String::Format("{} {} {} {}", 0.1, 1.5f, -2.0, 1e300);
+	String32 str1 = String32::Format(U"{}", 3.14159);
+
+	passed = Compare(str0.Data(), "0.1 1.5 -2 1e+300", 18) &&
+		Compare(str1.Data(), U"3.14159", 8);
+
+	END_TEST;
+}
+
+void StringAppendFormat()
+{
+	BEGIN_TEST;
+
+	String str0("status=");
+	str0.AppendFormat("{} latency_ms={}", 200, 13);
+
+	String str1("abc");
+	str1.AppendFormat("-{}-{}", str1, str1.SubString(1));
+
+	passed = str0.Size() == 24 && Compare(str0.Data(), "status=200 latency_ms=13", 25) &&
+		Compare(str1.Data(), "abc-abc-bc", 11);
+
+	END_TEST;
+}
+
+void StringFormatSpeed()
+{
+	static const char* levels[] = { "INFO", "DEBUG", "WARN", "INFO", "ERROR" };
+	static const char* paths[] = { "/api/v1/orders", "/api/v1/users/me", "/health", "/api/v2/search?q=shoes", "/static/app.js" };
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	String str;
+	for (int i = 0; i < 200000; ++i)
+	{
+		str.AppendFormat("{} [worker-{}] request_id={} path={} status={} latency_ms={} ratio={}\n",
+			levels[i % 5], i % 16, i * 2654435761u, paths[i % 5], i % 97 ? 200 : 404, (i * 7) % 250, i / 7.0);
+	}
+
+	passed = str.Size() > 200000 * 60;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void SnprintfFormatSpeed()
+{
+	static const char* levels[] = { "INFO", "DEBUG", "WARN", "INFO", "ERROR" };
+	static const char* paths[] = { "/api/v1/orders", "/api/v1/users/me", "/health", "/api/v2/search?q=shoes", "/static/app.js" };
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	String str;
+	char line[256];
+	for (int i = 0; i < 200000; ++i)
+	{
+		int length = snprintf(line, sizeof(line), "%s [worker-%d] request_id=%u path=%s status=%d latency_ms=%d ratio=%.17g\n",
+			levels[i % 5], i % 16, i * 2654435761u, paths[i % 5], i % 97 ? 200 : 404, (i * 7) % 250, i / 7.0);
+		str.Append(StringView(line, length));
+	}
+
+	passed = str.Size() > 200000 * 60;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+#pragma endregion
+
+#pragma region String Parse Tests
+
+void StringParseInt()
+{
+	BEGIN_TEST;
+
+	I64 value0 = 0, value1 = 0, value2 = 7;
+	U64 value3 = 0, value4 = 7;
+
+	U64 length0 = StringView("-9223372036854775808,").ParseI64(value0);
+	U64 length1 = String("+12345678901234567 rest").ParseI64(value1);
+	U64 length2 = StringView("9223372036854775808").ParseI64(value2);
+	U64 length3 = StringView16(u"18446744073709551615").ParseU64(value3);
+	U64 length4 = StringView("-1").ParseU64(value4);
+
+	passed = length0 == 20 && value0 == I64_MIN &&
+		length1 == 18 && value1 == 12345678901234567 &&
+		length2 == 0 && value2 == 7 &&
+		length3 == 20 && value3 == U64_MAX &&
+		length4 == 0 && value4 == 7;
+
+	END_TEST;
+}
+
+void StringParseFloat()
+{
+	BEGIN_TEST;
+
+	F64 value0 = 0.0, value1 = 0.0, value2 = 0.0, value3 = 0.0, value4 = 7.0, value5 = 0.0, value6 = 0.0, value7 = 0.0;
+
+	U64 length0 = StringView("3.14159,").ParseF64(value0);
+	U64 length1 = StringView("-1.5e-3x").ParseF64(value1);
+	U64 length2 = StringView("2.2250738585072011e-308").ParseF64(value2);
+	U64 length3 = StringView32(U"1e").ParseF64(value3);
+	U64 length4 = StringView(".e5").ParseF64(value4);
+	U64 length5 = StringView("9007199254740993").ParseF64(value5);
+	U64 length6 = StringView("7.2057594037927933e16").ParseF64(value6);
+	U64 length7 = StringView("2.47032822920623272088284396434110686182529901307162382212792841250337753635104375932649918180817996189898282347722858865463328355177969898199387398005390939063150356595155702263922908583924491051844359318028499365361525003193704576782492193656236698636584807570015857692699037063119282795585513329278343384093519780155312465972635795746227664652728272200563740064854999770965994704540208281662262378573934507363390079677619305775067401763246736009689513405355374585166611342237666786041621596804619144672918403005300575308490487653917113865916462395249126236538818796362393732804238910186723484976682350898633885879256283027559956575244555072551893136908362547791869486679949683240497058210285131854513962138377228261454376934125320985913276672363281255e-324").ParseF64(value7);
+
+	passed = length0 == 7 && value0 == 3.14159 &&
+		length1 == 7 && value1 == -1.5e-3 &&
+		length2 == 23 && value2 == 2.2250738585072011e-308 &&
+		length3 == 1 && value3 == 1.0 &&
+		length4 == 0 && value4 == 7.0 &&
+		length5 == 16 && value5 == 9007199254740992.0 &&
+		length6 == 21 && value6 == 7.2057594037927933e16 &&
+		length7 == 759 && value7 == 4.9406564584124654e-324;
+
+	END_TEST;
+}
+
+void StringParseHex()
+{
+	BEGIN_TEST;
+
+	I64 value0 = 0;
+	U64 value1 = 0, value2 = 0, value3 = 7;
+
+	U64 length0 = StringView("-0x7F;").ParseHexI64(value0);
+	U64 length1 = StringView("DeadBeef").ParseHexU64(value1);
+	U64 length2 = StringView("0xg").ParseHexU64(value2);
+	U64 length3 = StringView("10000000000000000").ParseHexU64(value3);
+
+	passed = length0 == 5 && value0 == -127 &&
+		length1 == 8 && value1 == 0xDEADBEEF &&
+		length2 == 1 && value2 == 0 &&
+		length3 == 0 && value3 == 7;
+
+	END_TEST;
+}
+
+static std::string NumberText()
+{
+	std::string text;
+	text.reserve(16 * 1024 * 1024);
+
+	char line[128];
+	for (int i = 0; i < 250000; ++i)
+	{
+		snprintf(line, sizeof(line), "%u,%d,%.6f,%.17g\n", i * 2654435761u, (int)(i * 40503u % 2000000000u) - 1000000000, i / 3.0, i * 1.0e-7);
+		text += line;
+	}
+
+	return text;
+}
+
+void StringParseSpeed()
+{
+	std::string text = NumberText();
+	StringView view(text.c_str(), text.size());
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 sum = 0;
+	F64 total = 0.0;
+
+	for (U64 i = 0; i < view.Size();)
+	{
+		U64 u; I64 s; F64 f0, f1;
+
+		i += view.SubString(i).ParseU64(u) + 1;
+		i += view.SubString(i).ParseI64(s) + 1;
+		i += view.SubString(i).ParseF64(f0) + 1;
+		i += view.SubString(i).ParseF64(f1) + 1;
+
+		sum += u + (U64)s;
+		total += f0 + f1;
+	}
+
+	passed = sum != 0 && total > 0.0;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void StrtodParseSpeed()
+{
+	std::string text = NumberText();
+	StringView view(text.c_str(), text.size());
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 sum = 0;
+	F64 total = 0.0;
+	char field[64];
+
+	auto next = [&](U64& i) {
+		U64 start = i;
+		while (i < view.Size() && view[i] != ',' && view[i] != '\n') { ++i; }
+		memcpy(field, view.Data() + start, i - start);
+		field[i - start] = '\0';
+		++i;
+		return field;
+	};
+
+	for (U64 i = 0; i < view.Size();)
+	{
+		U64 u = strtoull(next(i), nullptr, 10);
+		I64 s = strtoll(next(i), nullptr, 10);
+		F64 f0 = strtod(next(i), nullptr);
+		F64 f1 = strtod(next(i), nullptr);
+
+		sum += u + (U64)s;
+		total += f0 + f1;
+	}
+
+	passed = sum != 0 && total > 0.0;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+#pragma endregion
+
+#pragma region String Transcode Tests
+
+void StringToUtf8()
+{
+	BEGIN_TEST;
+
+	String16 str0(u"Grüße, 東京 😀!");
+	String32 str1(U"Grüße, 東京 😀!");
+	String str2("plain ascii text that is longer than one block");
+
+	String8 str3 = str0.ToUtf8();
+	String8 str4 = str1.ToUtf8();
+	String str5 = str2.ToUtf8().Transcode<char>();
+
+	passed = str3.Size() == 21 && Compare(str3.Data(), u8"Grüße, 東京 😀!", 22) &&
+		str4.Size() == 21 && Compare(str4.Data(), u8"Grüße, 東京 😀!", 22) &&
+		str5.Size() == str2.Size() && Compare(str5.Data(), str2.Data(), str2.Size() + 1);
+
+	END_TEST;
+}
+
+void StringToUtf16()
+{
+	BEGIN_TEST;
+
+	String8 str0(u8"Grüße, 東京 😀! and some ascii after it");
+	String32 str1(U"Grüße, 東京 😀! and some ascii after it");
+
+	String16 str2 = str0.ToUtf16();
+	String16 str3 = str1.ToUtf16();
+
+	passed = str2.Size() == 37 && Compare(str2.Data(), u"Grüße, 東京 😀! and some ascii after it", 38) &&
+		str3.Size() == 37 && Compare(str3.Data(), u"Grüße, 東京 😀! and some ascii after it", 38);
+
+	END_TEST;
+}
+
+void StringToUtf32()
+{
+	BEGIN_TEST;
+
+	String str0("Grüße, 東京 😀!");
+	String16 str1(u"Grüße, 東京 😀!");
+
+	String32 str2 = str0.ToUtf32();
+	String32 str3 = str1.ToUtf32();
+
+	passed = str2.Size() == 12 && Compare(str2.Data(), U"Grüße, 東京 😀!", 13) &&
+		str3.Size() == 12 && Compare(str3.Data(), U"Grüße, 東京 😀!", 13);
+
+	END_TEST;
+}
+
+void StringValidUtf()
+{
+	BEGIN_TEST;
+
+	const char16_t unpaired[] = { u'a', (char16_t)0xD800, u'b', 0 };
+
+	bool valid0 = StringView("Grüße, 東京 😀!").ValidUtf();
+	bool valid1 = StringView("\xC0\x80").ValidUtf();
+	bool valid2 = StringView("\xED\xA0\x80").ValidUtf();
+	bool valid3 = StringView("\xF4\x90\x80\x80").ValidUtf();
+	bool valid4 = StringView("truncated \xE2\x82").ValidUtf();
+	bool valid5 = StringView16(unpaired).ValidUtf();
+	String16 str0 = StringView("\x80 stray continuation").ToUtf16();
+
+	passed = valid0 && !valid1 && !valid2 && !valid3 && !valid4 && !valid5 && str0.Size() == 0;
+
+	END_TEST;
+}
+
+static std::string MixedText()
+{
+	std::string text = LogText();
+
+	for (U64 i = 0; i < text.size(); i += 4096) { text.insert(i, "user=\"José Müller\" city=東京 mood=😀 "); }
+
+	return text;
+}
+
+void StringTranscodeSpeed()
+{
+	std::string text = MixedText();
+	String str(text.c_str(), text.size());
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 size = 0;
+	for (int i = 0; i < 5; ++i)
+	{
+		String16 wide = str.ToUtf16();
+		String8 narrow = wide.ToUtf8();
+		size += narrow.Size();
+	}
+
+	passed = size == text.size() * 5;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void MultiByteTranscodeSpeed()
+{
+	std::string text = MixedText();
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 size = 0;
+	for (int i = 0; i < 5; ++i)
+	{
+		int wideSize = MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, text.c_str(), (int)text.size(), nullptr, 0);
+		std::wstring wide(wideSize, L'\0');
+		MultiByteToWideChar(CP_UTF8, MB_ERR_INVALID_CHARS, text.c_str(), (int)text.size(), wide.data(), wideSize);
+
+		int narrowSize = WideCharToMultiByte(CP_UTF8, WC_ERR_INVALID_CHARS, wide.c_str(), wideSize, nullptr, 0, nullptr, nullptr);
+		std::string narrow(narrowSize, '\0');
+		WideCharToMultiByte(CP_UTF8, WC_ERR_INVALID_CHARS, wide.c_str(), wideSize, narrow.data(), narrowSize, nullptr, nullptr);
+		size += narrow.size();
+	}
+
+	passed = size == text.size() * 5;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+#pragma endregion
+
+#pragma region Hash Tests
+
+void HashStrings()
+{
+	BEGIN_TEST;
+
+	String str0("request_id=deadbeef");
+	StringView view0("request_id=deadbeef");
+	String16 str1(u"request_id=deadbeef");
+
+	U64 hash0 = Hash(str0);
+	U64 hash1 = Hash(view0);
+	U64 hash2 = Hash("request_id=deadbeef");
+	U64 hash3 = Hash(str0, 1);
+	U64 hash4 = Hash(str1);
+	U64 hash5 = Hash(StringView("request_id=deadbeeg"));
+	U64 hash6 = Hash(StringView(""));
+
+	passed = hash0 == hash1 && hash0 == hash2 && hash0 != hash3 && hash0 != hash4 && hash0 != hash5 && hash6 != hash0;
+
+	END_TEST;
+}
+
+void HashTrivial()
+{
+	struct Key
+	{
+		U32 a;
+		U32 b;
+		U64 c;
+	};
+
+	BEGIN_TEST;
+
+	Key key0{ 1, 2, 3 };
+	Key key1{ 1, 2, 3 };
+	Key key2{ 2, 1, 3 };
+
+	U64 hash0 = Hash(key0);
+	U64 hash1 = Hash(key1);
+	U64 hash2 = Hash(key2);
+	U64 hash3 = Hash(42);
+	U64 hash4 = Hash(43);
+	U64 hash5 = Hash(42ULL);
+	U64 hash6 = HashCombine(HashCombine(0, Hash(1U)), Hash(2U));
+	U64 hash7 = HashCombine(HashCombine(0, Hash(2U)), Hash(1U));
+
+	passed = hash0 == hash1 && hash0 != hash2 && hash3 != hash4 && hash3 != hash5 && hash6 != hash7;
+
+	END_TEST;
+}
+
+void HashCached()
+{
+	BEGIN_TEST;
+
+	Hashed<String> hashed0(String("cached key"));
+	Hashed<U64> hashed1(12345ULL);
+
+	passed = Hash(hashed0) == Hash(StringView("cached key")) && hashed0.Hash() == Hash(String("cached key")) &&
+		Hash(hashed1) == Hash(12345ULL) && Hasher<Hashed<U64>>()(hashed1) == hashed1.Hash() &&
+		hashed0.Value().Size() == 10;
+
+	END_TEST;
+}
+
+void HashDistribution()
+{
+	BEGIN_TEST;
+
+	//Sequential keys should spread evenly over the low bits
+	U32 buckets[256] = {};
+	for (U64 i = 0; i < 256 * 1024; ++i) { ++buckets[Hash(i) & 255]; }
+
+	U32 min = U32_MAX, max = 0;
+	for (U32 count : buckets) { min = count < min ? count : min; max = count > max ? count : max; }
+
+	passed = min > 900 && max < 1150;
+
+	END_TEST;
+}
+
+template<U64 Bytes>
+void HashSpeed()
+{
+	std::string text = LogText();
+	const char* data = text.c_str();
+	constexpr U64 count = (64 * 1024 * 1024) / Bytes;
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 result = 0;
+	for (U64 i = 0; i < count; ++i) { result += Hash(StringView(data + (i & 1023), Bytes)); }
+
+	passed = result != 0;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+template<U64 Bytes>
+void STLHashSpeed()
+{
+	std::string text = LogText();
+	const char* data = text.c_str();
+	constexpr U64 count = (64 * 1024 * 1024) / Bytes;
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 result = 0;
+	for (U64 i = 0; i < count; ++i) { result += std::hash<std::string_view>()(std::string_view(data + (i & 1023), Bytes)); }
+
+	passed = result != 0;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+#pragma endregion
+
+#pragma region String Split Tests
+
+void StringSplit()
+{
+	BEGIN_TEST;
+
+	String str0("a,b,,c,");
+	StringView16 view0(u"key=value; other = 2");
+
+	StringView fields0[8];
+	U64 count0 = 0;
+	for (StringView field : str0.Split(',')) { if (count0 < 8) { fields0[count0] = field; } ++count0; }
+
+	StringView16 fields1[8];
+	U64 count1 = 0;
+	for (StringView16 field : view0.Split(u"=;")) { if (count1 < 8) { fields1[count1] = field; } ++count1; }
+
+	passed = count0 == 5 && fields0[0].Size() == 1 && fields0[0][0] == 'a' && fields0[2].Size() == 0 && fields0[3][0] == 'c' && fields0[4].Size() == 0 &&
+		fields0[1].Data() == str0.Data() + 2 &&
+		count1 == 4 && fields1[1].Size() == 5 && Compare(fields1[1].Data(), u"value", 5) && fields1[3].Size() == 2 && fields1[3][1] == u'2';
+
+	END_TEST;
+}
+
+void StringSplitLines()
+{
+	BEGIN_TEST;
+
+	StringView view0("first\r\nsecond\n\nfourth\n");
+
+	StringView lines[8];
+	U64 count = 0;
+	for (StringView line : view0.SplitLines()) { if (count < 8) { lines[count] = line; } ++count; }
+
+	passed = count == 4 && lines[0].Size() == 5 && Compare(lines[0].Data(), "first", 5) &&
+		lines[1].Size() == 6 && lines[2].Size() == 0 && Compare(lines[3].Data(), "fourth", 6);
+
+	END_TEST;
+}
+
+void StringTokenize()
+{
+	BEGIN_TEST;
+
+	StringView view0("  GET   /index.html\tHTTP/1.1  ");
+
+	StringView tokens[8];
+	U64 count = 0;
+	for (StringView token : view0.Tokenize(" \t")) { if (count < 8) { tokens[count] = token; } ++count; }
+
+	passed = count == 3 && Compare(tokens[0].Data(), "GET", 3) && tokens[1].Size() == 11 && Compare(tokens[2].Data(), "HTTP/1.1", 8);
+
+	END_TEST;
+}
+
+void StringSplitInto()
+{
+	BEGIN_TEST;
+
+	String str0("a b\tc");
+	Vector<StringView> fields;
+
+	U64 count0 = StringView("2024-03-05,INFO,worker-3,,200").SplitInto(fields, ',');
+	U64 count1 = str0.SplitInto(fields, StringView(" \t"));
+
+	passed = count0 == 5 && count1 == 3 && fields.Size() == 8 &&
+		Compare(fields[2].Data(), "worker-3", 8) && fields[3].Size() == 0 && fields[7][0] == 'c';
+
+	END_TEST;
+}
+
+void StringSplitSpeed()
+{
+	std::string text = NumberText();
+	String str(text.c_str(), text.size());
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 fields = 0;
+	U64 characters = 0;
+
+	for (int i = 0; i < 4; ++i)
+	{
+		for (StringView line : str.SplitLines())
+		{
+			for (StringView field : line.Split(','))
+			{
+				++fields;
+				characters += field.Size();
+			}
+		}
+	}
+
+	passed = fields == 250000 * 4 * 4 && characters + fields == text.size() * 4;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void STLSplitSpeed()
+{
+	std::string text = NumberText();
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 fields = 0;
+	U64 characters = 0;
+
+	for (int i = 0; i < 4; ++i)
+	{
+		for (size_t start = 0, newline; start < text.size(); start = newline + 1)
+		{
+			newline = text.find('\n', start);
+			std::string line = text.substr(start, newline - start);
+
+			for (size_t begin = 0, comma = 0; comma != std::string::npos; begin = comma + 1)
+			{
+				comma = line.find(',', begin);
+				std::string field = line.substr(begin, comma == std::string::npos ? std::string::npos : comma - begin);
+				++fields;
+				characters += field.size();
+			}
+		}
+	}
+
+	passed = fields == 250000 * 4 * 4 && characters + fields == text.size() * 4;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+#pragma endregion
+
+#pragma region String Compare Tests
+
+void StringEquality()
+{
+	BEGIN_TEST;
+
+	String a("Content-Length");
+	String b("Content-Length");
+	String c("Content-Type");
+	StringView view("Content-Length");
+	String16 wide(u"Content-Length");
+	String empty;
+
+	passed = a == b && a == view && view == a && a == "Content-Length" && "Content-Length" == a &&
+		a != c && a != "Content-Lengt" && a != "Content-Length!" && wide == u"Content-Length" &&
+		empty == "" && empty == StringView() && StringView() == (const char*)nullptr && empty != a;
+
+	END_TEST;
+}
+
+void StringOrdering()
+{
+	BEGIN_TEST;
+
+	String apple("apple");
+	String apples("apples");
+	String banana("banana");
+	String upper("Banana");
+	String high("\xE9t\xE9");
+	String32 wide(U"\U0001F600");
+	String32 narrow(U"é");
+
+	passed = apple < apples && apples < banana && upper < apple && apple < high &&
+		apple.Compare(apples) < 0 && banana.Compare(apple) > 0 && apple.Compare("apple") == 0 &&
+		(apple <=> StringView("apple")) == std::strong_ordering::equal && narrow < wide &&
+		StringView("abc") < "abd" && StringView("") < "a" && !(StringView("b") < "a");
+
+	END_TEST;
+}
+
+void StringEqualsIgnoreCase()
+{
+	BEGIN_TEST;
+
+	String header("Content-Type: Text/HTML; Charset=UTF-8 and some trailing text past a block");
+	String16 wide(u"Content-Type: Text/HTML; Charset=UTF-8 and some trailing text past a block");
+
+	passed = header.EqualsIgnoreCase("content-type: text/html; charset=utf-8 AND SOME TRAILING TEXT PAST A BLOCK") &&
+		wide.EqualsIgnoreCase(u"CONTENT-TYPE: TEXT/HTML; CHARSET=UTF-8 and some trailing text past a block") &&
+		!header.EqualsIgnoreCase("content-type: text/html; charset=utf-8 and some trailing text past a bloc") &&
+		!header.EqualsIgnoreCase("content-type: text/html; charset=utf-8 and some trailing text past a blocK ") &&
+		!StringView("@[`{").EqualsIgnoreCase("`{@[") && StringView("").EqualsIgnoreCase("");
+
+	END_TEST;
+}
+
+void StringIndexOfIgnoreCase()
+{
+	BEGIN_TEST;
+
+	String text("GET /index.html HTTP/1.1\r\nHost: example.com\r\nACCEPT-ENCODING: gzip\r\naccept: */*\r\n");
+	String16 wide(u"GET /index.html HTTP/1.1\r\nHost: example.com\r\nACCEPT-ENCODING: gzip\r\naccept: */*\r\n");
+
+	passed = text.IndexOfIgnoreCase("host:") == 26 && text.IndexOfIgnoreCase("Accept-Encoding") == 45 &&
+		text.IndexOfIgnoreCase("Accept:") == 68 && text.IndexOfIgnoreCase("accept", 46) == 68 &&
+		text.IndexOfIgnoreCase("CONNECTION") == -1 && text.IndexOfIgnoreCase("") == 0 &&
+		text.IndexOfIgnoreCase("get", text.Size() + 1) == -1 && wide.IndexOfIgnoreCase(u"HOST: EXAMPLE") == 26;
+
+	END_TEST;
+}
+
+void StringIgnoreCaseSpeed()
+{
+	std::string text = LogText();
+	String str(text.c_str(), text.size());
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 found = 0;
+	U64 equal = 0;
+
+	for (int i = 0; i < 4; ++i)
+	{
+		for (StringView line : str.SplitLines())
+		{
+			if (line.IndexOfIgnoreCase("ERROR") != -1) { ++found; }
+			if (line.EqualsIgnoreCase(line)) { ++equal; }
+		}
+	}
+
+	passed = found > 0 && equal > found;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void STLIgnoreCaseSpeed()
+{
+	std::string text = LogText();
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 found = 0;
+	U64 equal = 0;
+	auto lower = [](char c) { return c >= 'A' && c <= 'Z' ? (char)(c + 32) : c; };
+
+	for (int i = 0; i < 4; ++i)
+	{
+		for (size_t start = 0, newline; start < text.size(); start = newline + 1)
+		{
+			newline = text.find('\n', start);
+			std::string line = text.substr(start, newline - start);
+
+			auto hit = std::search(line.begin(), line.end(), "ERROR", "ERROR" + 5, [&](char a, char b) { return lower(a) == lower(b); });
+			if (hit != line.end()) { ++found; }
+			if (std::equal(line.begin(), line.end(), line.begin(), line.end(), [&](char a, char b) { return lower(a) == lower(b); })) { ++equal; }
+		}
+	}
+
+	passed = found > 0 && equal > found;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+#pragma endregion
+
+#pragma region Shared String Tests
+
+void SharedStringInit()
+{
+	BEGIN_TEST;
+
+	SharedString str0("Hello, World!");
+	SharedString8 str1(u8"Hello, World!");
+	SharedString16 str2(u"Hello, World!");
+	SharedString32 str3(U"Hello, World!");
+	SharedStringW str4(L"Hello, World!");
+	SharedString empty;
+	SharedString blank("");
+
+	passed = str0.Size() == 13 && Compare(str0.Data(), "Hello, World!", 14) && str0.References() == 1 &&
+		str1.Size() == 13 && Compare(str1.Data(), u8"Hello, World!", 14) &&
+		str2.Size() == 13 && Compare(str2.Data(), u"Hello, World!", 14) &&
+		str3.Size() == 13 && Compare(str3.Data(), U"Hello, World!", 14) &&
+		str4.Size() == 13 && Compare(str4.Data(), L"Hello, World!", 14) &&
+		empty.Size() == 0 && empty.References() == 0 && blank.Size() == 0 && empty == blank && empty == "";
+
+	END_TEST;
+}
+
+void SharedStringAdopt()
+{
+	BEGIN_TEST;
+
+	String big("payload");
+	const char* bigData = big.Data();
+	SharedString fromBig(std::move(big));
+
+	String exact(1023);
+	for (U64 i = 0; i < 1023; ++i) { exact.Data()[i] = 'a' + i % 26; }
+	exact.Data()[1023] = '\0';
+	U64 exactCapacity = exact.Capacity();
+	SharedString fromExact = std::move(exact);
+
+	String16 wide(u"payload");
+	const char16_t* wideData = wide.Data();
+	SharedString16 fromWide(std::move(wide));
+
+	passed = fromBig.Data() == bigData && fromBig == "payload" && big.Size() == 0 && big.Data() == nullptr &&
+		exactCapacity == 1024 && fromExact.Size() == 1023 && fromExact[1022] == 'a' + 1022 % 26 && fromExact.Data()[1023] == '\0' && fromExact.References() == 1 &&
+		fromWide.Data() == wideData && fromWide == u"payload";
+
+	END_TEST;
+}
+
+void SharedStringCopy()
+{
+	BEGIN_TEST;
+
+	SharedString a("a shared payload");
+	SharedString b = a;
+	SharedString c;
+	c = b;
+	U64 three = a.References();
+
+	SharedString d = std::move(c);
+	b = nullptr;
+	U64 two = a.References();
+
+	SharedString e("another payload");
+	e = a;
+	e = e;
+
+	passed = three == 3 && two == 2 && d.Data() == a.Data() && c.Data() == nullptr && b.Size() == 0 &&
+		e.Data() == a.Data() && a.References() == 3 && e == "a shared payload";
+
+	END_TEST;
+}
+
+void SharedStringSlice()
+{
+	BEGIN_TEST;
+
+	SharedString line("GET /index.html HTTP/1.1");
+	StringView method = line.SubString(0, 3);
+	StringView path = line.SubString(4, 11);
+	StringView version = line.SubString(line.IndexOf(' ', 4) + 1);
+
+	U64 fields = 0;
+	for (StringView field : line.Split(' ')) { fields += field.Size() > 0; }
+
+	String copy = line.ToString();
+	copy.ToLower();
+
+	passed = method == "GET" && method.Data() == line.Data() && path == "/index.html" && version == "HTTP/1.1" && fields == 3 &&
+		line.Contains("index") && line.IndexOfIgnoreCase("http") == 16 && line < "POST" && copy == "get /index.html http/1.1" &&
+		line == "GET /index.html HTTP/1.1" && Hash(line) == Hash(StringView("GET /index.html HTTP/1.1"));
+
+	END_TEST;
+}
+
+void SharedStringThreads()
+{
+	BEGIN_TEST;
+
+	SharedString payload(std::move(String(StringView("shared across threads"))));
+	std::atomic<U64> matches = 0;
+	std::vector<std::thread> threads;
+
+	for (int t = 0; t < 8; ++t)
+	{
+		threads.emplace_back([&payload, &matches]()
+			{
+				for (int i = 0; i < 10000; ++i)
+				{
+					SharedString copy = payload;
+					if (copy == "shared across threads") { ++matches; }
+				}
+			});
+	}
+
+	for (std::thread& thread : threads) { thread.join(); }
+
+	passed = matches == 80000 && payload.References() == 1;
+
+	END_TEST;
+}
+
+void SharedStringHandOffSpeed()
+{
+	std::string text = LogText();
+	SharedString payload(StringView(text.c_str(), text.size()));
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 total = 0;
+	SharedString stage = payload;
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		SharedString next = stage;
+		total += next.Size();
+		stage = next;
+	}
+
+	passed = total == text.size() * 1000;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void StringHandOffSpeed()
+{
+	std::string text = LogText();
+	String payload(text.c_str(), text.size());
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 total = 0;
+	String stage = payload;
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		String next = stage;
+		total += next.Size();
+		stage = next;
+	}
+
+	passed = total == text.size() * 1000;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+#pragma endregion
+
+#pragma region Pattern Set Tests
+
+static Vector<String> Keywords(U64 count)
+{
+	static const char* tokens[] = { "ERROR", "worker-3", "status=404", "/health", "latency_ms=9", "deadbeef", "method=GET", "shoes" };
+
+	Vector<String> keywords(count);
+	U32 seed = 2463534242u;
+
+	for (U64 i = 0; i < count; ++i)
+	{
+		if (i < 8) { keywords.Push(String(tokens[i])); continue; }
+
+		char word[32];
+		U64 size = 0;
+		seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+		for (U32 letters = 3 + seed % 4; letters; --letters) { word[size++] = 'a' + (seed >> (letters * 5)) % 26; }
+		for (U64 rest = i; rest; rest /= 26) { word[size++] = 'a' + rest % 26; }
+
+		keywords.Push(String(word, size));
+	}
+
+	return keywords;
+}
+
+void PatternSetBasic()
+{
+	BEGIN_TEST;
+
+	Vector<String> patterns;
+	patterns.Push(String("he"));
+	patterns.Push(String("she"));
+	patterns.Push(String("his"));
+	patterns.Push(String("hers"));
+
+	PatternSet set(patterns);
+	Vector<PatternMatch> matches;
+	U64 count = set.FindAll("ushers", matches);
+
+	passed = count == 3 && matches[0] == PatternMatch{ 1, 1 } && matches[1] == PatternMatch{ 2, 0 } && matches[2] == PatternMatch{ 2, 3 } &&
+		set.PatternCount() == 4 && set.ContainsAny("this") && !set.ContainsAny("xyz");
+
+	END_TEST;
+}
+
+void PatternSetEdgeCases()
+{
+	BEGIN_TEST;
+
+	Vector<String> patterns;
+	patterns.Push(String(""));
+	patterns.Push(String("aa"));
+	patterns.Push(String("aa"));
+	patterns.Push(String("a"));
+
+	PatternSet set(patterns);
+	PatternSet none(Vector<String>{});
+	Vector<PatternMatch> matches;
+
+	U64 empty = set.FindAll("", matches);
+	U64 overlapping = set.FindAll("aaa", matches);
+	bool lowest = matches[1] == PatternMatch{ 0, 1 } && matches[3] == PatternMatch{ 1, 1 };
+	U64 reused = set.FindAll("ba", matches);
+	U64 nothing = none.FindAll("aaa", matches);
+
+	PatternSet moved(std::move(set));
+
+	passed = empty == 0 && overlapping == 5 && lowest && reused == 1 && matches.Size() == 0 && nothing == 0 &&
+		moved.ContainsAny("xa") && set.StateCount() == 0;
+
+	END_TEST;
+}
+
+void PatternSetWide()
+{
+	BEGIN_TEST;
+
+	Vector<String16> patterns;
+	patterns.Push(String16(u"日本"));
+	patterns.Push(String16(u"本語"));
+	patterns.Push(String16(u"語"));
+	patterns.Push(String16(u"の\U0001F600"));
+
+	PatternSet16 set(patterns);
+	Vector<PatternMatch> matches;
+	U64 count = set.FindAll(u"日本語の\U0001F600日本", matches);
+
+	passed = count == 5 && matches[0] == PatternMatch{ 0, 0 } && matches[1] == PatternMatch{ 1, 1 } && matches[2] == PatternMatch{ 2, 2 } &&
+		matches[3] == PatternMatch{ 3, 3 } && matches[4] == PatternMatch{ 6, 0 };
+
+	END_TEST;
+}
+
+void PatternSetMatchesSearch()
+{
+	std::string text = LogText();
+	String str(text.c_str(), 200000);
+	Vector<String> keywords = Keywords(1000);
+
+	BEGIN_TEST;
+
+	PatternSet set(keywords);
+	Vector<PatternMatch> matches;
+	set.FindAll(str, matches);
+
+	U64 expected = 0;
+	for (const String& keyword : keywords)
+	{
+		for (I64 hit = str.IndexOf(keyword); hit != -1; hit = str.IndexOf(keyword, hit + 1)) { ++expected; }
+	}
+
+	bool verified = true;
+	for (const PatternMatch& match : matches) { verified &= str.SubString(match.offset, keywords[match.pattern].Size()) == keywords[match.pattern]; }
+
+	passed = matches.Size() == expected && expected > 0 && verified;
+
+	END_TEST;
+}
+
+template<U64 Patterns>
+void PatternSetSpeed()
+{
+	std::string text = LogText();
+	String str(text.c_str(), text.size());
+	PatternSet set(Keywords(Patterns));
+	Vector<PatternMatch> matches;
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 found = 0;
+	for (int i = 0; i < 4; ++i) { found += set.FindAll(str, matches); }
+
+	passed = found > 0;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+template<U64 Patterns>
+void IndexOfLoopSpeed()
+{
+	std::string text = LogText();
+	String str(text.c_str(), text.size());
+	Vector<String> keywords = Keywords(Patterns);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 found = 0;
+	for (int i = 0; i < 4; ++i)
+	{
+		for (const String& keyword : keywords)
+		{
+			for (I64 hit = str.IndexOf(keyword); hit != -1; hit = str.IndexOf(keyword, hit + 1)) { ++found; }
+		}
+	}
+
+	passed = found > 0;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+#pragma endregion
+
+#pragma region String Encoding Tests
+
+static Vector<U8> RandomBytes(U64 count)
+{
+	Vector<U8> bytes(count);
+	bytes.Resize(count);
+
+	U32 seed = 2463534242u;
+	for (U64 i = 0; i < count; ++i) { seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5; bytes[i] = (U8)seed; }
+
+	return bytes;
+}
+
+void StringBase64Encode()
+{
+	BEGIN_TEST;
+
+	String empty = String::EncodeBase64("", 0);
+	String f = String::EncodeBase64("f", 1);
+	String fo = String::EncodeBase64("fo", 2);
+	String foo = String::EncodeBase64("foo", 3);
+	String foobar = String::EncodeBase64("foobar", 6);
+	String16 wide = String16::EncodeBase64("fooba", 5);
+
+	String appended("data:");
+	appended.AppendBase64("\xFB\xFF\xBF", 3);
+
+	passed = empty.Size() == 0 && f == "Zg==" && fo == "Zm8=" && foo == "Zm9v" && foobar == "Zm9vYmFy" && wide == u"Zm9vYmE=" &&
+		appended == "data:+/+/";
+
+	END_TEST;
+}
+
+void StringBase64Decode()
+{
+	BEGIN_TEST;
+
+	Vector<U8> bytes;
+	bool valid = StringView("Zm9vYmE=").DecodeBase64(bytes) && bytes.Size() == 5 && Compare((const char*)bytes.Data(), "fooba", 5) &&
+		StringView("Zg==").DecodeBase64(bytes) && bytes.Size() == 1 && bytes[0] == 'f' &&
+		StringView("").DecodeBase64(bytes) && bytes.Size() == 0 &&
+		String16(u"+/+/").DecodeBase64(bytes) && bytes.Size() == 3 && bytes[0] == 0xFB && bytes[2] == 0xBF;
+
+	bool invalid = !StringView("Zm9").DecodeBase64(bytes) && bytes.Size() == 0 &&
+		!StringView("Zm9v YmE=").DecodeBase64(bytes) &&
+		!StringView("Zg=a").DecodeBase64(bytes) &&
+		!StringView("Zh==").DecodeBase64(bytes) &&
+		!StringView("Zm9=Zm9v").DecodeBase64(bytes) &&
+		!StringView("Zm9vYmFyZm9vYmFyZm9vYmFyZm9vYmFy-m9vYmFy").DecodeBase64(bytes);
+
+	passed = valid && invalid;
+
+	END_TEST;
+}
+
+void StringHexEncoding()
+{
+	BEGIN_TEST;
+
+	String hex = String::EncodeHex("\x00\x01\xAB\xFF", 4);
+	String8 hex8 = String8::EncodeHex("\xDE\xAD", 2);
+
+	Vector<U8> bytes;
+	bool upper = StringView("DEADbeef").DecodeHex(bytes) && bytes.Size() == 4 && bytes[0] == 0xDE && bytes[3] == 0xEF;
+	bool invalid = !StringView("abc").DecodeHex(bytes) && !StringView("0g").DecodeHex(bytes) && bytes.Size() == 0;
+
+	passed = hex == "0001abff" && hex8 == u8"dead" && upper && invalid;
+
+	END_TEST;
+}
+
+void StringEncodeRoundTrip()
+{
+	Vector<U8> source = RandomBytes(4099);
+
+	BEGIN_TEST;
+
+	bool matches = true;
+	Vector<U8> decoded;
+
+	for (U64 size = 0; size < 4099; size += 37)
+	{
+		String base64 = String::EncodeBase64(source.Data(), size);
+		String hex = String::EncodeHex(source.Data(), size);
+
+		matches &= base64.Size() == (size + 2) / 3 * 4 && base64.DecodeBase64(decoded) && decoded.Size() == size && (size == 0 || Compare(decoded.Data(), source.Data(), size));
+		matches &= hex.Size() == size * 2 && hex.DecodeHex(decoded) && decoded.Size() == size && (size == 0 || Compare(decoded.Data(), source.Data(), size));
+	}
+
+	passed = matches;
+
+	END_TEST;
+}
+
+void StringBase64Speed()
+{
+	Vector<U8> source = RandomBytes(8 * 1024 * 1024);
+	Vector<U8> decoded;
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 total = 0;
+	for (int i = 0; i < 4; ++i)
+	{
+		String encoded = String::EncodeBase64(source.Data(), source.Size());
+		total += encoded.DecodeBase64(decoded) ? decoded.Size() : 0;
+	}
+
+	passed = total == source.Size() * 4;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void ScalarBase64Speed()
+{
+	static const char alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	Vector<U8> source = RandomBytes(8 * 1024 * 1024);
+	U8 values[256];
+	memset(values, 0xFF, sizeof(values));
+	for (U8 i = 0; i < 64; ++i) { values[(U8)alphabet[i]] = i; }
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 total = 0;
+	for (int i = 0; i < 4; ++i)
+	{
+		std::string encoded;
+		const U8* in = source.Data();
+		for (U64 j = 0; j + 3 <= source.Size(); j += 3)
+		{
+			encoded += alphabet[in[j] >> 2];
+			encoded += alphabet[((in[j] & 3) << 4) | (in[j + 1] >> 4)];
+			encoded += alphabet[((in[j + 1] & 15) << 2) | (in[j + 2] >> 6)];
+			encoded += alphabet[in[j + 2] & 63];
+		}
+
+		std::vector<U8> decoded;
+		U32 bits = 0;
+		int count = 0;
+		for (char c : encoded)
+		{
+			U8 value = values[(U8)c];
+			if (value == 0xFF) { break; }
+			bits = (bits << 6) | value;
+			count += 6;
+			if (count >= 8) { count -= 8; decoded.push_back((U8)(bits >> count)); }
+		}
+
+		total += decoded.size();
+	}
+
+	passed = total == source.Size() / 3 * 3 * 4;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void StringHexSpeed()
+{
+	Vector<U8> source = RandomBytes(8 * 1024 * 1024);
+	Vector<U8> decoded;
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 total = 0;
+	for (int i = 0; i < 4; ++i)
+	{
+		String encoded = String::EncodeHex(source.Data(), source.Size());
+		total += encoded.DecodeHex(decoded) ? decoded.Size() : 0;
+	}
+
+	passed = total == source.Size() * 4;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void ScalarHexSpeed()
+{
+	static const char digits[] = "0123456789abcdef";
+	Vector<U8> source = RandomBytes(8 * 1024 * 1024);
+	U8 values[256] = {};
+	for (U8 i = 0; i < 16; ++i) { values[(U8)digits[i]] = i; }
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 total = 0;
+	for (int i = 0; i < 4; ++i)
+	{
+		std::string encoded;
+		for (U64 j = 0; j < source.Size(); ++j) { encoded += digits[source[j] >> 4]; encoded += digits[source[j] & 15]; }
+
+		std::vector<U8> decoded;
+		for (U64 j = 0; j < encoded.size(); j += 2) { decoded.push_back((U8)((values[(U8)encoded[j]] << 4) | values[(U8)encoded[j + 1]])); }
+
+		total += decoded.size();
+	}
+
+	passed = total == source.Size() * 4;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+#pragma endregion
+
+#pragma region Constexpr Tests
+
+static constexpr Vector<U32> BuildCrcTable()
+{
+	Vector<U32> table(256);
+	table.Resize(256);
+
+	for (U32 i = 0; i < 256; ++i)
+	{
+		U32 crc = i;
+		for (int j = 0; j < 8; ++j) { crc = crc & 1 ? (crc >> 1) ^ 0xEDB88320u : crc >> 1; }
+		table[i] = crc;
+	}
+
+	return table;
+}
+
+static constexpr Vector<U8> BuildHexValues()
+{
+	Vector<U8> values(256, 0xFF);
+
+	for (U8 i = 0; i < 10; ++i) { values['0' + i] = i; }
+	for (U8 i = 0; i < 6; ++i) { values['a' + i] = 10 + i; values['A' + i] = 10 + i; }
+
+	return values;
+}
+
+static constexpr String BuildBanner()
+{
+	String banner("  containers ");
+	banner.Trim().ToUpper();
+	banner.Prepend("[").Append(" v").Append("2]");
+
+	return banner;
+}
+
+static constexpr auto CRC_TABLE = Freeze<BuildCrcTable>();
+static constexpr auto HEX_VALUES = Freeze<BuildHexValues>();
+static constexpr auto BANNER = Freeze<BuildBanner>();
+
+template<class Table>
+static U32 Crc32(const Table& table, const U8* data, U64 size)
+{
+	U32 crc = 0xFFFFFFFFu;
+	for (U64 i = 0; i < size; ++i) { crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8); }
+
+	return ~crc;
+}
+
+void ConstexprStringBuild()
+{
+	BEGIN_TEST;
+
+	constexpr bool built = [] {
+		String str("  hello");
+		str.Append(", world  ").Trim();
+		str.Insert(5, " there");
+		str.ToUpper();
+
+		String copy = str;
+		copy.Erase(5, 6).ReplaceAll("L", "ll");
+
+		return str == "HELLO THERE, WORLD" && str.IndexOf(StringView("WORLD")) == 13 && str.LastIndexOf('L') == 16 &&
+			str.CountOccurrences("L") == 3 && str.EqualsIgnoreCase("hello there, world") && str.IndexOfIgnoreCase("there") == 6 &&
+			copy == "HEllllO, WORllD" && str < copy && !copy.Blank();
+	}();
+
+	constexpr bool view = StringView("  a constant view ").Trimmed() == "a constant view" && StringView("abcabc").IndexOf(StringView("ca")) == 2;
+
+	static_assert(built && view);
+	passed = built && view;
+
+	END_TEST;
+}
+
+void ConstexprVectorBuild()
+{
+	BEGIN_TEST;
+
+	constexpr bool built = [] {
+		Vector<U64> vector{ 1, 2, 3 };
+		for (U64 i = 4; i <= 100; ++i) { vector.Push(i); }
+
+		vector.Insert(0, 0);
+		vector.Remove(50);
+		vector.Pop();
+
+		Vector<U64> copy = vector;
+		copy[0] = 7;
+
+		return vector.Size() == 99 && vector[0] == 0 && vector[49] == 49 && vector[50] == 51 && vector.Back() == 99 &&
+			vector.Contains(51) && !vector.Contains(50) && vector.Find(99) == 98 && vector.Count(7) == 1 && copy != vector && copy.Count(7) == 2;
+	}();
+
+	static_assert(built);
+	passed = built;
+
+	END_TEST;
+}
+
+void FrozenTable()
+{
+	BEGIN_TEST;
+
+	Vector<U32> runtime = BuildCrcTable();
+	const U8 check[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+	static_assert(CRC_TABLE.Size() == 256 && CRC_TABLE[1] == 0x77073096u && CRC_TABLE[255] == 0x2D02EF8Du);
+	static_assert(HEX_VALUES.Size() == 256 && HEX_VALUES['7'] == 7 && HEX_VALUES['c'] == 12 && HEX_VALUES['F'] == 15 && HEX_VALUES['g'] == 0xFF);
+
+	passed = Compare(CRC_TABLE.Data(), runtime.Data(), 256) && Crc32(CRC_TABLE, check, sizeof(check)) == 0xCBF43926u;
+
+	END_TEST;
+}
+
+void FrozenString()
+{
+	BEGIN_TEST;
+
+	StringView view = BANNER;
+	static_assert(StringView(BANNER) == "[CONTAINERS v2]" && BANNER.Size() == 15);
+
+	passed = view == "[CONTAINERS v2]" && BANNER.Data()[BANNER.Size()] == '\0' && strcmp(BANNER.Data(), "[CONTAINERS v2]") == 0;
+
+	END_TEST;
+}
+
+void StartupTableSpeed()
+{
+	Vector<U8> message = RandomBytes(256);
+	const U8 check[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	//Every simulated startup fills its table before doing a little work with it
+	U32 total = 0;
+	bool valid = true;
+	for (int i = 0; i < 10000; ++i)
+	{
+		Vector<U32> table = BuildCrcTable();
+		valid &= Crc32(table, check, sizeof(check)) == 0xCBF43926u;
+		total += Crc32(table, message.Data(), message.Size());
+	}
+
+	passed = valid && total == Crc32(CRC_TABLE, message.Data(), message.Size()) * 10000u;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void FrozenTableSpeed()
+{
+	Vector<U8> message = RandomBytes(256);
+	const U8 check[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U32 total = 0;
+	bool valid = true;
+	for (int i = 0; i < 10000; ++i)
+	{
+		valid &= Crc32(CRC_TABLE, check, sizeof(check)) == 0xCBF43926u;
+		total += Crc32(CRC_TABLE, message.Data(), message.Size());
+	}
+
+	passed = valid && total == Crc32(CRC_TABLE, message.Data(), message.Size()) * 10000u;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+#pragma endregion
+
+#pragma region List Tests
+
+template<typename T>
+static bool ListEquals(const List<T>& list, std::initializer_list<T> values)
+{
+	if (list.Size() != values.size()) { return false; }
+
+	const T* value = values.begin();
+	for (const T& item : list) { if (item != *value++) { return false; } }
+
+	return true;
+}
+
+void ListPushPop()
+{
+	BEGIN_TEST;
+
+	List<int> list;
+	list.PushBack(2);
+	list.PushBack(3);
+	list.PushFront(1);
+	list.PushFront(0);
+
+	bool pushed = ListEquals(list, { 0, 1, 2, 3 }) && list.Front() == 0 && list.Back() == 3;
+
+	list.PopBack();
+	list.PopFront();
+	bool popped = ListEquals(list, { 1, 2 });
+
+	list.PopBack();
+	list.PopBack();
+	list.PopBack();
+
+	passed = pushed && popped && list.Size() == 0 && list.begin() == list.end();
+
+	END_TEST;
+}
+
+void ListInsertRemove()
+{
+	BEGIN_TEST;
+
+	List<int> list;
+	for (int i = 0; i < 6; ++i) { list.PushBack(i * 10); }
+
+	list.Insert(0, -10);
+	list.Insert(3, 15);
+	list.Insert(100, 60);
+
+	List<int>::Iterator it = list.begin() + 2;
+	list.InsertFront(it, 5);
+	list.InsertBack(it, 12);
+
+	bool inserted = ListEquals(list, { -10, 0, 5, 10, 12, 15, 20, 30, 40, 50, 60 });
+
+	it = list.begin() + 1;
+	list.Remove(it);
+	bool advanced = *it == 5;
+
+	list.Remove(0);
+	list.RemoveAll(30);
+	U64 odd = list.RemoveIf([](int value) { return value % 10 != 0; });
+
+	passed = inserted && advanced && odd == 3 && ListEquals(list, { 10, 20, 40, 50, 60 });
+
+	END_TEST;
+}
+
+void ListCopyMove()
+{
+	BEGIN_TEST;
+
+	List<String> list;
+	list.PushBack(String("first"));
+	list.PushBack(String("second"));
+	list.PushBack(String("third"));
+
+	List<String> copy = list;
+	copy.PopFront();
+
+	List<String> moved = std::move(list);
+	List<String> assigned;
+	assigned.PushBack(String("stale"));
+	assigned = copy;
+	copy = std::move(moved);
+
+	passed = list.Size() == 0 && copy.Size() == 3 && copy.Front() == "first" && copy.Back() == "third" &&
+		assigned.Size() == 2 && assigned.Front() == "second" && assigned.Back() == "third";
+
+	END_TEST;
+}
+
+void ListNodeLayout()
+{
+	BEGIN_TEST;
+
+	List<U64> list;
+	list.Reserve(1000);
+	for (U64 i = 0; i < 1000; ++i) { list.PushBack(i); }
+
+	//Nodes appended in order into a reserved slab are adjacent
+	bool contiguous = true;
+	const U64* previous = nullptr;
+	for (const U64& value : list)
+	{
+		if (previous && (const U8*)&value - (const U8*)previous != sizeof(List<U64>::Node)) { contiguous = false; }
+		previous = &value;
+	}
+
+	//Erased nodes are handed out again before the slab grows
+	const U64* front = &list.Front();
+	list.PopFront();
+	list.PushBack(1000);
+	bool recycled = &list.Back() == front;
+
+	//Reserving past a partly used slab fills the new slab first, the old slab's leftovers come after it
+	List<U64> grown;
+	for (U64 i = 0; i < 3; ++i) { grown.PushBack(i); }
+	const U8* third = (const U8*)&grown.Back();
+	grown.Reserve(100);
+	for (U64 i = 0; i < 100; ++i) { grown.PushBack(i); }
+
+	bool reserved = true;
+	previous = nullptr;
+	for (List<U64>::Iterator it = grown.begin() + 3; it != grown.end(); ++it)
+	{
+		if (previous && (const U8*)&*it - (const U8*)previous != sizeof(List<U64>::Node)) { reserved = false; }
+		previous = &*it;
+	}
+
+	grown.PushBack(100);
+	bool leftovers = (const U8*)&grown.Back() - third == sizeof(List<U64>::Node);
+
+	list.Destroy();
+	list.PushBack(7);
+
+	passed = contiguous && recycled && reserved && leftovers && list.Size() == 1 && list.Front() == 7;
+
+	END_TEST;
+}
+
+void ListChurnSpeed()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	//A queue of orders, a fixed amount is in flight while new ones arrive at the back and filled ones leave the front
+	List<U64> orders;
+	for (U64 i = 0; i < 1000; ++i) { orders.PushBack(i); }
+
+	U64 filled = 0;
+	for (U64 i = 1000; i < 10001000; ++i)
+	{
+		filled += orders.Front();
+		orders.PopFront();
+		orders.PushBack(i);
+	}
+
+	passed = orders.Size() == 1000 && filled == 10000000ULL * 9999999ULL / 2;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void STLListChurnSpeed()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	std::list<U64> orders;
+	for (U64 i = 0; i < 1000; ++i) { orders.push_back(i); }
+
+	U64 filled = 0;
+	for (U64 i = 1000; i < 10001000; ++i)
+	{
+		filled += orders.front();
+		orders.pop_front();
+		orders.push_back(i);
+	}
+
+	passed = orders.size() == 1000 && filled == 10000000ULL * 9999999ULL / 2;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void ListSpliceMerge()
+{
+	BEGIN_TEST;
+
+	List<int> list;
+	for (int i = 0; i < 4; ++i) { list.PushBack(i); }
+
+	List<int> middle;
+	middle.PushBack(10);
+	middle.PushBack(11);
+	const int* spliced = &middle.Front();
+
+	List<int>::Iterator it = list.begin() + 2;
+	list.Splice(it, middle);
+
+	//Splicing relinks the nodes, the values stay where they were
+	bool relinked = ListEquals(list, { 0, 1, 10, 11, 2, 3 }) && middle.Size() == 0 && &*(list.begin() + 2) == spliced;
+
+	List<int> back;
+	back.PushBack(20);
+	list.Splice(100, back);
+	List<int> front;
+	front.PushBack(-1);
+	list.Splice(0, front);
+
+	bool ends = ListEquals(list, { -1, 0, 1, 10, 11, 2, 3, 20 }) && list.Back() == 20 && list.Front() == -1;
+
+	List<int> a;
+	List<int> b;
+	for (int value : { 1, 3, 3, 5, 9 }) { a.PushBack(value); }
+	for (int value : { 0, 3, 4, 9, 12, 13 }) { b.PushBack(value); }
+	const int* equal = &*(b.begin() + 1);
+
+	a.Merge(b);
+
+	//The 3 from b goes after both 3s already in a
+	bool merged = ListEquals(a, { 0, 1, 3, 3, 3, 4, 5, 9, 9, 12, 13 }) && b.Size() == 0 && a.Back() == 13 && &*(a.begin() + 4) == equal;
+
+	List<int> descending;
+	for (int value : { 8, 6, 2 }) { descending.PushBack(value); }
+	List<int> other;
+	for (int value : { 7, 1 }) { other.PushBack(value); }
+	descending.Merge(other, [](int x, int y) { return x > y; });
+
+	passed = relinked && ends && merged && ListEquals(descending, { 8, 7, 6, 2, 1 }) && descending.Back() == 1;
+
+	END_TEST;
+}
+
+void ListInsertLists()
+{
+	BEGIN_TEST;
+
+	List<String> list;
+	list.PushBack(String("a"));
+	list.PushBack(String("d"));
+
+	List<String> copied;
+	copied.PushBack(String("b"));
+	copied.PushBack(String("c"));
+
+	List<String>::Iterator it = list.begin();
+	list.InsertBack(it, copied);
+
+	List<String> moved;
+	moved.PushBack(String("e"));
+	List<String>::Iterator last = list.end();
+	list.InsertFront(last, std::move(moved));
+
+	List<String> prefix;
+	prefix.PushBack(String("_"));
+	list.InsertFront(it, std::move(prefix));
+
+	bool inserted = ListEquals<String>(list, { "_", "a", "b", "c", "d", "e" }) && copied.Size() == 2 && moved.Size() == 0;
+
+	//Inserting a list into itself copies it first
+	list.Insert(3, list);
+	bool self = list.Size() == 12 && ListEquals<String>(copied, { "b", "c" }) && *(list.begin() + 3) == "_" && *(list.begin() + 8) == "e" && list.Back() == "e";
+
+	List<String>::Iterator first = list.begin() + 1;
+	List<String>::Iterator stop = list.begin() + 10;
+	list.Remove(first, stop);
+
+	bool removed = first == stop && ListEquals<String>(list, { "_", "d", "e" });
+
+	List<String>::Iterator rest = list.begin() + 1;
+	List<String>::Iterator back = list.end();
+	list.Remove(rest, back);
+
+	passed = inserted && self && removed && ListEquals<String>(list, { "_" }) && list.Back() == "_";
+
+	END_TEST;
+}
+
+void ListReverseSort()
+{
+	BEGIN_TEST;
+
+	List<int> list;
+	for (int i = 0; i < 5; ++i) { list.PushBack(i); }
+	list.Reverse();
+
+	bool reversed = ListEquals(list, { 4, 3, 2, 1, 0 }) && list.Front() == 4 && list.Back() == 0 && *(--(list.begin() + 4)) == 1;
+
+	list.Sort();
+	bool sorted = ListEquals(list, { 0, 1, 2, 3, 4 });
+
+	//Keys in the high half and the original position in the low half, sorting by key alone must keep positions ascending
+	List<U64> keyed;
+	std::vector<U64> expected;
+	U64 state = 88172645463325252ULL;
+
+	for (U64 i = 0; i < 10007; ++i)
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+
+		U64 value = ((state % 64) << 32) | i;
+		keyed.PushBack(value);
+		expected.push_back(value);
+	}
+
+	keyed.Sort([](U64 a, U64 b) { return (a >> 32) < (b >> 32); });
+	std::stable_sort(expected.begin(), expected.end(), [](U64 a, U64 b) { return (a >> 32) < (b >> 32); });
+
+	bool stable = keyed.Size() == expected.size() && keyed.Back() == expected.back();
+	U64 index = 0;
+	for (U64 value : keyed) { if (value != expected[index++]) { stable = false; } }
+
+	//Walking back from the tail checks the prev links the sort rebuilt
+	for (List<U64>::Iterator back = keyed.begin() + (int)(keyed.Size() - 1); back; --back) { if (*back != expected[--index]) { stable = false; } }
+
+	List<int> empty;
+	empty.Sort();
+	empty.Reverse();
+
+	passed = reversed && sorted && stable && index == 0 && empty.Size() == 0;
+
+	END_TEST;
+}
+
+void ListSortSpeed()
+{
+	List<U64> list;
+	U64 state = 88172645463325252ULL;
+	for (U64 i = 0; i < 1000000; ++i)
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		list.PushBack(state);
+	}
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	list.Sort();
+
+	U64 previous = 0;
+	bool sorted = true;
+	for (U64 value : list) { if (value < previous) { sorted = false; } previous = value; }
+
+	passed = sorted && list.Size() == 1000000;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void STLListSortSpeed()
+{
+	std::list<U64> list;
+	U64 state = 88172645463325252ULL;
+	for (U64 i = 0; i < 1000000; ++i)
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+		list.push_back(state);
+	}
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	list.sort();
+
+	U64 previous = 0;
+	bool sorted = true;
+	for (U64 value : list) { if (value < previous) { sorted = false; } previous = value; }
+
+	passed = sorted && list.size() == 1000000;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void ListTraversalSpeed()
+{
+	List<U64> list;
+	for (U64 i = 0; i < 1000000; ++i) { list.PushBack(i); }
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 total = 0;
+	for (int i = 0; i < 20; ++i) { for (U64 value : list) { total += value; } }
+
+	passed = total == 20ULL * (1000000ULL * 999999ULL / 2);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void STLListTraversalSpeed()
+{
+	std::list<U64> list;
+	for (U64 i = 0; i < 1000000; ++i) { list.push_back(i); }
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 total = 0;
+	for (int i = 0; i < 20; ++i) { for (U64 value : list) { total += value; } }
+
+	passed = total == 20ULL * (1000000ULL * 999999ULL / 2);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+#pragma endregion
+
+#pragma region Unrolled List Tests
+
+template<typename List, typename T>
+static bool UnrolledMatches(const List& list, const std::vector<T>& expected)
+{
+	if (list.Size() != expected.size()) { return false; }
+
+	U64 i = 0;
+	for (const T& value : list) { if (value != expected[i++]) { return false; } }
+
+	return i == expected.size() && (expected.empty() || (list.Front() == expected.front() && list.Back() == expected.back()));
+}
+
+/// <summary>
+/// Runs the same seeded mix of pushes, pops, inserts and removes on a list and a std::vector, shared by the positional list types
+/// </summary>
+template<class List, typename Make>
+static bool RandomListOperations(Make make)
+{
+	using T = decltype(make(0));
+
+	List list;
+	std::vector<T> expected;
+	U32 seed = 2463534242u;
+	bool matches = true;
+
+	for (int i = 0; i < 20000 && matches; ++i)
+	{
+		seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+		U64 index = expected.empty() ? 0 : seed % (expected.size() + 1);
+		T value = make(i);
+
+		switch ((seed >> 24) % 8)
+		{
+		case 0: list.PushBack(value); expected.push_back(value); break;
+		case 1: list.PushFront(value); expected.insert(expected.begin(), value); break;
+		case 2: case 3: list.Insert(index, value); expected.insert(expected.begin() + (I64)index, value); break;
+		case 4: if (!expected.empty()) { list.PopBack(); expected.pop_back(); } break;
+		case 5: if (!expected.empty()) { list.PopFront(); expected.erase(expected.begin()); } break;
+		case 6: case 7: if (index < expected.size()) { list.Remove(index); expected.erase(expected.begin() + (I64)index); } break;
+		}
+
+		if (i % 97 == 0) { matches = UnrolledMatches(list, expected); }
+	}
+
+	List copy = list;
+
+	return matches && UnrolledMatches(list, expected) && UnrolledMatches(copy, expected);
+}
+
+void UnrolledListPushPop()
+{
+	BEGIN_TEST;
+
+	UnrolledList<int, 4> list{ 3, 4, 5, 6, 7 };
+	list.PushFront(2);
+	list.PushFront(1);
+	list.PushBack(8);
+	list.PopFront();
+	list.PopBack();
+
+	passed = UnrolledMatches(list, std::vector<int>{ 2, 3, 4, 5, 6, 7 });
+
+	END_TEST;
+}
+
+void UnrolledListIterators()
+{
+	BEGIN_TEST;
+
+	UnrolledList<int, 4> list{ 0, 10, 20, 30, 40, 50, 60, 70 };
+
+	UnrolledList<int, 4>::Iterator it = list.begin() + 2;
+	list.InsertFront(it, 15);
+	bool front = *it == 20;
+	list.InsertBack(it, 25);
+	bool back = *it == 20;
+
+	it = list.begin() + 5;
+	list.Remove(it);
+	bool advanced = *it == 40;
+
+	list.RemoveAll(60);
+	U64 removed = list.RemoveIf([](int value) { return value % 20 == 0; });
+
+	passed = front && back && advanced && removed == 3 && UnrolledMatches(list, std::vector<int>{ 10, 15, 25, 50, 70 });
+
+	END_TEST;
+}
+
+void UnrolledListRandom()
+{
+	BEGIN_TEST;
+
+	passed = RandomListOperations<UnrolledList<int, 4>>([](int i) { return i; }) &&
+		RandomListOperations<UnrolledList<String, 4>>([](int i) { return String::Format("value {}", i); });
+
+	END_TEST;
+}
+
+void UnrolledListCopyMove()
+{
+	BEGIN_TEST;
+
+	UnrolledList<String, 4> list;
+	for (int i = 0; i < 10; ++i) { list.PushBack(String::Format("{}", i)); }
+
+	UnrolledList<String, 4> copy = list;
+	copy.PopFront();
+	UnrolledList<String, 4> moved = std::move(list);
+	moved = copy;
+
+	passed = list.Size() == 0 && copy.Size() == 9 && moved.Size() == 9 && moved.Front() == "1" && moved.Back() == "9";
+
+	END_TEST;
+}
+
+void UnrolledListTraversalSpeed()
+{
+	UnrolledList<U64> list;
+	for (U64 i = 0; i < 1000000; ++i) { list.PushBack(i); }
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 total = 0;
+	for (int i = 0; i < 20; ++i) { for (U64 value : list) { total += value; } }
+
+	passed = total == 20ULL * (1000000ULL * 999999ULL / 2);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void VectorTraversalSpeed()
+{
+	Vector<U64> vector;
+	for (U64 i = 0; i < 1000000; ++i) { vector.Push(i); }
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 total = 0;
+	for (int i = 0; i < 20; ++i) { for (U64 value : vector) { total += value; } }
+
+	passed = total == 20ULL * (1000000ULL * 999999ULL / 2);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void UnrolledListMidInsertSpeed()
+{
+	UnrolledList<U64> list;
+	for (U64 i = 0; i < 20000; ++i) { list.PushBack(i); }
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	for (U64 i = 0; i < 20000; ++i) { list.Insert(list.Size() / 2, i); }
+
+	passed = list.Size() == 40000;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void ListMidInsertSpeed()
+{
+	List<U64> list;
+	for (U64 i = 0; i < 20000; ++i) { list.PushBack(i); }
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	for (U64 i = 0; i < 20000; ++i) { list.Insert(list.Size() / 2, i); }
+
+	passed = list.Size() == 40000;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void VectorMidInsertSpeed()
+{
+	Vector<U64> vector;
+	for (U64 i = 0; i < 20000; ++i) { vector.Push(i); }
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	for (U64 i = 0; i < 20000; ++i) { vector.Insert(vector.Size() / 2, i); }
+
+	passed = vector.Size() == 40000;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+#pragma endregion
+
+#pragma region Intrusive List Tests
+
+struct Connection
+{
+	Connection(int id = 0) : id{ id } {}
+
+	bool operator<(const Connection& other) const { return id < other.id; }
+
+	int id;
+	ListHook hook;
+	ListHook timerHook;
+};
+
+using ConnectionList = IntrusiveList<Connection, &Connection::hook>;
+using TimerList = IntrusiveList<Connection, &Connection::timerHook>;
+
+static bool IntrusiveIds(const ConnectionList& list, std::initializer_list<int> ids)
+{
+	if (list.Size() != ids.size()) { return false; }
+
+	const int* id = ids.begin();
+	for (const Connection& connection : list) { if (connection.id != *id++) { return false; } }
+
+	return true;
+}
+
+void IntrusiveListLinks()
+{
+	BEGIN_TEST;
+
+	Connection connections[5] = { 0, 1, 2, 3, 4 };
+	ConnectionList list;
+	TimerList timers;
+
+	for (Connection& connection : connections) { list.PushBack(connection); timers.PushFront(connection); }
+
+	//Unlinking needs only the object, and each hook belongs to its own list
+	ConnectionList::Unlink(connections[2]);
+	list.Remove(connections[0]);
+	bool unlinked = IntrusiveIds(list, { 1, 3, 4 }) && !connections[2].hook.Linked() && connections[2].timerHook.Linked() && timers.Size() == 5;
+
+	ConnectionList::Iterator it = list.begin();
+	list.InsertFront(it, connections[0]);
+	list.InsertBack(it, connections[2]);
+	list.Remove(it);
+	bool positioned = IntrusiveIds(list, { 0, 2, 3, 4 }) && (*it).id == 2;
+
+	ConnectionList::Iterator back = list.end();
+	list.InsertBack(back, connections[1]);
+	bool appended = IntrusiveIds(list, { 0, 2, 3, 4, 1 }) && list.Back().id == 1;
+	list.Remove(connections[1]);
+
+	{
+		Connection temporary(9);
+		list.PushBack(temporary);
+		timers.PushBack(temporary);
+	}
+
+	bool destroyed = IntrusiveIds(list, { 0, 2, 3, 4 }) && timers.Size() == 5 && timers.Front().id == 4 && timers.Back().id == 0;
+
+	list.PopFront();
+	list.PopBack();
+	timers.Clear();
+
+	passed = unlinked && positioned && appended && destroyed && IntrusiveIds(list, { 2, 3 }) && timers.Empty() && !connections[4].timerHook.Linked();
+
+	END_TEST;
+}
+
+void IntrusiveListSpliceMerge()
+{
+	BEGIN_TEST;
+
+	Connection connections[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	ConnectionList a;
+	ConnectionList b;
+
+	a.PushBack(connections[0]);
+	a.PushBack(connections[3]);
+	b.PushBack(connections[1]);
+	b.PushBack(connections[2]);
+
+	a.Splice(1, b);
+	bool spliced = IntrusiveIds(a, { 0, 1, 2, 3 }) && b.Empty();
+
+	ConnectionList evens;
+	ConnectionList odds;
+	for (int i = 4; i < 10; ++i) { (i % 2 ? odds : evens).PushBack(connections[i]); }
+	evens.Merge(odds);
+	a.Merge(evens);
+	bool merged = IntrusiveIds(a, { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }) && evens.Empty() && odds.Empty();
+
+	U64 removed = a.RemoveIf([](const Connection& connection) { return connection.id % 3 == 0; });
+	ConnectionList moved = std::move(a);
+
+	passed = spliced && merged && removed == 4 && IntrusiveIds(moved, { 1, 2, 4, 5, 7, 8 }) && a.Empty() && moved.Front().hook.prev != &moved.Front().hook;
+
+	END_TEST;
+}
+
+void IntrusiveTimerSpeed()
+{
+	Vector<Connection> timers(1000);
+	for (int i = 0; i < 1000; ++i) { timers.Push(Connection(i)); }
+
+	TimerList schedule;
+	for (Connection& timer : timers) { schedule.PushBack(timer); }
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	//Cancel an arbitrary timer and schedule it again at the back
+	U32 seed = 2463534242u;
+	for (int i = 0; i < 10000000; ++i)
+	{
+		seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+		Connection& timer = timers[seed % 1000];
+		TimerList::Unlink(timer);
+		schedule.PushBack(timer);
+	}
+
+	passed = schedule.Size() == 1000;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void STLTimerSpeed()
+{
+	struct Timer { int id; std::list<Timer*>::iterator position; };
+
+	std::vector<Timer> timers(1000);
+	std::list<Timer*> schedule;
+	for (int i = 0; i < 1000; ++i) { timers[i].id = i; timers[i].position = schedule.insert(schedule.end(), &timers[i]); }
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U32 seed = 2463534242u;
+	for (int i = 0; i < 10000000; ++i)
+	{
+		seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+		Timer& timer = timers[seed % 1000];
+		schedule.erase(timer.position);
+		timer.position = schedule.insert(schedule.end(), &timer);
+	}
+
+	passed = schedule.size() == 1000;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+#pragma endregion
+
+#pragma region Compact List Tests
+
+void CompactListRandom()
+{
+	BEGIN_TEST;
+
+	bool numbers = RandomListOperations<CompactList<int>>([](int i) { return i; });
+	bool strings = RandomListOperations<CompactList<String>>([](int i) { return String(i).Append(" is long enough to not fit in a small string"); });
+
+	passed = numbers && strings;
+
+	END_TEST;
+}
+
+void CompactListIterators()
+{
+	BEGIN_TEST;
+
+	CompactList<String> list;
+	list.PushBack(String("a"));
+	list.PushBack(String("c"));
+
+	//Iterators are indices, so they survive the array growing underneath them
+	CompactList<String>::Iterator it = list.begin() + 1;
+	for (int i = 0; i < 100; ++i) { list.PushBack(String(i)); }
+	list.InsertFront(it, String("b"));
+	bool stable = *it == "c" && *(list.begin() + 1) == "b";
+
+	//Pushing one of its own values while the array grows
+	CompactList<String> self;
+	for (int i = 0; i < 16; ++i) { self.PushBack(String("repeated value that is long enough for the heap")); }
+	self.PushBack(self.Front());
+	bool aliased = self.Size() == 17 && self.Back() == self.Front();
+
+	it = list.begin() + 3;
+	CompactList<String>::Iterator stop = list.end();
+	list.Remove(it, stop);
+	bool removed = it == stop && UnrolledMatches(list, std::vector<String>{ "a", "b", "c" }) && *(--list.end()) == "c";
+
+	list.Reverse();
+	bool reversed = UnrolledMatches(list, std::vector<String>{ "c", "b", "a" });
+
+	CompactList<String> other;
+	other.PushBack(String("x"));
+	other.PushBack(String("y"));
+	it = list.begin() + 1;
+	list.Splice(it, other);
+	list.InsertBack(it, list);
+
+	passed = stable && aliased && removed && reversed && other.Size() == 0 && 
+		UnrolledMatches(list, std::vector<String>{ "c", "x", "y", "b", "c", "x", "y", "b", "a", "a" });
+
+	END_TEST;
+}
+
+void CompactListSortMerge()
+{
+	BEGIN_TEST;
+
+	CompactList<U64> keyed;
+	std::vector<U64> expected;
+	U64 state = 88172645463325252ULL;
+
+	for (U64 i = 0; i < 10007; ++i)
+	{
+		state ^= state << 13;
+		state ^= state >> 7;
+		state ^= state << 17;
+
+		U64 value = ((state % 64) << 32) | i;
+		keyed.PushBack(value);
+		expected.push_back(value);
+	}
+
+	keyed.Sort([](U64 a, U64 b) { return (a >> 32) < (b >> 32); });
+	std::stable_sort(expected.begin(), expected.end(), [](U64 a, U64 b) { return (a >> 32) < (b >> 32); });
+
+	bool stable = UnrolledMatches(keyed, expected);
+
+	U64 index = expected.size();
+	for (CompactList<U64>::Iterator back = --keyed.end(); back; --back) { if (*back != expected[--index]) { stable = false; } }
+
+	CompactList<int> a;
+	CompactList<int> b;
+	for (int value : { 1, 3, 3, 5, 9 }) { a.PushBack(value); }
+	for (int value : { 0, 3, 4, 9, 12, 13 }) { b.PushBack(value); }
+	a.Merge(b);
+
+	passed = stable && index == 0 && b.Size() == 0 && UnrolledMatches(a, std::vector<int>{ 0, 1, 3, 3, 3, 4, 5, 9, 9, 12, 13 });
+
+	END_TEST;
+}
+
+void CompactListLayout()
+{
+	BEGIN_TEST;
+
+	bool halved = sizeof(CompactList<U64>::Node) == 16 && sizeof(CompactList<U64>::Node) < sizeof(List<U64>::Node);
+
+	CompactList<U64> list;
+	list.Reserve(1000);
+	for (U64 i = 0; i < 1000; ++i) { list.PushBack(i); }
+	list.RemoveIf([](U64 value) { return value % 3 == 0; });
+	list.PushBack(1000);
+
+	//Erased nodes are reused before the array grows and a copy is the same block of nodes
+	CompactList<U64> copy = list;
+	std::vector<U64> expected;
+	for (U64 value : list) { expected.push_back(value); }
+
+	bool reused = list.UsedNodes() == 1000 && copy.UsedNodes() == 1000 && list.Capacity() >= 1000;
+	bool identical = UnrolledMatches(copy, expected) &&
+		memcmp(copy.Data(), list.Data(), list.UsedNodes() * sizeof(CompactList<U64>::Node)) == 0;
+
+	passed = halved && reused && identical && list.Size() == 667;
+
+	END_TEST;
+}
+
+void CompactListChurnSpeed()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	CompactList<U64> orders;
+	for (U64 i = 0; i < 1000; ++i) { orders.PushBack(i); }
+
+	U64 filled = 0;
+	for (U64 i = 1000; i < 10001000; ++i)
+	{
+		filled += orders.Front();
+		orders.PopFront();
+		orders.PushBack(i);
+	}
+
+	passed = orders.Size() == 1000 && filled == 10000000ULL * 9999999ULL / 2;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void CompactListTraversalSpeed()
+{
+	CompactList<U64> list;
+	for (U64 i = 0; i < 1000000; ++i) { list.PushBack(i); }
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 total = 0;
+	for (int i = 0; i < 20; ++i) { for (U64 value : list) { total += value; } }
+
+	passed = total == 20ULL * (1000000ULL * 999999ULL / 2);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void CompactListCopySpeed()
+{
+	CompactList<U64> list;
+	for (U64 i = 0; i < 1000000; ++i) { list.PushBack(i); }
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 total = 0;
+	for (int i = 0; i < 20; ++i)
+	{
+		CompactList<U64> copy = list;
+		total += copy.Back();
+	}
+
+	passed = total == 20ULL * 999999ULL;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void ListCopySpeed()
+{
+	List<U64> list;
+	for (U64 i = 0; i < 1000000; ++i) { list.PushBack(i); }
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U64 total = 0;
+	for (int i = 0; i < 20; ++i)
+	{
+		List<U64> copy = list;
+		total += copy.Back();
+	}
+
+	passed = total == 20ULL * 999999ULL;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+#pragma endregion
+
+#pragma region Skip List Tests
+
+void SkipListRandom()
+{
+	BEGIN_TEST;
+
+	bool numbers = RandomListOperations<SkipList<int>>([](int i) { return i; });
+	bool strings = RandomListOperations<SkipList<String>>([](int i) { return String(i).Append(" is long enough to not fit in a small string"); });
+
+	passed = numbers && strings;
+
+	END_TEST;
+}
+
+void SkipListIndexing()
+{
+	BEGIN_TEST;
+
+	SkipList<int> list;
+	std::vector<int> expected;
+	U32 seed = 2463534242u;
+	bool matches = true;
+
+	//Every edit is followed by a random read, so the index is checked as the towers change
+	for (int i = 0; i < 20000 && matches; ++i)
+	{
+		seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+		U64 index = seed % (expected.size() + 1);
+
+		if ((seed >> 24) % 3 || index == expected.size()) { list.Insert(index, i); expected.insert(expected.begin() + (I64)index, i); }
+		else { list.Remove(index); expected.erase(expected.begin() + (I64)index); }
+
+		if (!expected.empty())
+		{
+			U64 read = (seed >> 8) % expected.size();
+			matches = list[read] == expected[read];
+		}
+	}
+
+	passed = matches;
+
+	END_TEST;
+}
+
+void SkipListIterators()
+{
+	BEGIN_TEST;
+
+	SkipList<U64> list;
+	for (U64 i = 0; i < 5000; ++i) { list.PushBack(i * 2); }
+
+	//Jumps and indices agree with stepping one value at a time
+	bool jumps = true;
+	SkipList<U64>::Iterator it = list.begin();
+	for (U64 i = 0; i < 5000; i += 37, it += 37)
+	{
+		if (*it != i * 2 || list.Index(it) != i || *(it - (int)(i / 2)) != (i - i / 2) * 2) { jumps = false; }
+	}
+
+	bool ends = !(list.begin() + 5000) && list.Index(list.end()) == 5000 && *(list.end() - 1) == 9998 && *(--list.end()) == 9998;
+
+	it = list.begin() + 10;
+	list.InsertFront(it, 19);
+	list.InsertBack(it, 21);
+	bool inserted = list[9] == 18 && list[10] == 19 && list[11] == 20 && list[12] == 21 && list.Index(it) == 11;
+
+	list.Remove(it);
+	bool advanced = *it == 21 && list.Index(it) == 11;
+
+	U64 removed = list.RemoveIf([](U64 value) { return value % 4 != 0; });
+	list.Insert(5, 20);
+
+	bool walked = true;
+	U64 index = list.Size();
+	for (SkipList<U64>::Iterator back = --list.end(); back; --back) { if (*back != --index * 4) { walked = false; } }
+
+	passed = jumps && ends && inserted && advanced && removed == 2502 && list.Size() == 2500 && walked && index == 0;
+
+	END_TEST;
+}
+
+void SkipListEditSpeed()
+{
+	SkipList<U64> list;
+	for (U64 i = 0; i < 100000; ++i) { list.PushBack(i); }
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	//Random positional edits on a playlist, moving tracks around and reading the one at a random slot
+	U32 seed = 2463534242u;
+	U64 read = 0;
+	for (int i = 0; i < 2000; ++i)
+	{
+		seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+		U64 from = seed % list.Size();
+		seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+		U64 to = seed % list.Size();
+
+		U64 track = list[from];
+		list.Remove(from);
+		list.Insert(to, track);
+		read += list[seed % 1000];
+	}
+
+	passed = list.Size() == 100000 && read;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void ListEditSpeed()
+{
+	List<U64> list;
+	for (U64 i = 0; i < 100000; ++i) { list.PushBack(i); }
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U32 seed = 2463534242u;
+	U64 read = 0;
+	for (int i = 0; i < 2000; ++i)
+	{
+		seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+		U64 from = seed % list.Size();
+		seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+		U64 to = seed % list.Size();
+
+		U64 track = *(list.begin() + (int)from);
+		list.Remove(from);
+		list.Insert(to, track);
+		read += *(list.begin() + (int)(seed % 1000));
+	}
+
+	passed = list.Size() == 100000 && read;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void VectorEditSpeed()
+{
+	Vector<U64> vector;
+	for (U64 i = 0; i < 100000; ++i) { vector.Push(i); }
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	U32 seed = 2463534242u;
+	U64 read = 0;
+	for (int i = 0; i < 2000; ++i)
+	{
+		seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+		U64 from = seed % vector.Size();
+		seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+		U64 to = seed % vector.Size();
+
+		U64 track = vector[from];
+		vector.Remove(from);
+		vector.Insert(to, track);
+		read += vector[seed % 1000];
+	}
+
+	passed = vector.Size() == 100000 && read;
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+#pragma endregion
+
+#pragma region MPSC List Tests
+
+void MPSCListBatches()
+{
+	BEGIN_TEST;
+
+	MPSCList<String> queue;
+	bool empty = queue.Empty() && queue.PopAll().Empty();
+
+	queue.PushBack(String("first"));
+	queue.PushBack(String("second"));
+	String third("third");
+	queue.PushBack(third);
+
+	MPSCList<String>::Batch batch = queue.PopAll();
+	bool ordered = batch.Size() == 3 && batch.Front() == "first" && batch.Back() == "third" && *(++batch.begin()) == "second" && queue.Empty();
+
+	queue.PushBack(String("fourth"));
+	List<String> list;
+	list.PushBack(String("zeroth"));
+	queue.PopAll(list);
+	batch.MoveTo(list);
+
+	//A batch left undrained frees its values when destroyed, as does the queue
+	queue.PushBack(String("dropped"));
+	MPSCList<String>::Batch dropped = queue.PopAll();
+	queue.PushBack(String("left in the queue"));
+
+	passed = empty && ordered && batch.Empty() && dropped.Size() == 1 && ListEquals<String>(list, { "zeroth", "fourth", "first", "second", "third" });
+
+	END_TEST;
+}
+
+void MPSCListThreads()
+{
+	BEGIN_TEST;
+
+	//Every producer's values arrive in the order it pushed them and none are lost
+	MPSCList<U64> queue;
+	std::vector<std::thread> producers;
+
+	for (U64 p = 0; p < 8; ++p)
+	{
+		producers.emplace_back([&queue, p]() { for (U64 i = 0; i < 20000; ++i) { queue.PushBack((p << 32) | i); } });
+	}
+
+	U64 next[8]{};
+	U64 received = 0;
+	bool ordered = true;
+
+	while (received < 8 * 20000)
+	{
+		MPSCList<U64>::Batch batch = queue.PopAll();
+		if (batch.Empty()) { std::this_thread::yield(); continue; }
+
+		for (U64 value : batch)
+		{
+			U64& expected = next[value >> 32];
+			if ((value & 0xFFFFFFFF) != expected) { ordered = false; }
+			++expected;
+		}
+
+		received += batch.Size();
+	}
+
+	for (std::thread& producer : producers) { producer.join(); }
+
+	passed = ordered && received == 8 * 20000 && queue.Empty();
+
+	END_TEST;
+}
+
+static bool MPSCHandOff(U64 producerCount)
+{
+	static constexpr U64 ITEMS = 1 << 20;
+
+	MPSCList<U64> queue;
+	std::vector<std::thread> producers;
+	U64 perProducer = ITEMS / producerCount;
+
+	for (U64 p = 0; p < producerCount; ++p)
+	{
+		producers.emplace_back([&queue, perProducer]() { for (U64 i = 0; i < perProducer; ++i) { queue.PushBack(i); } });
+	}
+
+	U64 received = 0;
+	U64 total = 0;
+	while (received < perProducer * producerCount)
+	{
+		MPSCList<U64>::Batch batch = queue.PopAll();
+		if (batch.Empty()) { std::this_thread::yield(); continue; }
+
+		for (U64 value : batch) { total += value; }
+		received += batch.Size();
+	}
+
+	for (std::thread& producer : producers) { producer.join(); }
+
+	return total == producerCount * (perProducer * (perProducer - 1) / 2);
+}
+
+static bool MutexHandOff(U64 producerCount)
+{
+	static constexpr U64 ITEMS = 1 << 20;
+
+	std::mutex mutex;
+	List<U64> queue;
+	std::vector<std::thread> producers;
+	U64 perProducer = ITEMS / producerCount;
+
+	for (U64 p = 0; p < producerCount; ++p)
+	{
+		producers.emplace_back([&mutex, &queue, perProducer]()
+		{
+			for (U64 i = 0; i < perProducer; ++i)
+			{
+				std::lock_guard<std::mutex> guard(mutex);
+				queue.PushBack(i);
+			}
+		});
+	}
+
+	U64 received = 0;
+	U64 total = 0;
+	while (received < perProducer * producerCount)
+	{
+		List<U64> batch;
+		{
+			std::lock_guard<std::mutex> guard(mutex);
+			batch = std::move(queue);
+		}
+
+		if (!batch.Size()) { std::this_thread::yield(); continue; }
+
+		for (U64 value : batch) { total += value; }
+		received += batch.Size();
+	}
+
+	for (std::thread& producer : producers) { producer.join(); }
+
+	return total == producerCount * (perProducer * (perProducer - 1) / 2);
+}
+
+void MPSCListHandOffSpeed1()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MPSCHandOff(1);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void MutexListHandOffSpeed1()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MutexHandOff(1);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void MPSCListHandOffSpeed4()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MPSCHandOff(4);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void MutexListHandOffSpeed4()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MutexHandOff(4);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void MPSCListHandOffSpeed16()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MPSCHandOff(16);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void MutexListHandOffSpeed16()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MutexHandOff(16);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void MPSCListHandOffSpeed64()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MPSCHandOff(64);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void MutexListHandOffSpeed64()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MutexHandOff(64);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+#pragma endregion
+
+#pragma region Hashmap Tests
+
+void HashmapBasics()
+{
+	BEGIN_TEST;
+
+	Hashmap<U64, U64> map;
+	bool empty = map.Find(7) == nullptr && !map.Remove(7) && map.begin() == map.end();
+
+	bool inserted = map.Insert(7, 70) && map.Insert(8, 80) && !map.Insert(7, 71) && *map.Find(7) == 70;
+
+	map[9] = 90;
+	map[7] += 1;
+	bool indexed = map.Size() == 3 && *map.Find(7) == 71 && *map.Find(9) == 90 && map.Contains(8) && !map.Contains(10);
+
+	bool removed = map.Remove(8) && !map.Remove(8) && !map.Contains(8) && map.Size() == 2;
+
+	U64 total = 0;
+	for (Hashmap<U64, U64>::Pair& pair : map) { total += pair.key + pair.value; }
+
+	Hashmap<String, String> names;
+	names.Insert(String("alpha"), String("first letter of the greek alphabet"));
+	names[String("beta")] = String("second letter of the greek alphabet");
+	Hashmap<String, String> copy = names;
+	names.Remove(String("alpha"));
+	Hashmap<String, String> moved = std::move(copy);
+
+	bool strings = names.Size() == 1 && moved.Size() == 2 && *moved.Find(String("alpha")) == "first letter of the greek alphabet" &&
+		copy.Size() == 0 && copy.Find(String("beta")) == nullptr;
+
+	passed = empty && inserted && indexed && removed && total == 7 + 71 + 9 + 90 && strings;
+
+	END_TEST;
+}
+
+template<HashmapProbing Probing>
+static bool HashmapRandomOperations(F32 maxLoad)
+{
+	//Random inserts and removes over a small key range exercise tombstones, displacement, in-place rehashes and growth
+	Hashmap<U32, U32, Probing> map;
+	map.SetMaxLoad(maxLoad);
+	std::unordered_map<U32, U32> expected;
+	U32 seed = 2463534242u;
+	bool matches = true;
+
+	for (U32 i = 0; i < 200000 && matches; ++i)
+	{
+		seed ^= seed << 13; seed ^= seed >> 17; seed ^= seed << 5;
+		U32 key = seed % 5000;
+
+		switch ((seed >> 24) % 4)
+		{
+		case 0: case 1: matches = map.Insert(key, i) == expected.insert({ key, i }).second; break;
+		case 2: matches = map.Remove(key) == (expected.erase(key) == 1); break;
+		case 3:
+		{
+			const U32* value = map.Find(key);
+			auto it = expected.find(key);
+			matches = it == expected.end() ? value == nullptr : value && *value == it->second;
+		} break;
+		}
+	}
+
+	U64 visited = 0;
+	for (typename Hashmap<U32, U32, Probing>::Pair& pair : map)
+	{
+		auto it = expected.find(pair.key);
+		if (it == expected.end() || it->second != pair.value) { matches = false; }
+		++visited;
+	}
+
+	//Removing through an iterator visits every remaining pair once
+	U64 odd = 0;
+	for (typename Hashmap<U32, U32, Probing>::Iterator it = map.begin(); it != map.end();)
+	{
+		if (it->key & 1) { map.Remove(it); ++odd; }
+		else { ++it; }
+	}
+
+	U64 even = 0;
+	for (auto& pair : expected)
+	{
+		if (pair.first & 1) { continue; }
+
+		const U32* value = map.Find(pair.first);
+		if (!value || *value != pair.second) { matches = false; }
+		++even;
+	}
+
+	return matches && visited == expected.size() && map.Size() == even && odd + even == expected.size();
+}
+
+void HashmapRandom()
+{
+	BEGIN_TEST;
+
+	passed = HashmapRandomOperations<HashmapProbing::Quadratic>(HASHMAP_MAX_LOAD);
+
+	END_TEST;
+}
+
+void HashmapLinearRandom()
+{
+	BEGIN_TEST;
+
+	passed = HashmapRandomOperations<HashmapProbing::Linear>(0.95f);
+
+	END_TEST;
+}
+
+void HashmapRobinHoodRandom()
+{
+	BEGIN_TEST;
+
+	passed = HashmapRandomOperations<HashmapProbing::RobinHood>(0.95f);
+
+	END_TEST;
+}
+
+void HashmapCuckooRandom()
+{
+	BEGIN_TEST;
+
+	passed = HashmapRandomOperations<HashmapProbing::Cuckoo>(0.95f);
+
+	END_TEST;
+}
+
+void HashmapProbeStatistics()
+{
+	BEGIN_TEST;
+
+	Hashmap<String, U64, HashmapProbing::RobinHood> robinHood;
+	Hashmap<String, U64, HashmapProbing::Cuckoo> cuckoo;
+	Hashmap<String, U64, HashmapProbing::Linear> linear;
+	robinHood.SetMaxLoad(0.95f);
+	cuckoo.SetMaxLoad(0.95f);
+	linear.SetMaxLoad(0.95f);
+
+	bool empty = robinHood.ProbeStats().longestHit == 0 && cuckoo.ProbeStats().averageMiss == 0.0;
+
+	//String keys are moved by Robin Hood shifts and cuckoo displacement
+	for (U64 i = 0; i < 20000; ++i)
+	{
+		String key = String::Format("key {}", i);
+		robinHood.Insert(key, i);
+		cuckoo.Insert(key, i);
+		linear.Insert(key, i);
+	}
+
+	for (U64 i = 0; i < 20000; i += 3)
+	{
+		String key = String::Format("key {}", i);
+		robinHood.Remove(key);
+		cuckoo.Remove(key);
+		linear.Remove(key);
+	}
+
+	bool found = true;
+	for (U64 i = 0; i < 20000; ++i)
+	{
+		String key = String::Format("key {}", i);
+		bool kept = i % 3 != 0;
+		if ((robinHood.Find(key) != nullptr) != kept || (cuckoo.Find(key) != nullptr) != kept || (linear.Find(key) != nullptr) != kept) { found = false; }
+		if (kept && (*robinHood.Find(key) != i || *cuckoo.Find(key) != i || *linear.Find(key) != i)) { found = false; }
+	}
+
+	HashmapProbeStats robinHoodStats = robinHood.ProbeStats();
+	HashmapProbeStats cuckooStats = cuckoo.ProbeStats();
+	HashmapProbeStats linearStats = linear.ProbeStats();
+
+	bool bounded = robinHoodStats.averageHit >= 1.0 && robinHoodStats.longestHit < HASHMAP_MAX_DISTANCE && robinHoodStats.averageMiss >= 1.0 &&
+		cuckooStats.averageHit >= 1.0 && cuckooStats.longestHit <= 2 && cuckooStats.longestMiss == 2 &&
+		linearStats.averageHit >= 1.0 && linearStats.longestMiss >= linearStats.longestHit;
+
+	passed = empty && found && bounded;
+
+	END_TEST;
+}
+
+void HashmapReserve()
+{
+	BEGIN_TEST;
+
+	Hashmap<U64, U64> map;
+	map.Reserve(1000);
+	U64 capacity = map.Capacity();
+
+	for (U64 i = 0; i < 1000; ++i) { map.Insert(i, i); }
+
+	//Churn at a steady size reuses emptied slots and cleans tombstones out without growing
+	for (U64 i = 1000; i < 100000; ++i)
+	{
+		map.Remove(i - 1000);
+		map.Insert(i, i);
+	}
+
+	bool found = true;
+	for (U64 i = 99000; i < 100000; ++i) { if (!map.Find(i) || *map.Find(i) != i) { found = false; } }
+
+	map.Clear();
+
+	//Loads outside the supported range are clamped, so even a load of 0 still grows to fit
+	Hashmap<U64, U64> clamped;
+	clamped.SetMaxLoad(0.0f);
+	for (U64 i = 0; i < 100; ++i) { clamped.Insert(i, i); }
+	F32 lowest = clamped.MaxLoad();
+	clamped.SetMaxLoad(2.0f);
+
+	bool limited = lowest == HASHMAP_LOWEST_MAX_LOAD && clamped.MaxLoad() == HASHMAP_HIGHEST_MAX_LOAD && clamped.Size() == 100 && clamped.Capacity() == 512;
+
+	passed = capacity == 2048 && map.Capacity() == 2048 && found && map.Size() == 0 && !map.Contains(99999) && limited;
+
+	END_TEST;
+}
+
+static std::vector<U64> HashKeys(U64 count, U64 seed)
+{
+	std::vector<U64> keys(count);
+	for (U64& key : keys)
+	{
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+		key = seed;
+	}
+
+	return keys;
+}
+
+static U64 HashRounds(U64 count) { return count < 10000000 ? 10000000 / count : 1; }
+
+static const U64* MapFind(const Hashmap<U64, U64>& map, U64 key) { return map.Find(key); }
+static const U64* MapFind(const std::unordered_map<U64, U64>& map, U64 key) { auto it = map.find(key); return it == map.end() ? nullptr : &it->second; }
+static void MapInsert(Hashmap<U64, U64>& map, U64 key) { map.Insert(key, key); }
+static void MapInsert(std::unordered_map<U64, U64>& map, U64 key) { map.insert({ key, key }); }
+static void MapRemove(Hashmap<U64, U64>& map, U64 key) { map.Remove(key); }
+static void MapRemove(std::unordered_map<U64, U64>& map, U64 key) { map.erase(key); }
+
+template<class Map>
+static void MapBuild(Map& map, const std::vector<U64>& keys)
+{
+	map.reserve(keys.size());
+	for (U64 key : keys) { MapInsert(map, key); }
+}
+
+static void MapBuild(Hashmap<U64, U64>& map, const std::vector<U64>& keys)
+{
+	map.Reserve(keys.size());
+	for (U64 key : keys) { MapInsert(map, key); }
+}
+
+template<class Map>
+static bool MapHits(const Map& map, const std::vector<U64>& keys)
+{
+	U64 total = 0;
+	U64 rounds = HashRounds(keys.size());
+	for (U64 r = 0; r < rounds; ++r) { for (U64 key : keys) { total += *MapFind(map, key); } }
+
+	U64 expected = 0;
+	for (U64 key : keys) { expected += key; }
+
+	return total == expected * rounds;
+}
+
+template<class Map>
+static bool MapMisses(const Map& map, const std::vector<U64>& missing)
+{
+	U64 found = 0;
+	U64 rounds = HashRounds(missing.size());
+	for (U64 r = 0; r < rounds; ++r) { for (U64 key : missing) { found += MapFind(map, key) != nullptr; } }
+
+	return found == 0;
+}
+
+template<class Map>
+static bool MapChurn(Map& map, const std::vector<U64>& keys, const std::vector<U64>& missing)
+{
+	//Every key is swapped out for a new one and back again, the size never changes
+	U64 rounds = HashRounds(keys.size());
+	for (U64 r = 0; r < rounds; ++r)
+	{
+		const std::vector<U64>& out = r & 1 ? missing : keys;
+		const std::vector<U64>& in = r & 1 ? keys : missing;
+		for (U64 i = 0; i < keys.size(); ++i)
+		{
+			MapRemove(map, out[i]);
+			MapInsert(map, in[i]);
+		}
+	}
+
+	return MapFind(map, rounds & 1 ? missing[0] : keys[0]) != nullptr;
+}
+
+template<HashmapProbing Probing>
+static bool HashmapLoadMatrix()
+{
+	//Every cell fills a table of 2^20 slots to a load factor and times lookups where a share of them hit
+	static constexpr U64 SLOTS = 1 << 20;
+	static constexpr U64 QUERIES = 1 << 20;
+	static constexpr U64 ROUNDS = 4;
+	static constexpr F32 LOADS[]{ 0.5f, 0.75f, 0.875f, 0.95f };
+	static constexpr U64 HIT_PERCENTS[]{ 100, 90, 50, 0 };
+
+	std::vector<U64> missing = HashKeys(SLOTS, 2);
+	std::vector<U64> queries(QUERIES);
+	bool correct = true;
+
+	for (F32 load : LOADS)
+	{
+		U64 count = (U64)(SLOTS * load);
+		std::vector<U64> keys = HashKeys(count, 1);
+
+		Hashmap<U64, U64, Probing> map;
+		map.SetMaxLoad(0.95f);
+		map.Reserve(count);
+		for (U64 key : keys) { map.Insert(key, key); }
+
+		HashmapProbeStats stats = map.ProbeStats();
+
+		for (U64 percent : HIT_PERCENTS)
+		{
+			U64 hits = 0;
+			U64 seed = 88172645463325252ull;
+			for (U64 i = 0; i < QUERIES; ++i)
+			{
+				seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17;
+				bool hit = seed % 100 < percent;
+				queries[i] = hit ? keys[(seed >> 8) % count] : missing[(seed >> 8) % SLOTS];
+				hits += hit;
+			}
+
+			LARGE_INTEGER cellStart;
+			QueryPerformanceCounter(&cellStart);
+
+			U64 found = 0;
+			for (U64 r = 0; r < ROUNDS; ++r) { for (U64 key : queries) { found += map.Find(key) != nullptr; } }
+
+			LARGE_INTEGER cellEnd;
+			QueryPerformanceCounter(&cellEnd);
+
+			if (found != hits * ROUNDS) { correct = false; }
+
+			printf("    load %.3f, %3llu%% hits: %fs  |  probes hit %.2f (longest %llu), miss %.2f (longest %llu)\n", map.LoadFactor(), percent,
+				(double)(cellEnd.QuadPart - cellStart.QuadPart) / (double)freq.QuadPart, stats.averageHit, stats.longestHit, stats.averageMiss, stats.longestMiss);
+		}
+	}
+
+	return correct;
+}
+
+void HashmapQuadraticLoadMatrix()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = HashmapLoadMatrix<HashmapProbing::Quadratic>();
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void HashmapLinearLoadMatrix()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = HashmapLoadMatrix<HashmapProbing::Linear>();
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void HashmapRobinHoodLoadMatrix()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = HashmapLoadMatrix<HashmapProbing::RobinHood>();
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void HashmapCuckooLoadMatrix()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = HashmapLoadMatrix<HashmapProbing::Cuckoo>();
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void HashmapHitSpeed1K()
+{
+	std::vector<U64> keys = HashKeys(1000, 1);
+	Hashmap<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapHits(map, keys);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void STLHashmapHitSpeed1K()
+{
+	std::vector<U64> keys = HashKeys(1000, 1);
+	std::unordered_map<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapHits(map, keys);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void HashmapMissSpeed1K()
+{
+	std::vector<U64> keys = HashKeys(1000, 1);
+	std::vector<U64> missing = HashKeys(1000, 2);
+	Hashmap<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapMisses(map, missing);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void STLHashmapMissSpeed1K()
+{
+	std::vector<U64> keys = HashKeys(1000, 1);
+	std::vector<U64> missing = HashKeys(1000, 2);
+	std::unordered_map<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapMisses(map, missing);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void HashmapChurnSpeed1K()
+{
+	std::vector<U64> keys = HashKeys(1000, 1);
+	std::vector<U64> missing = HashKeys(1000, 2);
+	Hashmap<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapChurn(map, keys, missing);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void STLHashmapChurnSpeed1K()
+{
+	std::vector<U64> keys = HashKeys(1000, 1);
+	std::vector<U64> missing = HashKeys(1000, 2);
+	std::unordered_map<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapChurn(map, keys, missing);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void HashmapHitSpeed100K()
+{
+	std::vector<U64> keys = HashKeys(100000, 1);
+	Hashmap<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapHits(map, keys);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void STLHashmapHitSpeed100K()
+{
+	std::vector<U64> keys = HashKeys(100000, 1);
+	std::unordered_map<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapHits(map, keys);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void HashmapMissSpeed100K()
+{
+	std::vector<U64> keys = HashKeys(100000, 1);
+	std::vector<U64> missing = HashKeys(100000, 2);
+	Hashmap<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapMisses(map, missing);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void STLHashmapMissSpeed100K()
+{
+	std::vector<U64> keys = HashKeys(100000, 1);
+	std::vector<U64> missing = HashKeys(100000, 2);
+	std::unordered_map<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapMisses(map, missing);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void HashmapChurnSpeed100K()
+{
+	std::vector<U64> keys = HashKeys(100000, 1);
+	std::vector<U64> missing = HashKeys(100000, 2);
+	Hashmap<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapChurn(map, keys, missing);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void STLHashmapChurnSpeed100K()
+{
+	std::vector<U64> keys = HashKeys(100000, 1);
+	std::vector<U64> missing = HashKeys(100000, 2);
+	std::unordered_map<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapChurn(map, keys, missing);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void HashmapHitSpeed10M()
+{
+	std::vector<U64> keys = HashKeys(10000000, 1);
+	Hashmap<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapHits(map, keys);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void STLHashmapHitSpeed10M()
+{
+	std::vector<U64> keys = HashKeys(10000000, 1);
+	std::unordered_map<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapHits(map, keys);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void HashmapMissSpeed10M()
+{
+	std::vector<U64> keys = HashKeys(10000000, 1);
+	std::vector<U64> missing = HashKeys(10000000, 2);
+	Hashmap<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapMisses(map, missing);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void STLHashmapMissSpeed10M()
+{
+	std::vector<U64> keys = HashKeys(10000000, 1);
+	std::vector<U64> missing = HashKeys(10000000, 2);
+	std::unordered_map<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapMisses(map, missing);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void HashmapChurnSpeed10M()
+{
+	std::vector<U64> keys = HashKeys(10000000, 1);
+	std::vector<U64> missing = HashKeys(10000000, 2);
+	Hashmap<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapChurn(map, keys, missing);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void STLHashmapChurnSpeed10M()
+{
+	std::vector<U64> keys = HashKeys(10000000, 1);
+	std::vector<U64> missing = HashKeys(10000000, 2);
+	std::unordered_map<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapChurn(map, keys, missing);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void HashmapHitSpeed100M()
+{
+	std::vector<U64> keys = HashKeys(100000000, 1);
+	Hashmap<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapHits(map, keys);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void STLHashmapHitSpeed100M()
+{
+	std::vector<U64> keys = HashKeys(100000000, 1);
+	std::unordered_map<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapHits(map, keys);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void HashmapMissSpeed100M()
+{
+	std::vector<U64> keys = HashKeys(100000000, 1);
+	std::vector<U64> missing = HashKeys(100000000, 2);
+	Hashmap<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapMisses(map, missing);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void STLHashmapMissSpeed100M()
+{
+	std::vector<U64> keys = HashKeys(100000000, 1);
+	std::vector<U64> missing = HashKeys(100000000, 2);
+	std::unordered_map<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapMisses(map, missing);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void HashmapChurnSpeed100M()
+{
+	std::vector<U64> keys = HashKeys(100000000, 1);
+	std::vector<U64> missing = HashKeys(100000000, 2);
+	Hashmap<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapChurn(map, keys, missing);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void STLHashmapChurnSpeed100M()
+{
+	std::vector<U64> keys = HashKeys(100000000, 1);
+	std::vector<U64> missing = HashKeys(100000000, 2);
+	std::unordered_map<U64, U64> map;
+	MapBuild(map, keys);
+
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = MapChurn(map, keys, missing);
+
+	/*** END TEST ***/
+
 	END_TEST;
 }
 
-void StringLastIndexOf()
+#pragma endregion
+
+#pragma region Concurrent Hashmap Tests
+
+void ConcurrentHashmapBasics()
 {
 	BEGIN_TEST;
 
+	ConcurrentHashmap<U64, String> map;
+	String value;
+
+	bool empty = !map.Find(1, value) && !map.Remove(1) && map.Size() == 0;
+
+	bool inserted = map.Insert(1, String("one")) && !map.Insert(1, String("uno")) && map.Find(1, value) && value == "one";
+	bool set = !map.Set(1, String("uno")) && map.Set(2, String("two")) && map.Find(1, value) && value == "uno" && map.Size() == 2;
+	bool removed = map.Remove(1) && !map.Contains(1) && map.Contains(2) && map.Size() == 1;
+
+	//Growing keeps every key, removed slots are reused by later inserts
+	for (U64 i = 0; i < 10000; ++i) { map.Set(i, String::Format("{}", i)); }
+	for (U64 i = 0; i < 10000; i += 2) { map.Remove(i); }
+	for (U64 i = 0; i < 10000; i += 4) { map.Insert(i, String::Format("{}", i)); }
+
+	bool kept = true;
+	for (U64 i = 0; i < 10000; ++i)
+	{
+		bool present = map.Find(i, value);
+		if (present != (i % 2 == 1 || i % 4 == 0) || (present && value != String::Format("{}", i))) { kept = false; }
+	}
+
+	map.Reclaim();
+	map.Reserve(100000);
+
+	passed = empty && inserted && set && removed && kept && map.Size() == 7500 && map.Capacity() >= 100000 && map.Contains(9999);
+
 	END_TEST;
 }
 
-void StringTrim()
+void ConcurrentHashmapThreads()
 {
 	BEGIN_TEST;
 
+	//Readers only ever see a key's first or second value while writers insert, replace and remove through several resizes
+	static constexpr U64 WRITERS = 4;
+	static constexpr U64 KEYS = 20000;
+
+	ConcurrentHashmap<U64, String> map;
+	std::atomic<bool> writing{ true };
+	std::atomic<U64> torn{ 0 };
+	std::vector<std::thread> threads;
+
+	for (U64 w = 0; w < WRITERS; ++w)
+	{
+		threads.emplace_back([&map, w]()
+			{
+				for (U64 key = w * KEYS; key < (w + 1) * KEYS; ++key) { map.Insert(key, String::Format("first {}", key)); }
+				for (U64 key = w * KEYS; key < (w + 1) * KEYS; ++key) { map.Set(key, String::Format("second {}", key)); }
+				for (U64 key = w * KEYS + 1; key < (w + 1) * KEYS; key += 2) { map.Remove(key); }
+			});
+	}
+
+	for (U64 r = 0; r < 4; ++r)
+	{
+		threads.emplace_back([&map, &writing, &torn, r]()
+			{
+				U64 seed = 88172645463325252ull + r;
+				String value;
+
+				while (writing.load(std::memory_order_relaxed))
+				{
+					seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17;
+					U64 key = seed % (WRITERS * KEYS);
+
+					if (map.Find(key, value) && value != String::Format("first {}", key) && value != String::Format("second {}", key)) { torn.fetch_add(1); }
+				}
+			});
+	}
+
+	for (U64 w = 0; w < WRITERS; ++w) { threads[w].join(); }
+	writing.store(false);
+	for (U64 r = WRITERS; r < threads.size(); ++r) { threads[r].join(); }
+
+	bool final = true;
+	String value;
+	for (U64 key = 0; key < WRITERS * KEYS; ++key)
+	{
+		bool present = map.Find(key, value);
+		if (present != (key % 2 == 0) || (present && value != String::Format("second {}", key))) { final = false; }
+	}
+
+	passed = torn.load() == 0 && final && map.Size() == WRITERS * KEYS / 2;
+
 	END_TEST;
 }
 
-void StringToUpper()
+static constexpr U64 CONCURRENT_MAP_KEYS = 1 << 16;
+static constexpr U64 CONCURRENT_MAP_OPERATIONS = 1 << 21;
+
+template<class Map, class Operation>
+static bool ConcurrentMapMix(Map& map, U64 threadCount, U64 writePercent, Operation operation)
+{
+	for (U64 key = 0; key < CONCURRENT_MAP_KEYS; key += 2) { operation(map, 0, key); }
+
+	std::atomic<U64> wrong{ 0 };
+	std::vector<std::thread> threads;
+	U64 perThread = CONCURRENT_MAP_OPERATIONS / threadCount;
+
+	for (U64 t = 0; t < threadCount; ++t)
+	{
+		threads.emplace_back([&map, &wrong, &operation, perThread, writePercent, t]()
+			{
+				U64 seed = 88172645463325252ull ^ (t * 0x9E3779B97F4A7C15ull);
+
+				for (U64 i = 0; i < perThread; ++i)
+				{
+					seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17;
+					U64 key = seed % CONCURRENT_MAP_KEYS;
+
+					//0 sets the key to itself, 1 removes it, 2 reads it and reports a value that isn't the key
+					U64 kind = (seed >> 32) % 100 >= writePercent ? 2 : (seed >> 48) & 1;
+					if (!operation(map, kind, key)) { wrong.fetch_add(1, std::memory_order_relaxed); }
+				}
+			});
+	}
+
+	for (std::thread& thread : threads) { thread.join(); }
+
+	return wrong.load() == 0;
+}
+
+static bool ConcurrentHashmapMix(U64 threadCount, U64 writePercent)
+{
+	ConcurrentHashmap<U64, U64> map;
+
+	return ConcurrentMapMix(map, threadCount, writePercent, [](ConcurrentHashmap<U64, U64>& map, U64 kind, U64 key)
+		{
+			U64 value;
+			switch (kind)
+			{
+			case 0: map.Set(key, key); return true;
+			case 1: map.Remove(key); return true;
+			default: return !map.Find(key, value) || value == key;
+			}
+		});
+}
+
+struct SharedMutexMap
+{
+	std::unordered_map<U64, U64> map;
+	std::shared_mutex lock;
+};
+
+static bool SharedMutexMapMix(U64 threadCount, U64 writePercent)
+{
+	SharedMutexMap map;
+
+	return ConcurrentMapMix(map, threadCount, writePercent, [](SharedMutexMap& map, U64 kind, U64 key)
+		{
+			if (kind == 2)
+			{
+				std::shared_lock<std::shared_mutex> guard(map.lock);
+				auto it = map.map.find(key);
+				return it == map.map.end() || it->second == key;
+			}
+
+			std::unique_lock<std::shared_mutex> guard(map.lock);
+			if (kind == 0) { map.map[key] = key; }
+			else { map.map.erase(key); }
+			return true;
+		});
+}
+
+void ConcurrentHashmapReadMostlySpeed1()
 {
 	BEGIN_TEST;
 
+	/*** START TEST ***/
+
+	passed = ConcurrentHashmapMix(1, 5);
+
+	/*** END TEST ***/
+
 	END_TEST;
 }
 
-void StringToLower()
+void SharedMutexMapReadMostlySpeed1()
 {
 	BEGIN_TEST;
 
+	/*** START TEST ***/
+
+	passed = SharedMutexMapMix(1, 5);
+
+	/*** END TEST ***/
+
 	END_TEST;
 }
 
-void StringToCapital()
+void ConcurrentHashmapReadMostlySpeed4()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = ConcurrentHashmapMix(4, 5);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void SharedMutexMapReadMostlySpeed4()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = SharedMutexMapMix(4, 5);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void ConcurrentHashmapReadMostlySpeed16()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = ConcurrentHashmapMix(16, 5);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void SharedMutexMapReadMostlySpeed16()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = SharedMutexMapMix(16, 5);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void ConcurrentHashmapReadMostlySpeed64()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = ConcurrentHashmapMix(64, 5);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void SharedMutexMapReadMostlySpeed64()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = SharedMutexMapMix(64, 5);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void ConcurrentHashmapMixedSpeed1()
 {
 	BEGIN_TEST;
 
+	/*** START TEST ***/
+
+	passed = ConcurrentHashmapMix(1, 50);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void SharedMutexMapMixedSpeed1()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = SharedMutexMapMix(1, 50);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void ConcurrentHashmapMixedSpeed4()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = ConcurrentHashmapMix(4, 50);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void SharedMutexMapMixedSpeed4()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = SharedMutexMapMix(4, 50);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void ConcurrentHashmapMixedSpeed16()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = ConcurrentHashmapMix(16, 50);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void SharedMutexMapMixedSpeed16()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = SharedMutexMapMix(16, 50);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void ConcurrentHashmapMixedSpeed64()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = ConcurrentHashmapMix(64, 50);
+
+	/*** END TEST ***/
+
+	END_TEST;
+}
+
+void SharedMutexMapMixedSpeed64()
+{
+	BEGIN_TEST;
+
+	/*** START TEST ***/
+
+	passed = SharedMutexMapMix(64, 50);
+
+	/*** END TEST ***/
+
 	END_TEST;
 }
 
@@ -2192,9 +7392,324 @@ int main()
 	//StringIndexOf();
 	//StringLastIndexOf();
 	//StringTrim();
-	//StringToUpper();
-	//StringToLower();
-	//StringToCapital();
+	StringToUpper();
+	StringToLower();
+	StringToCapital();
+#pragma endregion
+
+#pragma region String Search Tests
+	printf("\nSTRING SEARCH TESTS: \n");
+	StringIndexOf();
+	StringIndexOfString();
+	StringIndexOfLongString();
+	StringContains();
+	StringCountOccurrences();
+	StringReplaceAll();
+	StringSearchSpeed();
+	STLStringSearchSpeed();
+	StrstrSearchSpeed();
+#pragma endregion
+
+#pragma region String View Tests
+	printf("\nSTRING VIEW TESTS: \n");
+	StringTrim();
+	StringViewInit();
+	StringSubStringView();
+	StringViewTrim();
+	StringViewSearch();
+	StringAppendView();
+	StringViewSubStringSpeed();
+	StringCopySubStringSpeed();
+#pragma endregion
+
+#pragma region String Pool Tests
+	printf("\nSTRING POOL TESTS: \n");
+	StringPoolIntern();
+	StringPoolFind();
+	StringPoolView();
+	StringPoolThreadSafe();
+	StringPoolCompareSpeed();
+	StringCompareSpeed();
+#pragma endregion
+
+#pragma region Rope Tests
+	printf("\nROPE TESTS: \n");
+	RopeInit();
+	RopeAppendPrepend();
+	RopeInsertErase();
+	RopeSubString();
+	RopeBalance();
+	RopePrependSpeed();
+	StringPrependSpeed();
+	RopeInsertMiddleSpeed();
+	STLStringInsertMiddleSpeed();
+#pragma endregion
+
+#pragma region Gap String Tests
+	printf("\nGAP STRING TESTS: \n");
+	GapStringInit();
+	GapStringInsert();
+	GapStringDelete();
+	GapStringHalves();
+	GapStringTypingReplay();
+	GapStringTypingSpeed();
+	StringTypingSpeed();
+	RopeTypingSpeed();
+#pragma endregion
+
+#pragma region String Format Tests
+	printf("\nSTRING FORMAT TESTS: \n");
+	StringFormat();
+	StringFormatFloat();
+	StringAppendFormat();
+	StringFormatSpeed();
+	SnprintfFormatSpeed();
+#pragma endregion
+
+#pragma region String Parse Tests
+	printf("\nSTRING PARSE TESTS: \n");
+	StringParseInt();
+	StringParseFloat();
+	StringParseHex();
+	StringParseSpeed();
+	StrtodParseSpeed();
+#pragma endregion
+
+#pragma region String Transcode Tests
+	printf("\nSTRING TRANSCODE TESTS: \n");
+	StringToUtf8();
+	StringToUtf16();
+	StringToUtf32();
+	StringValidUtf();
+	StringTranscodeSpeed();
+	MultiByteTranscodeSpeed();
+#pragma endregion
+
+#pragma region Hash Tests
+	printf("\nHASH TESTS: \n");
+	HashStrings();
+	HashTrivial();
+	HashCached();
+	HashDistribution();
+	HashSpeed<1>();
+	STLHashSpeed<1>();
+	HashSpeed<4>();
+	STLHashSpeed<4>();
+	HashSpeed<16>();
+	STLHashSpeed<16>();
+	HashSpeed<64>();
+	STLHashSpeed<64>();
+	HashSpeed<256>();
+	STLHashSpeed<256>();
+	HashSpeed<1024>();
+	STLHashSpeed<1024>();
+	HashSpeed<4096>();
+	STLHashSpeed<4096>();
+#pragma endregion
+
+#pragma region String Split Tests
+	printf("\nSTRING SPLIT TESTS: \n");
+	StringSplit();
+	StringSplitLines();
+	StringTokenize();
+	StringSplitInto();
+	StringSplitSpeed();
+	STLSplitSpeed();
+#pragma endregion
+
+#pragma region String Compare Tests
+	printf("\nSTRING COMPARE TESTS: \n");
+	StringEquality();
+	StringOrdering();
+	StringEqualsIgnoreCase();
+	StringIndexOfIgnoreCase();
+	StringIgnoreCaseSpeed();
+	STLIgnoreCaseSpeed();
+#pragma endregion
+
+#pragma region Shared String Tests
+	printf("\nSHARED STRING TESTS: \n");
+	SharedStringInit();
+	SharedStringAdopt();
+	SharedStringCopy();
+	SharedStringSlice();
+	SharedStringThreads();
+	SharedStringHandOffSpeed();
+	StringHandOffSpeed();
+#pragma endregion
+
+#pragma region Pattern Set Tests
+	printf("\nPATTERN SET TESTS: \n");
+	PatternSetBasic();
+	PatternSetEdgeCases();
+	PatternSetWide();
+	PatternSetMatchesSearch();
+	PatternSetSpeed<10>();
+	IndexOfLoopSpeed<10>();
+	PatternSetSpeed<1000>();
+	IndexOfLoopSpeed<1000>();
+	PatternSetSpeed<100000>();
+#pragma endregion
+
+#pragma region String Encoding Tests
+	printf("\nSTRING ENCODING TESTS: \n");
+	StringBase64Encode();
+	StringBase64Decode();
+	StringHexEncoding();
+	StringEncodeRoundTrip();
+	StringBase64Speed();
+	ScalarBase64Speed();
+	StringHexSpeed();
+	ScalarHexSpeed();
+#pragma endregion
+
+#pragma region Constexpr Tests
+	printf("\nCONSTEXPR TESTS: \n");
+	ConstexprStringBuild();
+	ConstexprVectorBuild();
+	FrozenTable();
+	FrozenString();
+	StartupTableSpeed();
+	FrozenTableSpeed();
+#pragma endregion
+
+#pragma region List Tests
+	printf("\nLIST TESTS: \n");
+	ListPushPop();
+	ListInsertRemove();
+	ListCopyMove();
+	ListNodeLayout();
+	ListSpliceMerge();
+	ListInsertLists();
+	ListReverseSort();
+	ListChurnSpeed();
+	STLListChurnSpeed();
+	ListTraversalSpeed();
+	STLListTraversalSpeed();
+	ListSortSpeed();
+	STLListSortSpeed();
+#pragma endregion
+
+#pragma region Unrolled List Tests
+	printf("\nUNROLLED LIST TESTS: \n");
+	UnrolledListPushPop();
+	UnrolledListIterators();
+	UnrolledListRandom();
+	UnrolledListCopyMove();
+	UnrolledListTraversalSpeed();
+	ListTraversalSpeed();
+	VectorTraversalSpeed();
+	UnrolledListMidInsertSpeed();
+	ListMidInsertSpeed();
+	VectorMidInsertSpeed();
+#pragma endregion
+
+#pragma region Intrusive List Tests
+	printf("\nINTRUSIVE LIST TESTS: \n");
+	IntrusiveListLinks();
+	IntrusiveListSpliceMerge();
+	IntrusiveTimerSpeed();
+	STLTimerSpeed();
+#pragma endregion
+
+#pragma region Compact List Tests
+	printf("\nCOMPACT LIST TESTS: \n");
+	CompactListRandom();
+	CompactListIterators();
+	CompactListSortMerge();
+	CompactListLayout();
+	CompactListChurnSpeed();
+	ListChurnSpeed();
+	CompactListTraversalSpeed();
+	ListTraversalSpeed();
+	CompactListCopySpeed();
+	ListCopySpeed();
+#pragma endregion
+
+#pragma region Skip List Tests
+	printf("\nSKIP LIST TESTS: \n");
+	SkipListRandom();
+	SkipListIndexing();
+	SkipListIterators();
+	SkipListEditSpeed();
+	ListEditSpeed();
+	VectorEditSpeed();
+#pragma endregion
+
+#pragma region MPSC List Tests
+	printf("\nMPSC LIST TESTS: \n");
+	MPSCListBatches();
+	MPSCListThreads();
+	MPSCListHandOffSpeed1();
+	MutexListHandOffSpeed1();
+	MPSCListHandOffSpeed4();
+	MutexListHandOffSpeed4();
+	MPSCListHandOffSpeed16();
+	MutexListHandOffSpeed16();
+	MPSCListHandOffSpeed64();
+	MutexListHandOffSpeed64();
+#pragma endregion
+
+#pragma region Hashmap Tests
+	printf("\nHASHMAP TESTS: \n");
+	HashmapBasics();
+	HashmapRandom();
+	HashmapLinearRandom();
+	HashmapRobinHoodRandom();
+	HashmapCuckooRandom();
+	HashmapProbeStatistics();
+	HashmapReserve();
+	HashmapQuadraticLoadMatrix();
+	HashmapLinearLoadMatrix();
+	HashmapRobinHoodLoadMatrix();
+	HashmapCuckooLoadMatrix();
+	HashmapHitSpeed1K();
+	STLHashmapHitSpeed1K();
+	HashmapMissSpeed1K();
+	STLHashmapMissSpeed1K();
+	HashmapChurnSpeed1K();
+	STLHashmapChurnSpeed1K();
+	HashmapHitSpeed100K();
+	STLHashmapHitSpeed100K();
+	HashmapMissSpeed100K();
+	STLHashmapMissSpeed100K();
+	HashmapChurnSpeed100K();
+	STLHashmapChurnSpeed100K();
+	HashmapHitSpeed10M();
+	STLHashmapHitSpeed10M();
+	HashmapMissSpeed10M();
+	STLHashmapMissSpeed10M();
+	HashmapChurnSpeed10M();
+	STLHashmapChurnSpeed10M();
+	//The 100M tables need several gigabytes
+	//HashmapHitSpeed100M();
+	//STLHashmapHitSpeed100M();
+	//HashmapMissSpeed100M();
+	//STLHashmapMissSpeed100M();
+	//HashmapChurnSpeed100M();
+	//STLHashmapChurnSpeed100M();
+#pragma endregion
+
+#pragma region Concurrent Hashmap Tests
+	printf("\nCONCURRENT HASHMAP TESTS: \n");
+	ConcurrentHashmapBasics();
+	ConcurrentHashmapThreads();
+	ConcurrentHashmapReadMostlySpeed1();
+	SharedMutexMapReadMostlySpeed1();
+	ConcurrentHashmapReadMostlySpeed4();
+	SharedMutexMapReadMostlySpeed4();
+	ConcurrentHashmapReadMostlySpeed16();
+	SharedMutexMapReadMostlySpeed16();
+	ConcurrentHashmapReadMostlySpeed64();
+	SharedMutexMapReadMostlySpeed64();
+	ConcurrentHashmapMixedSpeed1();
+	SharedMutexMapMixedSpeed1();
+	ConcurrentHashmapMixedSpeed4();
+	SharedMutexMapMixedSpeed4();
+	ConcurrentHashmapMixedSpeed16();
+	SharedMutexMapMixedSpeed16();
+	ConcurrentHashmapMixedSpeed64();
+	SharedMutexMapMixedSpeed64();
 #pragma endregion
 
 #pragma region Vector Tests